@@ -42,8 +42,19 @@ class BlinkDemo
             NanoOsHeap& nano_os_heap = nano_os.getHeapModule();
             void* heap_area;
             size_t heap_size;
-            NANO_OS_BSP_GetHeapArea(&heap_area, &heap_size);
-            nano_os_heap.init(heap_area, heap_size);
+            uint32_t heap_attributes;
+            NANO_OS_BSP_GetHeapArea(&heap_area, &heap_size, &heap_attributes);
+            nano_os_heap.init(heap_area, heap_size, heap_attributes);
+
+            #if (NANO_OS_HEAP_MAX_REGION_COUNT > 1u)
+            // Add the other memory regions of the board
+            uint32_t region_count = 0u;
+            const nano_os_bsp_heap_region_t* const heap_regions = NANO_OS_BSP_GetHeapRegions(&region_count);
+            for (uint32_t i = 0u; i < region_count; i++)
+            {
+                (void)nano_os_heap.addRegion(heap_regions[i].start, heap_regions[i].size, heap_regions[i].attributes, heap_regions[i].name);
+            }
+            #endif // (NANO_OS_HEAP_MAX_REGION_COUNT > 1u)
             #endif // (NANO_OS_HEAP_ENABLED == 1u)
 
             // Create the waitable timer
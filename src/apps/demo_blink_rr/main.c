@@ -89,7 +89,7 @@ static void* LED_Task(void* param)
     const uint32_t led_id = task_id + 1u;
 
     /* Create the timer */
-    (void)NANO_OS_TIMER_Create(&led_task_timer[task_id], NULL, NULL);
+    (void)NANO_OS_TIMER_Create(&led_task_timer[task_id], NULL, NULL, NULL);
     (void)NANO_OS_TIMER_Start(&led_task_timer[task_id], NANO_OS_MS_TO_TICKS(250u * led_id), NANO_OS_MS_TO_TICKS(250u * led_id));
 
     /* Task loop */
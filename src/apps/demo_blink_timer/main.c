@@ -114,7 +114,7 @@ int main(void)
         if (ret == NOS_ERR_SUCCESS)
         {
             /* Create the timer */
-            ret = NANO_OS_TIMER_Create(&timer, MAIN_TimerCallback, NANO_OS_CAST(void*, 0u));
+            ret = NANO_OS_TIMER_Create(&timer, MAIN_TimerCallback, NANO_OS_CAST(void*, 0u), NULL);
             if (ret == NOS_ERR_SUCCESS)
             {
                 /* Create the waitable timer */
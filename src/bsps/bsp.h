@@ -35,6 +35,20 @@ extern "C"
 #endif /* __cplusplus */
 
 
+/** \brief Description of an additional heap memory region */
+typedef struct _nano_os_bsp_heap_region_t
+{
+    /** \brief Name */
+    const char* name;
+    /** \brief Start address */
+    void* start;
+    /** \brief Size in bytes */
+    size_t size;
+    /** \brief Attributes (combination of nano_os_heap_attribute_t values) */
+    uint32_t attributes;
+} nano_os_bsp_heap_region_t;
+
+
 /** \brief Initialize the board */
 nano_os_error_t NANO_OS_BSP_Init(void);
 
@@ -53,8 +67,11 @@ void NANO_OS_BSP_GetLedIoRegistersMem(uint32_t* const start_address, uint32_t* c
 /** \brief Get the UART registers memory area description */
 void NANO_OS_BSP_GetUartIoRegistersMem(uint32_t* const start_address, uint32_t* const size);
 
-/** \brief Get the heap memory area description */
-void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size);
+/** \brief Get the heap memory area description (heap_attributes is a combination of nano_os_heap_attribute_t values, 0 for general purpose memory) */
+void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size, uint32_t* heap_attributes);
+
+/** \brief Get the description of the additional heap memory regions (to be added to the heap after the heap area) */
+const nano_os_bsp_heap_region_t* NANO_OS_BSP_GetHeapRegions(uint32_t* const region_count);
 
 
 #ifdef __cplusplus
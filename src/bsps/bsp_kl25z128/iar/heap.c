@@ -21,11 +21,21 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 
 
 /** \brief Get the heap memory area description */
-void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size)
+void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size, uint32_t* heap_attributes)
 {
     extern char HEAP$$Base[];
     extern char HEAP$$Limit[];
 
     (*heap_area) = HEAP$$Base;
     (*heap_size) = NANO_OS_CAST(size_t, HEAP$$Limit - HEAP$$Base);
+    (*heap_attributes) = 0u;
+}
+
+
+/** \brief Get the description of the additional heap memory regions */
+const nano_os_bsp_heap_region_t* NANO_OS_BSP_GetHeapRegions(uint32_t* const region_count)
+{
+    /* No additional memory region on this board */
+    (*region_count) = 0u;
+    return NULL;
 }
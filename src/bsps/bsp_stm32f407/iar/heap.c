@@ -18,14 +18,36 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "bsp.h"
+#include "nano_os_heap.h"
 
 
 /** \brief Get the heap memory area description */
-void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size)
+void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size, uint32_t* heap_attributes)
 {
     extern char __HeapBase[];
     extern char __HeapLimit[];
 
     (*heap_area) = __HeapBase;
     (*heap_size) = NANO_OS_CAST(size_t, __HeapLimit - __HeapBase);
+
+    /* Main SRAM, reachable by the DMA controllers */
+    (*heap_attributes) = (NOS_HEAP_ATTR_DMA | NOS_HEAP_ATTR_BULK);
+}
+
+
+/** \brief Get the description of the additional heap memory regions */
+const nano_os_bsp_heap_region_t* NANO_OS_BSP_GetHeapRegions(uint32_t* const region_count)
+{
+    extern char HEAP_CCM$$Base[];
+    extern char HEAP_CCM$$Limit[];
+    static nano_os_bsp_heap_region_t heap_regions[1u];
+
+    /* CCM RAM, tightly coupled to the core and not reachable by the DMA controllers */
+    heap_regions[0u].name = "ccm";
+    heap_regions[0u].start = HEAP_CCM$$Base;
+    heap_regions[0u].size = NANO_OS_CAST(size_t, HEAP_CCM$$Limit - HEAP_CCM$$Base);
+    heap_regions[0u].attributes = NOS_HEAP_ATTR_FAST;
+
+    (*region_count) = sizeof(heap_regions) / sizeof(nano_os_bsp_heap_region_t);
+    return heap_regions;
 }
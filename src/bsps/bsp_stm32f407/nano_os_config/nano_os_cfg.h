@@ -96,14 +96,19 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 
 
 /** \brief Maximum number of interrupt service requests
- *         Shall be equal to :
+ *         Shall be a power of 2 greater than or equal to :
  *         maximum number of interrupt handler which share the same wait object + 1
+ *         (coalesced requests like semaphore posts from interrupt handlers and deferred ticks
+ *          don't use any entry)
  * */
 #define NANO_OS_MAX_ISR_REQUEST_COUNT           2u
 
 /** \brief Size of the interrupt service request task stack in number of elements */
 #define NANO_OS_ISR_REQUEST_TASK_STACK_SIZE     (NANO_OS_PORT_MIN_STACK_SIZE + 64u)
 
+/** \brief Enable threaded interrupt handlers */
+#define NANO_OS_INTERRUPT_THREAD_ENABLED        0u
+
 
 
 
@@ -173,6 +178,12 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Enable NANO_OS_TASK_Get() system call */
 #define NANO_OS_TASK_GET_ENABLED                1u
 
+/** \brief Enable NANO_OS_TASK_Notify() and NANO_OS_TASK_NotifyWait() system calls */
+#define NANO_OS_TASK_NOTIFY_ENABLED             1u
+
+/** \brief Enable NANO_OS_TASK_NotifyFromIsr() system call */
+#define NANO_OS_TASK_NOTIFYFROMISR_ENABLED              1u
+
 
 /*************************** Semaphore system calls *************************/
 
@@ -254,12 +265,96 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Enable NANO_OS_MAILBOX_GetCount() system call */
 #define NANO_OS_MAILBOX_GETCOUNT_ENABLED				1u
 
+/** \brief Enable NANO_OS_MAILBOX_PostMany() and NANO_OS_MAILBOX_WaitMany() system calls */
+#define NANO_OS_MAILBOX_BATCH_ENABLED           1u
+
+/** \brief Enable NANO_OS_MAILBOX_PostTimeout() system call */
+#define NANO_OS_MAILBOX_BLOCKING_POST_ENABLED   1u
+
+/** \brief Enable NANO_OS_MAILBOX_PostUrgent() system call */
+#define NANO_OS_MAILBOX_URGENT_ENABLED          1u
+
+/** \brief Enable the mailbox priority lanes (NANO_OS_MAILBOX_SetLanes() and NANO_OS_MAILBOX_PostLane() system calls) */
+#define NANO_OS_MAILBOX_LANES_ENABLED           1u
+
 /** \brief Enable NANO_OS_MAILBOX_Destroy() system call */
 #define NANO_OS_MAILBOX_DESTROY_ENABLED                 1u
 
 /** \brief Enable NANO_OS_MAILBOX_SetName() system call */
 #define NANO_OS_MAILBOX_SETNAME_ENABLED         1u
 
+/** \brief Enable the zero-copy mailboxes (NANO_OS_MAILBOX_CreateZeroCopy() system call) */
+#define NANO_OS_MAILBOX_ZEROCOPY_ENABLED        1u
+
+/** \brief Enable the detection of leaked buffers of the zero-copy mailboxes (debug purpose) */
+#define NANO_OS_MAILBOX_LEAK_CHECK_ENABLED      0u
+
+
+/*********************** Blackboard system calls *********************/
+
+/** \brief Enable the blackboard objects */
+#define NANO_OS_BLACKBOARD_ENABLED              0u
+
+/** \brief Enable NANO_OS_BLACKBOARD_Destroy() system call */
+#define NANO_OS_BLACKBOARD_DESTROY_ENABLED              1u
+
+/** \brief Enable NANO_OS_BLACKBOARD_SetName() system call */
+#define NANO_OS_BLACKBOARD_SETNAME_ENABLED      1u
+
+
+/*********************** Channel system calls *********************/
+
+/** \brief Enable the channel objects */
+#define NANO_OS_CHANNEL_ENABLED                 0u
+
+/** \brief Enable NANO_OS_CHANNEL_Destroy() system call */
+#define NANO_OS_CHANNEL_DESTROY_ENABLED                 1u
+
+/** \brief Enable NANO_OS_CHANNEL_SetName() system call */
+#define NANO_OS_CHANNEL_SETNAME_ENABLED         1u
+
+
+/*********************** Stream buffer system calls *********************/
+
+/** \brief Enable the stream buffer objects */
+#define NANO_OS_STREAM_BUFFER_ENABLED           0u
+
+/** \brief Enable NANO_OS_STREAM_BUFFER_WriteFromIsr() system call */
+#define NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED      1u
+
+/** \brief Enable NANO_OS_STREAM_BUFFER_Destroy() system call */
+#define NANO_OS_STREAM_BUFFER_DESTROY_ENABLED           1u
+
+/** \brief Enable NANO_OS_STREAM_BUFFER_SetName() system call */
+#define NANO_OS_STREAM_BUFFER_SETNAME_ENABLED   1u
+
+
+/*********************** Message buffer system calls ********************/
+
+/** \brief Enable the message buffer objects */
+#define NANO_OS_MESSAGE_BUFFER_ENABLED          0u
+
+/** \brief Enable NANO_OS_MESSAGE_BUFFER_Destroy() system call */
+#define NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED  1u
+
+/** \brief Enable NANO_OS_MESSAGE_BUFFER_SetName() system call */
+#define NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED  1u
+
+
+/************************ Memory pool system calls **********************/
+
+/** \brief Enable the fixed-size block memory pool objects */
+#define NANO_OS_MEM_POOL_ENABLED                0u
+
+/** \brief Enable NANO_OS_MEM_POOL_FreeFromIsr() system call */
+#define NANO_OS_MEM_POOL_FREEFROMISR_ENABLED    1u
+
+/** \brief Enable NANO_OS_MEM_POOL_Destroy() system call */
+#define NANO_OS_MEM_POOL_DESTROY_ENABLED        1u
+
+/** \brief Enable NANO_OS_MEM_POOL_SetName() system call */
+#define NANO_OS_MEM_POOL_SETNAME_ENABLED        1u
+
 
 /*************************** Timer system calls *************************/
 
@@ -272,6 +367,27 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Size of the timer task stack in number of elements */
 #define NANO_OS_TIMER_TASK_STACK_SIZE           (NANO_OS_PORT_MIN_STACK_SIZE + 64u)
 
+/** \brief Number of bits of the slot index in each level of the timer wheel (2^bits slots per level) */
+#define NANO_OS_TIMER_WHEEL_SLOT_BITS           4u
+
+/** \brief Number of levels of the timer wheel (timeouts up to 2^(bits*levels) ticks are handled without extra cascading) */
+#define NANO_OS_TIMER_WHEEL_LEVEL_COUNT         4u
+
+/** \brief Enable NANO_OS_TIMER_SetIsrContext() system call to call timer callbacks from the tick interrupt instead of the timer task */
+#define NANO_OS_TIMER_ISR_CALLBACK_ENABLED      1u
+
+/** \brief Enable NANO_OS_TIMER_CreateService() system call to create additional timer service tasks */
+#define NANO_OS_TIMER_CREATESERVICE_ENABLED     1u
+
+
+/*************************** High resolution timer system calls *************************/
+
+/** \brief Enable the high resolution timer objects (needs a port or user provided s hardware timer) */
+#define NANO_OS_HR_TIMER_ENABLED                0u
+
+/** \brief Enable NANO_OS_HR_TIMER_Destroy() system call */
+#define NANO_OS_HR_TIMER_DESTROY_ENABLED                1u
+
 
 /*************************** Waitable timer system calls *************************/
 
@@ -304,6 +420,33 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Enable the heap capacity to merge de-allocated blocks in memory if possible (contiguous blocks) */
 #define NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED  1u
 
+/** \brief Enable the Two-Level Segregated Fit allocator (O(1) allocation and de-allocation, free blocks are always merged) instead of the first-fit allocator */
+#define NANO_OS_HEAP_TLSF_ENABLED               0u
+
+/** \brief Number of bits of the second level index of the TLSF allocator (2^bits free lists for each power of 2 size range, 5 bits max) */
+#define NANO_OS_HEAP_TLSF_SL_INDEX_BITS         4u
+
+/** \brief Number of bits of the heap area size handled by the TLSF allocator (31 bits max) */
+#define NANO_OS_HEAP_TLSF_MAX_SIZE_BITS         20u
+
+/** \brief Maximum number of memory regions managed by the heap (the heap area given at initialization is the first one) */
+#define NANO_OS_HEAP_MAX_REGION_COUNT           2u
+
+/** \brief Enable the size class caches of the heap (small blocks are recycled without locking the heap mutex) */
+#define NANO_OS_HEAP_CACHE_ENABLED              0u
+
+/** \brief Number of size classes of the heap caches */
+#define NANO_OS_HEAP_CACHE_CLASS_COUNT          4u
+
+/** \brief Block sizes in bytes of the size classes of the heap caches (increasing order, multiples of 4 bytes) */
+#define NANO_OS_HEAP_CACHE_CLASS_SIZES          { 16u, 32u, 64u, 128u }
+
+/** \brief Maximum number of free blocks kept in the cache of each size class */
+#define NANO_OS_HEAP_CACHE_CLASS_DEPTHS         { 16u, 16u, 8u, 8u }
+
+/** \brief Number of blocks moved at once between the cache of each size class and the heap (must be <= depth) */
+#define NANO_OS_HEAP_CACHE_CLASS_BATCHES        { 8u, 8u, 4u, 4u }
+
 /** \brief Enable NANO_OS_HEAP_GetStats() system call */
 #define NANO_OS_HEAP_GETSTATS_ENABLED                   1u
 
@@ -311,6 +454,21 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #define NANO_OS_HEAP_CONSOLE_CMD_ENABLED        1u
 
 
+/*************************** Arena module *************************/
+
+/** \brief Enable the arena module */
+#define NANO_OS_ARENA_ENABLED                   0u
+
+/** \brief Alignment in bytes of the arena allocations (must be a power of 2) */
+#define NANO_OS_ARENA_ALIGNMENT                 8u
+
+/** \brief Enable NANO_OS_ARENA_CreateFromHeap() system call */
+#define NANO_OS_ARENA_HEAP_ENABLED                      1u
+
+/** \brief Enable NANO_OS_ARENA_GetStats() system call */
+#define NANO_OS_ARENA_GETSTATS_ENABLED                  1u
+
+
 /*********************** Statistics module *********************/
 
 
@@ -323,6 +481,9 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Enable NANO_OS_STATS_GetStackUsage() system call */
 #define NANO_OS_STATS_GETSTACKUSAGE_ENABLED             1u
 
+/** \brief Enable NANO_OS_STATS_GetTimerStats() system call */
+#define NANO_OS_STATS_GETTIMERSTATS_ENABLED             1u
+
 /** \brief Enable the statistics commands in Nano OS console module */
 #define NANO_OS_STATS_CONSOLE_CMD_ENABLED       1u
 
@@ -332,6 +493,22 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Enable the 'memstats' statistics command in Nano OS console module */
 #define NANO_OS_STATS_MEMSTATS_CMD_ENABLED      1u
 
+/** \brief Enable the 'timerstats' statistics command in Nano OS console module */
+#define NANO_OS_STATS_TIMERSTATS_CMD_ENABLED    1u
+
+
+/*********************** Work queue module *********************/
+
+
+/** \brief Enable the work queue module */
+#define NANO_OS_WORKQUEUE_ENABLED               0u
+
+/** \brief Enable NANO_OS_WORKQUEUE_QueueDelayed() system call */
+#define NANO_OS_WORKQUEUE_DELAYED_ENABLED               1u
+
+/** \brief Enable NANO_OS_WORKQUEUE_SetName() system call */
+#define NANO_OS_WORKQUEUE_SETNAME_ENABLED       1u
+
 
 /*********************** Console module *********************/
 
@@ -376,6 +553,9 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Enable the memory access requests in the debug module */
 #define NANO_OS_DEBUG_MEMORY_REQS_ENABLED       1u
 
+/** \brief Enable the heap related requests */
+#define NANO_OS_DEBUG_HEAP_REQS_ENABLED         1u
+
 
 
 
@@ -49,9 +49,18 @@ void NANO_OS_BSP_LedOff(const uint8_t led)
 }
 
 /** \brief Get the heap memory area description */
-void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size)
+void NANO_OS_BSP_GetHeapArea(void** heap_area, size_t* heap_size, uint32_t* heap_attributes)
 {
     static uint8_t heap_buffer[2048u];
     (*heap_area) = heap_buffer;
     (*heap_size) = sizeof(heap_buffer);
+    (*heap_attributes) = 0u;
+}
+
+/** \brief Get the description of the additional heap memory regions */
+const nano_os_bsp_heap_region_t* NANO_OS_BSP_GetHeapRegions(uint32_t* const region_count)
+{
+    /* No additional memory region on this board */
+    (*region_count) = 0u;
+    return NULL;
 }
@@ -26,12 +26,19 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "nano_os_console.hpp"
 #include "nano_os_heap.hpp"
+#include "nano_os_arena.hpp"
+#include "nano_os_blackboard.hpp"
+#include "nano_os_channel.hpp"
+#include "nano_os_stream_buffer.hpp"
+#include "nano_os_message_buffer.hpp"
+#include "nano_os_mem_pool.hpp"
 #include "nano_os_cond_var.hpp"
 #include "nano_os_flag_set.hpp"
 #include "nano_os_mailbox.hpp"
 #include "nano_os_mutex.hpp"
 #include "nano_os_semaphore.hpp"
 #include "nano_os_timer.hpp"
+#include "nano_os_hr_timer.hpp"
 #include "nano_os_waitable_timer.hpp"
 
 
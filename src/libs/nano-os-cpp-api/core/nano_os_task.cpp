@@ -102,6 +102,32 @@ nano_os_error_t NanoOsTask::join(void** return_value, const uint32_t tick_count)
 
 #endif /* (NANO_OS_TASK_JOIN_ENABLED == 1u) */
 
+#if (NANO_OS_TASK_NOTIFY_ENABLED == 1u)
+
+/** \brief Send a notification to the task */
+nano_os_error_t NanoOsTask::notify(const uint32_t value, const nano_os_task_notify_action_t action)
+{
+    return NANO_OS_TASK_Notify(&m_task, value, action);
+}
+
+#if (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u)
+
+/** \brief Send a notification to the task from an interrupt handler */
+nano_os_error_t NanoOsTask::notifyFromIsr(const uint32_t value, const nano_os_task_notify_action_t action)
+{
+    return NANO_OS_TASK_NotifyFromIsr(&m_task, value, action);
+}
+
+#endif /* (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u) */
+
+/** \brief Wait for a notification on the current task for fixed number of ticks */
+nano_os_error_t NanoOsTask::notifyWait(const uint32_t clear_on_entry, const uint32_t clear_on_exit, uint32_t& value, const uint32_t tick_count)
+{
+    return NANO_OS_TASK_NotifyWait(clear_on_entry, clear_on_exit, &value, tick_count);
+}
+
+#endif /* (NANO_OS_TASK_NOTIFY_ENABLED == 1u) */
+
 
 /** \brief Startup function for the tasks */
 void* NanoOsTask::taskStart(void* const param)
@@ -72,6 +72,23 @@ class NanoOsTask
 
         #endif /* (NANO_OS_TASK_JOIN_ENABLED == 1u) */
 
+        #if (NANO_OS_TASK_NOTIFY_ENABLED == 1u)
+
+        /** \brief Send a notification to the task */
+        nano_os_error_t notify(const uint32_t value, const nano_os_task_notify_action_t action);
+
+        #if (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u)
+
+        /** \brief Send a notification to the task from an interrupt handler */
+        nano_os_error_t notifyFromIsr(const uint32_t value, const nano_os_task_notify_action_t action);
+
+        #endif /* (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u) */
+
+        /** \brief Wait for a notification on the current task for fixed number of ticks */
+        static nano_os_error_t notifyWait(const uint32_t clear_on_entry, const uint32_t clear_on_exit, uint32_t& value, const uint32_t tick_count);
+
+        #endif /* (NANO_OS_TASK_NOTIFY_ENABLED == 1u) */
+
 
     private:
 
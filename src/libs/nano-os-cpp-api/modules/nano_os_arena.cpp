@@ -0,0 +1,129 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_arena.hpp"
+
+// Check if module is enabled
+#if (NANO_OS_ARENA_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Default constructor */
+NanoOsArena::NanoOsArena()
+: m_arena()
+{
+}
+
+/** \brief Constructor with creation in a buffer */
+NanoOsArena::NanoOsArena(void* const buffer, const size_t size)
+: m_arena()
+{
+    const nano_os_error_t ret = create(buffer, size);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor */
+NanoOsArena::~NanoOsArena()
+{
+    // Destroy the arena if it has been created
+    if (m_arena.buffer != NULL)
+    {
+        const nano_os_error_t ret = NANO_OS_ARENA_Destroy(&m_arena);
+        NANO_OS_ERROR_ASSERT_RET(ret);
+    }
+}
+
+/** \brief Create the arena in a buffer */
+nano_os_error_t NanoOsArena::create(void* const buffer, const size_t size)
+{
+    return NANO_OS_ARENA_Create(&m_arena, buffer, size);
+}
+
+#if (NANO_OS_ARENA_HEAP_ENABLED == 1u)
+
+/** \brief Create the arena in a buffer allocated from the heap */
+nano_os_error_t NanoOsArena::createFromHeap(const size_t size)
+{
+    return NANO_OS_ARENA_CreateFromHeap(&m_arena, size);
+}
+
+#endif /* (NANO_OS_ARENA_HEAP_ENABLED == 1u) */
+
+/** \brief Allocate memory from the arena */
+void* NanoOsArena::alloc(const size_t size)
+{
+    return NANO_OS_ARENA_Alloc(&m_arena, size);
+}
+
+/** \brief Get a mark on the current position of the arena */
+nano_os_error_t NanoOsArena::getMark(nano_os_arena_mark_t& mark) const
+{
+    return NANO_OS_ARENA_GetMark(&m_arena, &mark);
+}
+
+/** \brief Release all the memory allocated since a mark has been taken */
+nano_os_error_t NanoOsArena::rewind(const nano_os_arena_mark_t mark)
+{
+    return NANO_OS_ARENA_Rewind(&m_arena, mark);
+}
+
+/** \brief Release all the memory allocated from the arena */
+nano_os_error_t NanoOsArena::reset()
+{
+    return NANO_OS_ARENA_Reset(&m_arena);
+}
+
+#if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+
+/** \brief Get the statistics of the arena */
+nano_os_error_t NanoOsArena::getStats(nano_os_arena_stats_t& stats) const
+{
+    return NANO_OS_ARENA_GetStats(&m_arena, &stats);
+}
+
+#endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+
+
+
+/** \brief Constructor, takes a mark on the current position of the arena */
+NanoOsArenaScope::NanoOsArenaScope(NanoOsArena& arena)
+: m_arena(arena)
+, m_mark(0u)
+{
+    const nano_os_error_t ret = m_arena.getMark(m_mark);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor, rewinds the arena to the mark */
+NanoOsArenaScope::~NanoOsArenaScope()
+{
+    const nano_os_error_t ret = m_arena.rewind(m_mark);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_ARENA_ENABLED == 1u)
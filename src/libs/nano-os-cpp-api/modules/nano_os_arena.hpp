@@ -0,0 +1,123 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_ARENA_HPP
+#define NANO_OS_ARENA_HPP
+
+#include "nano_os_arena.h"
+#include "nano_os_cpp_api_cfg.h"
+
+// Check if module is enabled
+#if (NANO_OS_ARENA_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Nano OS arena (bump pointer allocator) */
+class NanoOsArena
+{
+    public:
+
+        /** \brief Default constructor */
+        NanoOsArena();
+
+        /** \brief Constructor with creation in a buffer */
+        NanoOsArena(void* const buffer, const size_t size);
+
+        /** \brief Destructor */
+        ~NanoOsArena();
+
+
+        /** \brief Create the arena in a buffer */
+        nano_os_error_t create(void* const buffer, const size_t size);
+
+        #if (NANO_OS_ARENA_HEAP_ENABLED == 1u)
+
+        /** \brief Create the arena in a buffer allocated from the heap */
+        nano_os_error_t createFromHeap(const size_t size);
+
+        #endif /* (NANO_OS_ARENA_HEAP_ENABLED == 1u) */
+
+        /** \brief Allocate memory from the arena */
+        void* alloc(const size_t size);
+
+        /** \brief Allocate memory for an array of objects from the arena (objects are not constructed) */
+        template <typename T>
+        T* alloc(const size_t count) { return NANO_OS_CAST(T*, alloc(count * sizeof(T))); }
+
+        /** \brief Get a mark on the current position of the arena */
+        nano_os_error_t getMark(nano_os_arena_mark_t& mark) const;
+
+        /** \brief Release all the memory allocated since a mark has been taken */
+        nano_os_error_t rewind(const nano_os_arena_mark_t mark);
+
+        /** \brief Release all the memory allocated from the arena */
+        nano_os_error_t reset();
+
+        #if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+
+        /** \brief Get the statistics of the arena */
+        nano_os_error_t getStats(nano_os_arena_stats_t& stats) const;
+
+        #endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsArena(const NanoOsArena& copy) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Underlying arena object */
+        nano_os_arena_t m_arena;
+};
+
+
+/** \brief Release at the end of a scope all the memory allocated from an arena during this scope */
+class NanoOsArenaScope
+{
+    public:
+
+        /** \brief Constructor, takes a mark on the current position of the arena */
+        NanoOsArenaScope(NanoOsArena& arena);
+
+        /** \brief Destructor, rewinds the arena to the mark */
+        ~NanoOsArenaScope();
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsArenaScope(const NanoOsArenaScope& copy) : m_arena(copy.m_arena), m_mark(0u) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Arena */
+        NanoOsArena& m_arena;
+
+        /** \brief Mark taken at the beginning of the scope */
+        nano_os_arena_mark_t m_mark;
+};
+
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_ARENA_ENABLED == 1u)
+
+#endif // NANO_OS_ARENA_HPP
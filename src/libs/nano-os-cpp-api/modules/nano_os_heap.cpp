@@ -53,33 +53,67 @@ NanoOsHeap::~NanoOsHeap()
 }
 
 /** \brief Initialize the heap module */
-nano_os_error_t NanoOsHeap::init(void* const heap_area_start, const size_t heap_area_size)
+nano_os_error_t NanoOsHeap::init(void* const heap_area_start, const size_t heap_area_size, const uint32_t heap_area_attributes)
 {
-    return NANO_OS_HEAP_Init(heap_area_start, heap_area_size);
+    return NANO_OS_HEAP_Init(heap_area_start, heap_area_size, heap_area_attributes);
 }
 
+#if (NANO_OS_HEAP_MAX_REGION_COUNT > 1u)
+/** \brief Add a memory region to the heap */
+nano_os_error_t NanoOsHeap::addRegion(void* const region_start, const size_t region_size, const uint32_t attributes, const char* const name)
+{
+    return NANO_OS_HEAP_AddRegion(region_start, region_size, attributes, name);
+}
+#endif /* (NANO_OS_HEAP_MAX_REGION_COUNT > 1u) */
+
 /** \brief Allocate memory from the heap */
-void* alloc(const size_t mem_size)
+void* NanoOsHeap::alloc(const size_t mem_size)
 {
     return NANO_OS_HEAP_Alloc(mem_size);
 }
 
+/** \brief Allocate memory from the heap regions having the requested attributes */
+void* NanoOsHeap::alloc(const size_t mem_size, const uint32_t attributes, const nano_os_heap_fallback_t fallback)
+{
+    return NANO_OS_HEAP_AllocWithHint(mem_size, attributes, fallback);
+}
+
 #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
 /** \brief De-allocate previously allocated memory from the heap */
-void free(void* mem)
+void NanoOsHeap::free(void* mem)
 {
     NANO_OS_HEAP_Free(mem);
 }
 #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
 
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+/** \brief Give all the blocks held by the size class caches back to the heap */
+nano_os_error_t NanoOsHeap::flushCaches()
+{
+    return NANO_OS_HEAP_FlushCaches();
+}
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
 #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
 /** \brief Get the heap module statistics */
-nano_os_error_t getStats(nano_os_heap_stats_t& heap_stats)
+nano_os_error_t NanoOsHeap::getStats(nano_os_heap_stats_t& heap_stats)
 {
     return NANO_OS_HEAP_GetStats(&heap_stats);
 }
 #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
 
+/** \brief Get the number of memory regions of the heap */
+nano_os_error_t NanoOsHeap::getRegionCount(uint32_t& region_count)
+{
+    return NANO_OS_HEAP_GetRegionCount(&region_count);
+}
+
+/** \brief Get the information on a memory region of the heap */
+nano_os_error_t NanoOsHeap::getRegionInfo(const uint32_t region_index, nano_os_heap_region_info_t& region_info)
+{
+    return NANO_OS_HEAP_GetRegionInfo(region_index, &region_info);
+}
+
 
 
 
@@ -0,0 +1,100 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../sync_objects/nano_os_blackboard.hpp"
+
+// Check if module is enabled
+#if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Default constructor */
+NanoOsBlackboard::NanoOsBlackboard()
+: m_blackboard()
+{
+}
+
+/** \brief Constructor with creation */
+NanoOsBlackboard::NanoOsBlackboard(void* const data_buffer, const size_t data_size, const nano_os_queuing_type_t queuing_type)
+: m_blackboard()
+{
+    const nano_os_error_t ret = create(data_buffer, data_size, queuing_type);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor */
+NanoOsBlackboard::~NanoOsBlackboard()
+{
+    #if (NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u)
+
+    // Destroy the blackboard
+    const nano_os_error_t ret = NANO_OS_BLACKBOARD_Destroy(&m_blackboard);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+
+    #else
+
+    // Should never happen
+    NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+
+    #endif /* (NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u) */
+}
+
+/** \brief Create the blackboard */
+nano_os_error_t NanoOsBlackboard::create(void* const data_buffer, const size_t data_size, const nano_os_queuing_type_t queuing_type)
+{
+    return NANO_OS_BLACKBOARD_Create(&m_blackboard, data_buffer, data_size, queuing_type);
+}
+
+/** \brief Publish a new value on the blackboard */
+nano_os_error_t NanoOsBlackboard::publish(const void* const data)
+{
+    return NANO_OS_BLACKBOARD_Publish(&m_blackboard, data);
+}
+
+/** \brief Read the latest value of the blackboard without locking */
+nano_os_error_t NanoOsBlackboard::read(void* const data, uint32_t& version) const
+{
+    return NANO_OS_BLACKBOARD_Read(&m_blackboard, data, &version);
+}
+
+/** \brief Wait for a value newer than the specified version on the blackboard */
+nano_os_error_t NanoOsBlackboard::wait(void* const data, uint32_t& version, const uint32_t tick_count)
+{
+    return NANO_OS_BLACKBOARD_Wait(&m_blackboard, data, &version, tick_count);
+}
+
+#if (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to the blackboard */
+nano_os_error_t NanoOsBlackboard::setName(const char* const name)
+{
+    return NANO_OS_BLACKBOARD_SetName(&m_blackboard, name);
+}
+
+#endif /* (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u) */
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_BLACKBOARD_ENABLED == 1u)
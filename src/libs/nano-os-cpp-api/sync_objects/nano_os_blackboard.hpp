@@ -0,0 +1,85 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_BLACKBOARD_HPP
+#define NANO_OS_BLACKBOARD_HPP
+
+#include "nano_os_blackboard.h"
+
+#include "nano_os_cpp_api_cfg.h"
+
+// Check if module is enabled
+#if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Nano OS blackboard */
+class NanoOsBlackboard
+{
+    public:
+
+        /** \brief Default constructor */
+        NanoOsBlackboard();
+
+        /** \brief Constructor with creation */
+        NanoOsBlackboard(void* const data_buffer, const size_t data_size, const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Destructor */
+        ~NanoOsBlackboard();
+
+
+        /** \brief Create the blackboard */
+        nano_os_error_t create(void* const data_buffer, const size_t data_size, const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Publish a new value on the blackboard */
+        nano_os_error_t publish(const void* const data);
+
+        /** \brief Read the latest value of the blackboard without locking */
+        nano_os_error_t read(void* const data, uint32_t& version) const;
+
+        /** \brief Wait for a value newer than the specified version on the blackboard */
+        nano_os_error_t wait(void* const data, uint32_t& version, const uint32_t tick_count);
+
+        #if (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u)
+
+        /** \brief Associate a name to the blackboard */
+        nano_os_error_t setName(const char* const name);
+
+        #endif /* (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u) */
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsBlackboard(const NanoOsBlackboard& copy) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Underlying blackboard object */
+        nano_os_blackboard_t m_blackboard;
+};
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_BLACKBOARD_ENABLED == 1u)
+
+#endif // NANO_OS_BLACKBOARD_HPP
@@ -0,0 +1,100 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../sync_objects/nano_os_channel.hpp"
+
+// Check if module is enabled
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Default constructor */
+NanoOsChannel::NanoOsChannel()
+: m_channel()
+{
+}
+
+/** \brief Constructor with creation */
+NanoOsChannel::NanoOsChannel(const nano_os_queuing_type_t queuing_type)
+: m_channel()
+{
+    const nano_os_error_t ret = create(queuing_type);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor */
+NanoOsChannel::~NanoOsChannel()
+{
+    #if (NANO_OS_CHANNEL_DESTROY_ENABLED == 1u)
+
+    // Destroy the channel
+    const nano_os_error_t ret = NANO_OS_CHANNEL_Destroy(&m_channel);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+
+    #else
+
+    // Should never happen
+    NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+
+    #endif /* (NANO_OS_CHANNEL_DESTROY_ENABLED == 1u) */
+}
+
+/** \brief Create the channel */
+nano_os_error_t NanoOsChannel::create(const nano_os_queuing_type_t queuing_type)
+{
+    return NANO_OS_CHANNEL_Create(&m_channel, queuing_type);
+}
+
+/** \brief Send a message on the channel and wait for the reply */
+nano_os_error_t NanoOsChannel::send(void* const buffer, const size_t size, const uint32_t tick_count)
+{
+    return NANO_OS_CHANNEL_Send(&m_channel, buffer, size, tick_count);
+}
+
+/** \brief Wait for a message on the channel */
+nano_os_error_t NanoOsChannel::receive(void*& buffer, size_t& size, const uint32_t tick_count)
+{
+    return NANO_OS_CHANNEL_Receive(&m_channel, &buffer, &size, tick_count);
+}
+
+/** \brief Reply to the message received on the channel */
+nano_os_error_t NanoOsChannel::reply()
+{
+    return NANO_OS_CHANNEL_Reply(&m_channel);
+}
+
+#if (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to the channel */
+nano_os_error_t NanoOsChannel::setName(const char* const name)
+{
+    return NANO_OS_CHANNEL_SetName(&m_channel, name);
+}
+
+#endif /* (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u) */
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_CHANNEL_ENABLED == 1u)
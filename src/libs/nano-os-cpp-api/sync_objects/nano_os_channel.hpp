@@ -0,0 +1,85 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_CHANNEL_HPP
+#define NANO_OS_CHANNEL_HPP
+
+#include "nano_os_channel.h"
+
+#include "nano_os_cpp_api_cfg.h"
+
+// Check if module is enabled
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Nano OS synchronous message passing channel */
+class NanoOsChannel
+{
+    public:
+
+        /** \brief Default constructor */
+        NanoOsChannel();
+
+        /** \brief Constructor with creation */
+        NanoOsChannel(const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Destructor */
+        ~NanoOsChannel();
+
+
+        /** \brief Create the channel */
+        nano_os_error_t create(const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Send a message on the channel and wait for the reply */
+        nano_os_error_t send(void* const buffer, const size_t size, const uint32_t tick_count);
+
+        /** \brief Wait for a message on the channel */
+        nano_os_error_t receive(void*& buffer, size_t& size, const uint32_t tick_count);
+
+        /** \brief Reply to the message received on the channel */
+        nano_os_error_t reply();
+
+        #if (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u)
+
+        /** \brief Associate a name to the channel */
+        nano_os_error_t setName(const char* const name);
+
+        #endif /* (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u) */
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsChannel(const NanoOsChannel& copy) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Underlying channel object */
+        nano_os_channel_t m_channel;
+};
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_CHANNEL_ENABLED == 1u)
+
+#endif // NANO_OS_CHANNEL_HPP
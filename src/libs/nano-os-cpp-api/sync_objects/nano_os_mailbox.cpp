@@ -71,6 +71,19 @@ nano_os_error_t NanoOsMailbox::create(const uint32_t max_mail_count,
                                   mailbox_buffer, mailbox_buffer_size, queuing_type);
 }
 
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Create the mailbox as a zero-copy mailbox */
+nano_os_error_t NanoOsMailbox::createZeroCopy(const uint32_t max_mail_count,
+                                              const size_t mail_size, void* const pool_buffer,
+                                              const size_t pool_buffer_size, const nano_os_queuing_type_t queuing_type)
+{
+    return NANO_OS_MAILBOX_CreateZeroCopy(&m_mailbox, max_mail_count, mail_size,
+                                          pool_buffer, pool_buffer_size, queuing_type);
+}
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
 /** \brief Wait for a mail in the mailbox */
 nano_os_error_t NanoOsMailbox::wait(void* const mail_buffer,
                                     const uint32_t tick_count)
@@ -84,6 +97,42 @@ nano_os_error_t NanoOsMailbox::post(void* const mail_buffer)
     return NANO_OS_MAILBOX_Post(&m_mailbox, mail_buffer);
 }
 
+#if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+
+/** \brief Post a mail in the mailbox and wait for a free mail slot if the mailbox is full */
+nano_os_error_t NanoOsMailbox::post(void* const mail_buffer, const uint32_t tick_count)
+{
+    return NANO_OS_MAILBOX_PostTimeout(&m_mailbox, mail_buffer, tick_count);
+}
+
+#endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_URGENT_ENABLED == 1u)
+
+/** \brief Post a mail at the read end of the mailbox so that it is received before the mails already in the mailbox */
+nano_os_error_t NanoOsMailbox::postUrgent(void* const mail_buffer)
+{
+    return NANO_OS_MAILBOX_PostUrgent(&m_mailbox, mail_buffer);
+}
+
+#endif /* (NANO_OS_MAILBOX_URGENT_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+
+/** \brief Split the mailbox into priority lanes */
+nano_os_error_t NanoOsMailbox::setLanes(uint32_t* const lane_counts, const uint32_t lane_count)
+{
+    return NANO_OS_MAILBOX_SetLanes(&m_mailbox, lane_counts, lane_count);
+}
+
+/** \brief Post a mail in a lane of the mailbox, the mails of the highest lanes are received first */
+nano_os_error_t NanoOsMailbox::postLane(const uint32_t lane, void* const mail_buffer)
+{
+    return NANO_OS_MAILBOX_PostLane(&m_mailbox, lane, mail_buffer);
+}
+
+#endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+
 #if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
 
 /** \brief Post a mail in the mailbox from an interrupt handler */
@@ -92,8 +141,80 @@ nano_os_error_t NanoOsMailbox::postFromIsr(void* const mail_buffer)
     return NANO_OS_MAILBOX_PostFromIsr(&m_mailbox, mail_buffer);
 }
 
+/** \brief Get the number of mails posted from interrupt handlers which have been dropped because the mailbox was full */
+nano_os_error_t NanoOsMailbox::getIsrDropCount(uint32_t& count)
+{
+    return NANO_OS_MAILBOX_GetIsrDropCount(&m_mailbox, &count);
+}
+
+#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+
+/** \brief Wait for multiple mails in the mailbox */
+nano_os_error_t NanoOsMailbox::waitMany(void* const mail_buffer, const uint32_t max_count, const bool all_or_nothing,
+                                        uint32_t& received_count, const uint32_t tick_count)
+{
+    return NANO_OS_MAILBOX_WaitMany(&m_mailbox, mail_buffer, max_count, all_or_nothing, &received_count, tick_count);
+}
+
+/** \brief Post multiple mails in the mailbox */
+nano_os_error_t NanoOsMailbox::postMany(const void* const mail_buffer, const uint32_t count, const bool all_or_nothing,
+                                        uint32_t& posted_count)
+{
+    return NANO_OS_MAILBOX_PostMany(&m_mailbox, mail_buffer, count, all_or_nothing, &posted_count);
+}
+
+#endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Acquire a free buffer from the pool of the zero-copy mailbox */
+nano_os_error_t NanoOsMailbox::acquire(void*& mail_buffer)
+{
+    return NANO_OS_MAILBOX_Acquire(&m_mailbox, &mail_buffer);
+}
+
+/** \brief Commit a previously acquired buffer into the zero-copy mailbox */
+nano_os_error_t NanoOsMailbox::commit(void* const mail_buffer)
+{
+    return NANO_OS_MAILBOX_Commit(&m_mailbox, mail_buffer);
+}
+
+#if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+
+/** \brief Commit a previously acquired buffer into the zero-copy mailbox from an interrupt handler */
+nano_os_error_t NanoOsMailbox::commitFromIsr(void* const mail_buffer)
+{
+    return NANO_OS_MAILBOX_CommitFromIsr(&m_mailbox, mail_buffer);
+}
+
 #endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
 
+/** \brief Wait for a buffer in the zero-copy mailbox */
+nano_os_error_t NanoOsMailbox::receive(void*& mail_buffer, const uint32_t tick_count)
+{
+    return NANO_OS_MAILBOX_Receive(&m_mailbox, &mail_buffer, tick_count);
+}
+
+/** \brief Give back a buffer to the pool of the zero-copy mailbox */
+nano_os_error_t NanoOsMailbox::release(void* const mail_buffer)
+{
+    return NANO_OS_MAILBOX_Release(&m_mailbox, mail_buffer);
+}
+
+#if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+/** \brief Get the number of buffers of the zero-copy mailbox held by a task (or by any task and interrupt handler if task is NULL) */
+nano_os_error_t NanoOsMailbox::getHeldBufferCount(const nano_os_task_t* const task, uint32_t& count)
+{
+    return NANO_OS_MAILBOX_GetHeldBufferCount(&m_mailbox, task, &count);
+}
+
+#endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
 #if (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u)
 
 /** \brief Get the current number of mails into the mailbox */
@@ -55,6 +55,15 @@ class NanoOsMailbox
                                const size_t mail_size, void* const mailbox_buffer,
                                const size_t mailbox_buffer_size, const nano_os_queuing_type_t queuing_type);
 
+        #if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+        /** \brief Create the mailbox as a zero-copy mailbox */
+        nano_os_error_t createZeroCopy(const uint32_t max_mail_count,
+                                       const size_t mail_size, void* const pool_buffer,
+                                       const size_t pool_buffer_size, const nano_os_queuing_type_t queuing_type);
+
+        #endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
         /** \brief Wait for a mail in the mailbox */
         nano_os_error_t wait(void* const mail_buffer,
                              const uint32_t tick_count);
@@ -62,13 +71,82 @@ class NanoOsMailbox
         /** \brief Post a mail in the mailbox */
         nano_os_error_t post(void* const mail_buffer);
 
+        #if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+
+        /** \brief Post a mail in the mailbox and wait for a free mail slot if the mailbox is full */
+        nano_os_error_t post(void* const mail_buffer, const uint32_t tick_count);
+
+        #endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
+        #if (NANO_OS_MAILBOX_URGENT_ENABLED == 1u)
+
+        /** \brief Post a mail at the read end of the mailbox so that it is received before the mails already in the mailbox */
+        nano_os_error_t postUrgent(void* const mail_buffer);
+
+        #endif /* (NANO_OS_MAILBOX_URGENT_ENABLED == 1u) */
+
+        #if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+
+        /** \brief Split the mailbox into priority lanes */
+        nano_os_error_t setLanes(uint32_t* const lane_counts, const uint32_t lane_count);
+
+        /** \brief Post a mail in a lane of the mailbox, the mails of the highest lanes are received first */
+        nano_os_error_t postLane(const uint32_t lane, void* const mail_buffer);
+
+        #endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+
         #if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
 
         /** \brief Post a mail in the mailbox from an interrupt handler */
         nano_os_error_t postFromIsr(void* const mail_buffer);
 
+        /** \brief Get the number of mails posted from interrupt handlers which have been dropped because the mailbox was full */
+        nano_os_error_t getIsrDropCount(uint32_t& count);
+
+        #endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
+        #if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+
+        /** \brief Wait for multiple mails in the mailbox */
+        nano_os_error_t waitMany(void* const mail_buffer, const uint32_t max_count, const bool all_or_nothing,
+                                 uint32_t& received_count, const uint32_t tick_count);
+
+        /** \brief Post multiple mails in the mailbox */
+        nano_os_error_t postMany(const void* const mail_buffer, const uint32_t count, const bool all_or_nothing,
+                                 uint32_t& posted_count);
+
+        #endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+        #if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+        /** \brief Acquire a free buffer from the pool of the zero-copy mailbox */
+        nano_os_error_t acquire(void*& mail_buffer);
+
+        /** \brief Commit a previously acquired buffer into the zero-copy mailbox */
+        nano_os_error_t commit(void* const mail_buffer);
+
+        #if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+
+        /** \brief Commit a previously acquired buffer into the zero-copy mailbox from an interrupt handler */
+        nano_os_error_t commitFromIsr(void* const mail_buffer);
+
         #endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
 
+        /** \brief Wait for a buffer in the zero-copy mailbox */
+        nano_os_error_t receive(void*& mail_buffer, const uint32_t tick_count);
+
+        /** \brief Give back a buffer to the pool of the zero-copy mailbox */
+        nano_os_error_t release(void* const mail_buffer);
+
+        #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+        /** \brief Get the number of buffers of the zero-copy mailbox held by a task (or by any task and interrupt handler if task is NULL) */
+        nano_os_error_t getHeldBufferCount(const nano_os_task_t* const task, uint32_t& count);
+
+        #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+        #endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
         #if (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u)
 
         /** \brief Get the current number of mails into the mailbox */
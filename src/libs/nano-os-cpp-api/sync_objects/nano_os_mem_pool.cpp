@@ -0,0 +1,116 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../sync_objects/nano_os_mem_pool.hpp"
+
+// Check if module is enabled
+#if (NANO_OS_MEM_POOL_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Default constructor */
+NanoOsMemPool::NanoOsMemPool()
+: m_mem_pool()
+{
+}
+
+/** \brief Constructor with creation */
+NanoOsMemPool::NanoOsMemPool(void* const buffer, const size_t block_size, const uint32_t block_count, const nano_os_queuing_type_t queuing_type)
+: m_mem_pool()
+{
+    const nano_os_error_t ret = create(buffer, block_size, block_count, queuing_type);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor */
+NanoOsMemPool::~NanoOsMemPool()
+{
+    #if (NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u)
+
+    // Destroy the memory pool
+    const nano_os_error_t ret = NANO_OS_MEM_POOL_Destroy(&m_mem_pool);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+
+    #else
+
+    // Should never happen
+    NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+
+    #endif /* (NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u) */
+}
+
+/** \brief Create the memory pool */
+nano_os_error_t NanoOsMemPool::create(void* const buffer, const size_t block_size, const uint32_t block_count, const nano_os_queuing_type_t queuing_type)
+{
+    return NANO_OS_MEM_POOL_Create(&m_mem_pool, buffer, block_size, block_count, queuing_type);
+}
+
+/** \brief Allocate a block, wait for a free block if the memory pool is empty */
+nano_os_error_t NanoOsMemPool::allocate(void*& block, const uint32_t tick_count)
+{
+    return NANO_OS_MEM_POOL_Allocate(&m_mem_pool, &block, tick_count);
+}
+
+/** \brief Allocate a block without waiting (can be called from an interrupt handler) */
+nano_os_error_t NanoOsMemPool::allocateFromIsr(void*& block)
+{
+    return NANO_OS_MEM_POOL_AllocateFromIsr(&m_mem_pool, &block);
+}
+
+/** \brief Free a block */
+nano_os_error_t NanoOsMemPool::free(void* const block)
+{
+    return NANO_OS_MEM_POOL_Free(&m_mem_pool, block);
+}
+
+#if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+
+/** \brief Free a block from an interrupt handler */
+nano_os_error_t NanoOsMemPool::freeFromIsr(void* const block)
+{
+    return NANO_OS_MEM_POOL_FreeFromIsr(&m_mem_pool, block);
+}
+
+#endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+
+/** \brief Get the statistics of the memory pool */
+nano_os_error_t NanoOsMemPool::getStats(nano_os_mem_pool_stats_t& stats) const
+{
+    return NANO_OS_MEM_POOL_GetStats(&m_mem_pool, &stats);
+}
+
+#if (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to the memory pool */
+nano_os_error_t NanoOsMemPool::setName(const char* const name)
+{
+    return NANO_OS_MEM_POOL_SetName(&m_mem_pool, name);
+}
+
+#endif /* (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u) */
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_MEM_POOL_ENABLED == 1u)
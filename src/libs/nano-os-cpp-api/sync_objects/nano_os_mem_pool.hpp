@@ -0,0 +1,95 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_MEM_POOL_HPP
+#define NANO_OS_MEM_POOL_HPP
+
+#include "nano_os_mem_pool.h"
+
+#include "nano_os_cpp_api_cfg.h"
+
+// Check if module is enabled
+#if (NANO_OS_MEM_POOL_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Nano OS fixed-size block memory pool */
+class NanoOsMemPool
+{
+    public:
+
+        /** \brief Default constructor */
+        NanoOsMemPool();
+
+        /** \brief Constructor with creation */
+        NanoOsMemPool(void* const buffer, const size_t block_size, const uint32_t block_count, const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Destructor */
+        ~NanoOsMemPool();
+
+
+        /** \brief Create the memory pool */
+        nano_os_error_t create(void* const buffer, const size_t block_size, const uint32_t block_count, const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Allocate a block, wait for a free block if the memory pool is empty */
+        nano_os_error_t allocate(void*& block, const uint32_t tick_count);
+
+        /** \brief Allocate a block without waiting (can be called from an interrupt handler) */
+        nano_os_error_t allocateFromIsr(void*& block);
+
+        /** \brief Free a block */
+        nano_os_error_t free(void* const block);
+
+        #if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+
+        /** \brief Free a block from an interrupt handler */
+        nano_os_error_t freeFromIsr(void* const block);
+
+        #endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+
+        /** \brief Get the statistics of the memory pool */
+        nano_os_error_t getStats(nano_os_mem_pool_stats_t& stats) const;
+
+        #if (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u)
+
+        /** \brief Associate a name to the memory pool */
+        nano_os_error_t setName(const char* const name);
+
+        #endif /* (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u) */
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsMemPool(const NanoOsMemPool& copy) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Underlying memory pool object */
+        nano_os_mem_pool_t m_mem_pool;
+};
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_MEM_POOL_ENABLED == 1u)
+
+#endif // NANO_OS_MEM_POOL_HPP
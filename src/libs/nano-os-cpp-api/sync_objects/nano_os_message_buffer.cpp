@@ -0,0 +1,112 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../sync_objects/nano_os_message_buffer.hpp"
+
+// Check if module is enabled
+#if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Default constructor */
+NanoOsMessageBuffer::NanoOsMessageBuffer()
+: m_message_buffer()
+{
+}
+
+/** \brief Constructor with creation */
+NanoOsMessageBuffer::NanoOsMessageBuffer(void* const buffer, const size_t buffer_size, const nano_os_queuing_type_t queuing_type)
+: m_message_buffer()
+{
+    const nano_os_error_t ret = create(buffer, buffer_size, queuing_type);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor */
+NanoOsMessageBuffer::~NanoOsMessageBuffer()
+{
+    #if (NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u)
+
+    // Destroy the message buffer
+    const nano_os_error_t ret = NANO_OS_MESSAGE_BUFFER_Destroy(&m_message_buffer);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+
+    #else
+
+    // Should never happen
+    NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+
+    #endif /* (NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u) */
+}
+
+/** \brief Create the message buffer */
+nano_os_error_t NanoOsMessageBuffer::create(void* const buffer, const size_t buffer_size, const nano_os_queuing_type_t queuing_type)
+{
+    return NANO_OS_MESSAGE_BUFFER_Create(&m_message_buffer, buffer, buffer_size, queuing_type);
+}
+
+/** \brief Send a message, wait for enough free space if the message buffer is full */
+nano_os_error_t NanoOsMessageBuffer::send(const void* const message, const size_t message_size, const uint32_t tick_count)
+{
+    return NANO_OS_MESSAGE_BUFFER_Send(&m_message_buffer, message, message_size, tick_count);
+}
+
+/** \brief Receive a message, wait for a message if the message buffer is empty */
+nano_os_error_t NanoOsMessageBuffer::receive(void* const message, const size_t max_message_size, size_t& message_size, const uint32_t tick_count)
+{
+    return NANO_OS_MESSAGE_BUFFER_Receive(&m_message_buffer, message, max_message_size, &message_size, tick_count);
+}
+
+/** \brief Get the size of the largest message which can be sent without waiting */
+nano_os_error_t NanoOsMessageBuffer::getFreeSize(size_t& free_size)
+{
+    return NANO_OS_MESSAGE_BUFFER_GetFreeSize(&m_message_buffer, &free_size);
+}
+
+/** \brief Get the size of the next message to receive */
+nano_os_error_t NanoOsMessageBuffer::getNextSize(size_t& message_size)
+{
+    return NANO_OS_MESSAGE_BUFFER_GetNextSize(&m_message_buffer, &message_size);
+}
+
+/** \brief Get the number of messages in the message buffer */
+nano_os_error_t NanoOsMessageBuffer::getCount(uint32_t& count)
+{
+    return NANO_OS_MESSAGE_BUFFER_GetCount(&m_message_buffer, &count);
+}
+
+#if (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to the message buffer */
+nano_os_error_t NanoOsMessageBuffer::setName(const char* const name)
+{
+    return NANO_OS_MESSAGE_BUFFER_SetName(&m_message_buffer, name);
+}
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u) */
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
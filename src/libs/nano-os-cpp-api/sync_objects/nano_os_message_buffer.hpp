@@ -0,0 +1,91 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_MESSAGE_BUFFER_HPP
+#define NANO_OS_MESSAGE_BUFFER_HPP
+
+#include "nano_os_message_buffer.h"
+
+#include "nano_os_cpp_api_cfg.h"
+
+// Check if module is enabled
+#if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Nano OS message buffer */
+class NanoOsMessageBuffer
+{
+    public:
+
+        /** \brief Default constructor */
+        NanoOsMessageBuffer();
+
+        /** \brief Constructor with creation */
+        NanoOsMessageBuffer(void* const buffer, const size_t buffer_size, const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Destructor */
+        ~NanoOsMessageBuffer();
+
+
+        /** \brief Create the message buffer */
+        nano_os_error_t create(void* const buffer, const size_t buffer_size, const nano_os_queuing_type_t queuing_type);
+
+        /** \brief Send a message, wait for enough free space if the message buffer is full */
+        nano_os_error_t send(const void* const message, const size_t message_size, const uint32_t tick_count);
+
+        /** \brief Receive a message, wait for a message if the message buffer is empty */
+        nano_os_error_t receive(void* const message, const size_t max_message_size, size_t& message_size, const uint32_t tick_count);
+
+        /** \brief Get the size of the largest message which can be sent without waiting */
+        nano_os_error_t getFreeSize(size_t& free_size);
+
+        /** \brief Get the size of the next message to receive */
+        nano_os_error_t getNextSize(size_t& message_size);
+
+        /** \brief Get the number of messages in the message buffer */
+        nano_os_error_t getCount(uint32_t& count);
+
+        #if (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u)
+
+        /** \brief Associate a name to the message buffer */
+        nano_os_error_t setName(const char* const name);
+
+        #endif /* (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u) */
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsMessageBuffer(const NanoOsMessageBuffer& copy) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Underlying message buffer object */
+        nano_os_message_buffer_t m_message_buffer;
+};
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+
+#endif // NANO_OS_MESSAGE_BUFFER_HPP
@@ -0,0 +1,134 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../sync_objects/nano_os_stream_buffer.hpp"
+
+// Check if module is enabled
+#if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Default constructor */
+NanoOsStreamBuffer::NanoOsStreamBuffer()
+: m_stream_buffer()
+{
+}
+
+/** \brief Constructor with creation */
+NanoOsStreamBuffer::NanoOsStreamBuffer(void* const buffer, const size_t buffer_size, const size_t trigger_level)
+: m_stream_buffer()
+{
+    const nano_os_error_t ret = create(buffer, buffer_size, trigger_level);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+}
+
+/** \brief Destructor */
+NanoOsStreamBuffer::~NanoOsStreamBuffer()
+{
+    #if (NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u)
+
+    // Destroy the stream buffer
+    const nano_os_error_t ret = NANO_OS_STREAM_BUFFER_Destroy(&m_stream_buffer);
+    NANO_OS_ERROR_ASSERT_RET(ret);
+
+    #else
+
+    // Should never happen
+    NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+
+    #endif /* (NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u) */
+}
+
+/** \brief Create the stream buffer */
+nano_os_error_t NanoOsStreamBuffer::create(void* const buffer, const size_t buffer_size, const size_t trigger_level)
+{
+    return NANO_OS_STREAM_BUFFER_Create(&m_stream_buffer, buffer, buffer_size, trigger_level);
+}
+
+/** \brief Change the number of bytes needed to wake up the consumer */
+nano_os_error_t NanoOsStreamBuffer::setTriggerLevel(const size_t trigger_level)
+{
+    return NANO_OS_STREAM_BUFFER_SetTriggerLevel(&m_stream_buffer, trigger_level);
+}
+
+/** \brief Write bytes into the stream buffer (producer side) */
+nano_os_error_t NanoOsStreamBuffer::write(const void* const data, const size_t size, size_t& written_size)
+{
+    return NANO_OS_STREAM_BUFFER_Write(&m_stream_buffer, data, size, &written_size);
+}
+
+#if (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u)
+
+/** \brief Write bytes into the stream buffer from an interrupt handler (producer side) */
+nano_os_error_t NanoOsStreamBuffer::writeFromIsr(const void* const data, const size_t size, size_t& written_size)
+{
+    return NANO_OS_STREAM_BUFFER_WriteFromIsr(&m_stream_buffer, data, size, &written_size);
+}
+
+#endif /* (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u) */
+
+/** \brief Read bytes from the stream buffer, wait until the trigger level is reached (consumer side) */
+nano_os_error_t NanoOsStreamBuffer::read(void* const data, const size_t size, size_t& read_size, const uint32_t tick_count)
+{
+    return NANO_OS_STREAM_BUFFER_Read(&m_stream_buffer, data, size, &read_size, tick_count);
+}
+
+/** \brief Wait until the trigger level of the stream buffer is reached (consumer side) */
+nano_os_error_t NanoOsStreamBuffer::wait(const uint32_t tick_count)
+{
+    return NANO_OS_STREAM_BUFFER_Wait(&m_stream_buffer, tick_count);
+}
+
+/** \brief Get the contiguous span of bytes available at the read end of the stream buffer (consumer side) */
+nano_os_error_t NanoOsStreamBuffer::getReadSpan(const void*& data, size_t& size)
+{
+    return NANO_OS_STREAM_BUFFER_GetReadSpan(&m_stream_buffer, &data, &size);
+}
+
+/** \brief Consume bytes previously accessed through a read span (consumer side) */
+nano_os_error_t NanoOsStreamBuffer::consume(const size_t size)
+{
+    return NANO_OS_STREAM_BUFFER_Consume(&m_stream_buffer, size);
+}
+
+/** \brief Get the number of bytes available in the stream buffer */
+nano_os_error_t NanoOsStreamBuffer::getCount(size_t& count)
+{
+    return NANO_OS_STREAM_BUFFER_GetCount(&m_stream_buffer, &count);
+}
+
+#if (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to the stream buffer */
+nano_os_error_t NanoOsStreamBuffer::setName(const char* const name)
+{
+    return NANO_OS_STREAM_BUFFER_SetName(&m_stream_buffer, name);
+}
+
+#endif /* (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u) */
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
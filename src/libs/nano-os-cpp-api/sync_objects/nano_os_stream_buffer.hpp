@@ -0,0 +1,104 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_STREAM_BUFFER_HPP
+#define NANO_OS_STREAM_BUFFER_HPP
+
+#include "nano_os_stream_buffer.h"
+
+#include "nano_os_cpp_api_cfg.h"
+
+// Check if module is enabled
+#if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+namespace NANO_OS_CPP_API_NAMESPACE
+{
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+
+/** \brief Nano OS stream buffer */
+class NanoOsStreamBuffer
+{
+    public:
+
+        /** \brief Default constructor */
+        NanoOsStreamBuffer();
+
+        /** \brief Constructor with creation */
+        NanoOsStreamBuffer(void* const buffer, const size_t buffer_size, const size_t trigger_level);
+
+        /** \brief Destructor */
+        ~NanoOsStreamBuffer();
+
+
+        /** \brief Create the stream buffer */
+        nano_os_error_t create(void* const buffer, const size_t buffer_size, const size_t trigger_level);
+
+        /** \brief Change the number of bytes needed to wake up the consumer */
+        nano_os_error_t setTriggerLevel(const size_t trigger_level);
+
+        /** \brief Write bytes into the stream buffer (producer side) */
+        nano_os_error_t write(const void* const data, const size_t size, size_t& written_size);
+
+        #if (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u)
+
+        /** \brief Write bytes into the stream buffer from an interrupt handler (producer side) */
+        nano_os_error_t writeFromIsr(const void* const data, const size_t size, size_t& written_size);
+
+        #endif /* (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u) */
+
+        /** \brief Read bytes from the stream buffer, wait until the trigger level is reached (consumer side) */
+        nano_os_error_t read(void* const data, const size_t size, size_t& read_size, const uint32_t tick_count);
+
+        /** \brief Wait until the trigger level of the stream buffer is reached (consumer side) */
+        nano_os_error_t wait(const uint32_t tick_count);
+
+        /** \brief Get the contiguous span of bytes available at the read end of the stream buffer (consumer side) */
+        nano_os_error_t getReadSpan(const void*& data, size_t& size);
+
+        /** \brief Consume bytes previously accessed through a read span (consumer side) */
+        nano_os_error_t consume(const size_t size);
+
+        /** \brief Get the number of bytes available in the stream buffer */
+        nano_os_error_t getCount(size_t& count);
+
+        #if (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u)
+
+        /** \brief Associate a name to the stream buffer */
+        nano_os_error_t setName(const char* const name);
+
+        #endif /* (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u) */
+
+    private:
+
+        /** \brief Copy constructor => forbidden */
+        NanoOsStreamBuffer(const NanoOsStreamBuffer& copy) { NANO_OS_UNUSED(copy); }
+
+        /** \brief Underlying stream buffer object */
+        nano_os_stream_buffer_t m_stream_buffer;
+};
+
+#if (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+}
+#endif // (NANO_OS_CPP_API_NAMESPACE_ENABLED == 1u)
+
+#endif // (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+
+#endif // NANO_OS_STREAM_BUFFER_HPP
@@ -69,7 +69,16 @@ nano_os_error_t NanoOsTimer::create(const TimerMethod& callback, void* const use
     // Save callback and user data
     m_callback = callback;
     m_user_data = user_data;
-    return NANO_OS_TIMER_Create(&m_timer, &NanoOsTimer::timerCallback, this);
+    return NANO_OS_TIMER_Create(&m_timer, &NanoOsTimer::timerCallback, this, NULL);
+}
+
+/** \brief Create the timer on a specific timer service */
+nano_os_error_t NanoOsTimer::create(const TimerMethod& callback, void* const user_data, nano_os_timer_service_t& service)
+{
+    // Save callback and user data
+    m_callback = callback;
+    m_user_data = user_data;
+    return NANO_OS_TIMER_Create(&m_timer, &NanoOsTimer::timerCallback, this, &service);
 }
 
 /** \brief Start the timer */
@@ -90,6 +99,34 @@ nano_os_error_t NanoOsTimer::hasElapsed(bool& has_elapsed)
     return NANO_OS_TIMER_HasElapsed(&m_timer, &has_elapsed);
 }
 
+/** \brief Set the overrun policy of the timer */
+nano_os_error_t NanoOsTimer::setOverrunPolicy(const nano_os_timer_overrun_policy_t overrun_policy)
+{
+    return NANO_OS_TIMER_SetOverrunPolicy(&m_timer, overrun_policy);
+}
+
+/** \brief Get and reset the number of periods of the timer which have been handled late or skipped */
+nano_os_error_t NanoOsTimer::getOverrunCount(uint32_t& overrun_count)
+{
+    return NANO_OS_TIMER_GetOverrunCount(&m_timer, &overrun_count);
+}
+
+/** \brief Set the slack of the timer */
+nano_os_error_t NanoOsTimer::setSlack(const uint32_t slack)
+{
+    return NANO_OS_TIMER_SetSlack(&m_timer, slack);
+}
+
+#if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+
+/** \brief Select the context in which the timer callback is called */
+nano_os_error_t NanoOsTimer::setIsrContext(const bool isr_context)
+{
+    return NANO_OS_TIMER_SetIsrContext(&m_timer, isr_context);
+}
+
+#endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
+
 
 
 /** \brief Generic timer callback */
@@ -57,6 +57,9 @@ class NanoOsTimer
         /** \brief Create the timer */
         nano_os_error_t create(const TimerMethod& callback, void* const user_data);
 
+        /** \brief Create the timer on a specific timer service */
+        nano_os_error_t create(const TimerMethod& callback, void* const user_data, nano_os_timer_service_t& service);
+
         /** \brief Start the timer */
         nano_os_error_t start(const uint32_t first_due_time, const uint32_t period);
 
@@ -66,6 +69,20 @@ class NanoOsTimer
         /** \brief Check if the timer has elapsed */
         nano_os_error_t hasElapsed(bool& has_elapsed);
 
+        /** \brief Set the overrun policy of the timer */
+        nano_os_error_t setOverrunPolicy(const nano_os_timer_overrun_policy_t overrun_policy);
+
+        /** \brief Get and reset the number of periods of the timer which have been handled late or skipped */
+        nano_os_error_t getOverrunCount(uint32_t& overrun_count);
+
+        /** \brief Set the slack of the timer (number of ticks its expiry may be delayed to be coalesced with other timers) */
+        nano_os_error_t setSlack(const uint32_t slack);
+
+        #if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+        /** \brief Select the context in which the timer callback is called (interrupt context callbacks must only use ISR safe services) */
+        nano_os_error_t setIsrContext(const bool isr_context);
+        #endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
+
 
     private:
 
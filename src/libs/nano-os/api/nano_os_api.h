@@ -20,6 +20,11 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef NANO_OS_API_H
 #define NANO_OS_API_H
 
+#include "nano_os_blackboard.h"
+#include "nano_os_channel.h"
+#include "nano_os_stream_buffer.h"
+#include "nano_os_message_buffer.h"
+#include "nano_os_mem_pool.h"
 #include "nano_os_cond_var.h"
 #include "nano_os_flag_set.h"
 #include "nano_os_mailbox.h"
@@ -29,10 +34,14 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #include "nano_os.h"
 
 #include "nano_os_task.h"
+#include "nano_os_interrupt_thread.h"
 #include "nano_os_console.h"
 #include "nano_os_heap.h"
+#include "nano_os_arena.h"
 #include "nano_os_stats.h"
 #include "nano_os_timer.h"
+#include "nano_os_hr_timer.h"
+#include "nano_os_workqueue.h"
 
 #include "nano_os_tools.h"
 
@@ -82,6 +82,32 @@ uint32_t NANO_OS_USER_SystemTimerGetTimestampInUs(void);
 
 
 
+/********************************************************************************/
+/*                        High resolution timer                                 */
+/********************************************************************************/
+
+
+/* Check if the port provides the high resolution timer */
+#if ((NANO_OS_HR_TIMER_ENABLED == 1u) && (NANO_OS_PORT_PROVIDES_HR_TIMER == 0u))
+
+/** \brief Initialize the high resolution timer (free running s counter with a one-shot compare interrupt) */
+nano_os_error_t NANO_OS_USER_HrTimerInit(const fp_nano_os_hr_timer_irq_callback_func_t hr_timer_irq_callback);
+
+/** \brief Get the current timestamp of the high resolution timer in s */
+uint32_t NANO_OS_USER_HrTimerGetTimestampInUs(void);
+
+/** \brief Trigger the high resolution timer interrupt when the specified timestamp is reached
+           (the interrupt must be triggered as soon as possible if the timestamp has already been reached) */
+void NANO_OS_USER_HrTimerSetCompare(const uint32_t timestamp_in_us);
+
+/** \brief Cancel the pending high resolution timer interrupt */
+void NANO_OS_USER_HrTimerStop(void);
+
+#endif /* ((NANO_OS_HR_TIMER_ENABLED == 1u) && (NANO_OS_PORT_PROVIDES_HR_TIMER == 0u)) */
+
+
+
+
 
 
 /********************************************************************************/
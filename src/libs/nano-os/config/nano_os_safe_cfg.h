@@ -49,6 +49,9 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #if (NANO_OS_MAX_ISR_REQUEST_COUNT <= 0u)
     #error "Number of interrupt service requests must be > 0"
 #endif /* (NANO_OS_MAX_ISR_REQUEST_COUNT <= 0u) */
+#if ((NANO_OS_MAX_ISR_REQUEST_COUNT & (NANO_OS_MAX_ISR_REQUEST_COUNT - 1u)) != 0u)
+    #error "Number of interrupt service requests must be a power of 2"
+#endif /* ((NANO_OS_MAX_ISR_REQUEST_COUNT & (NANO_OS_MAX_ISR_REQUEST_COUNT - 1u)) != 0u) */
 
 /** \brief Period in number of ticks for CPU usage measurement */
 #if (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u)
@@ -150,9 +153,89 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_MAILBOX_SetName() system call"
 #endif /* ((NANO_OS_MAILBOX_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
 
+/** \brief Enable the detection of leaked buffers of the zero-copy mailboxes */
+#if ((NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) && (NANO_OS_MAILBOX_ZEROCOPY_ENABLED != 1u))
+#error "NANO_OS_MAILBOX_ZEROCOPY_ENABLED must be enabled to use the detection of leaked mailbox buffers"
+#endif /* ((NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) && (NANO_OS_MAILBOX_ZEROCOPY_ENABLED != 1u)) */
+
+
+/*********************** Blackboard system calls *********************/
+
+
+/** \brief Enable NANO_OS_BLACKBOARD_Destroy() system call */
+#if ((NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_DESTROY_ENABLED must be enabled to use NANO_OS_BLACKBOARD_Destroy() system call"
+#endif /* ((NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_BLACKBOARD_SetName() system call */
+#if ((NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_BLACKBOARD_SetName() system call"
+#endif /* ((NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
+
+
+/*********************** Channel system calls *********************/
+
+
+/** \brief Enable NANO_OS_CHANNEL_Destroy() system call */
+#if ((NANO_OS_CHANNEL_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_DESTROY_ENABLED must be enabled to use NANO_OS_CHANNEL_Destroy() system call"
+#endif /* ((NANO_OS_CHANNEL_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_CHANNEL_SetName() system call */
+#if ((NANO_OS_CHANNEL_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_CHANNEL_SetName() system call"
+#endif /* ((NANO_OS_CHANNEL_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
+
+
+/*********************** Stream buffer system calls *********************/
+
+
+/** \brief Enable NANO_OS_STREAM_BUFFER_Destroy() system call */
+#if ((NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_DESTROY_ENABLED must be enabled to use NANO_OS_STREAM_BUFFER_Destroy() system call"
+#endif /* ((NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_STREAM_BUFFER_SetName() system call */
+#if ((NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_STREAM_BUFFER_SetName() system call"
+#endif /* ((NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
+
+
+/*********************** Message buffer system calls *********************/
+
+
+/** \brief Enable NANO_OS_MESSAGE_BUFFER_Destroy() system call */
+#if ((NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_DESTROY_ENABLED must be enabled to use NANO_OS_MESSAGE_BUFFER_Destroy() system call"
+#endif /* ((NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_MESSAGE_BUFFER_SetName() system call */
+#if ((NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_MESSAGE_BUFFER_SetName() system call"
+#endif /* ((NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
+
+
+/*********************** Memory pool system calls *********************/
+
+
+/** \brief Enable NANO_OS_MEM_POOL_Destroy() system call */
+#if ((NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_DESTROY_ENABLED must be enabled to use NANO_OS_MEM_POOL_Destroy() system call"
+#endif /* ((NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_MEM_POOL_SetName() system call */
+#if ((NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_MEM_POOL_SetName() system call"
+#endif /* ((NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
+
 
 /*************************** Timer system calls *************************/
 
+/** \brief Size of the timer wheel */
+#if ((NANO_OS_TIMER_ENABLED == 1u) && ((NANO_OS_TIMER_WHEEL_SLOT_BITS == 0u) || (NANO_OS_TIMER_WHEEL_LEVEL_COUNT == 0u) || \
+                                      ((NANO_OS_TIMER_WHEEL_SLOT_BITS * NANO_OS_TIMER_WHEEL_LEVEL_COUNT) > 32u)))
+#error "The timer wheel must have at least 1 level of 2 slots and cover at most 2^32 ticks"
+#endif /* ((NANO_OS_TIMER_ENABLED == 1u) && (...)) */
 
 /*************************** Waitable timer system calls  *************************/
 
@@ -196,6 +279,41 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #error "Console module must be enabled to use heap console commands"
 #endif /* ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_CONSOLE_CMD_ENABLED == 1u) && (NANO_OS_CONSOLE_ENABLED != 1u)) */
 
+/** \brief Configuration of the TLSF allocator */
+#if ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_TLSF_ENABLED == 1u) && \
+     ((NANO_OS_HEAP_TLSF_SL_INDEX_BITS > 5u) || (NANO_OS_HEAP_TLSF_MAX_SIZE_BITS > 31u) || \
+      (NANO_OS_HEAP_TLSF_MAX_SIZE_BITS <= (NANO_OS_HEAP_TLSF_SL_INDEX_BITS + 2u))))
+#error "Invalid TLSF allocator configuration : NANO_OS_HEAP_TLSF_SL_INDEX_BITS must be <= 5 and NANO_OS_HEAP_TLSF_MAX_SIZE_BITS must be <= 31 and > NANO_OS_HEAP_TLSF_SL_INDEX_BITS + 2"
+#endif /* ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_TLSF_ENABLED == 1u) && (...)) */
+
+/** \brief Number of memory regions of the heap */
+#if ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_MAX_REGION_COUNT < 1u))
+#error "The heap must have at least 1 memory region"
+#endif /* ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_MAX_REGION_COUNT < 1u)) */
+
+/** \brief Enable the size class caches of the heap */
+#if ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_CACHE_ENABLED == 1u) && ((NANO_OS_HEAP_FREE_ENABLED != 1u) || (NANO_OS_HEAP_CACHE_CLASS_COUNT < 1u)))
+#error "NANO_OS_HEAP_Free() system call must be enabled and at least 1 size class must be defined to use the heap caches"
+#endif /* ((NANO_OS_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_CACHE_ENABLED == 1u) && (...)) */
+
+
+/*************************** Arena module *************************/
+
+/** \brief Enable the arena module */
+#if ((NANO_OS_ARENA_ENABLED == 1u) && (NANO_OS_MODULES_ENABLED != 1u))
+#error "Nano OS modules must be enabled to use arena module"
+#endif /* ((NANO_OS_ARENA_ENABLED == 1u) && (NANO_OS_MODULES_ENABLED != 1u)) */
+
+/** \brief Alignment of the arena allocations */
+#if ((NANO_OS_ARENA_ENABLED == 1u) && ((NANO_OS_ARENA_ALIGNMENT == 0u) || ((NANO_OS_ARENA_ALIGNMENT & (NANO_OS_ARENA_ALIGNMENT - 1u)) != 0u)))
+#error "NANO_OS_ARENA_ALIGNMENT must be a power of 2"
+#endif /* ((NANO_OS_ARENA_ENABLED == 1u) && (...)) */
+
+/** \brief Enable NANO_OS_ARENA_CreateFromHeap() system call */
+#if ((NANO_OS_ARENA_ENABLED == 1u) && (NANO_OS_ARENA_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_ENABLED != 1u))
+#error "Heap module must be enabled to use NANO_OS_ARENA_CreateFromHeap() system call"
+#endif /* ((NANO_OS_ARENA_ENABLED == 1u) && (NANO_OS_ARENA_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_ENABLED != 1u)) */
+
 
 /*********************** Statistics module *********************/
 
@@ -213,6 +331,34 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #error "NANO_OS_STATS_GetMemoryStats() system call must be enabled to use 'memstats' console commands"
 #endif /* ((NANO_OS_CONSOLE_ENABLED == 1u) && (NANO_OS_STATS_MEMSTATS_CMD_ENABLED == 1u) && (NANO_OS_STATS_GETMEMORYSTATS_ENABLED != 1u)) */
 
+/** \brief Enable NANO_OS_STATS_GetTimerStats() system call */
+#if ((NANO_OS_STATS_GETTIMERSTATS_ENABLED == 1u) && (NANO_OS_TIMER_ENABLED != 1u))
+#error "Timer objects must be enabled to use NANO_OS_STATS_GetTimerStats() system call"
+#endif /* ((NANO_OS_STATS_GETTIMERSTATS_ENABLED == 1u) && (NANO_OS_TIMER_ENABLED != 1u)) */
+
+/** \brief Enable the 'timerstats' statistics command in Nano OS console module */
+#if ((NANO_OS_CONSOLE_ENABLED == 1u) && (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u) && (NANO_OS_STATS_GETTIMERSTATS_ENABLED != 1u))
+#error "NANO_OS_STATS_GetTimerStats() system call must be enabled to use 'timerstats' console commands"
+#endif /* ((NANO_OS_CONSOLE_ENABLED == 1u) && (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u) && (NANO_OS_STATS_GETTIMERSTATS_ENABLED != 1u)) */
+
+
+/*********************** Work queue module *********************/
+
+/** \brief Enable the work queue module */
+#if ((NANO_OS_WORKQUEUE_ENABLED == 1u) && (NANO_OS_MODULES_ENABLED != 1u))
+#error "Nano OS modules must be enabled to use work queue module"
+#endif /* ((NANO_OS_WORKQUEUE_ENABLED == 1u) && (NANO_OS_MODULES_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_WORKQUEUE_QueueDelayed() system call */
+#if ((NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) && (NANO_OS_TIMER_ENABLED != 1u))
+#error "Timer module must be enabled to use NANO_OS_WORKQUEUE_QueueDelayed() system call"
+#endif /* ((NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) && (NANO_OS_TIMER_ENABLED != 1u)) */
+
+/** \brief Enable NANO_OS_WORKQUEUE_SetName() system call */
+#if ((NANO_OS_WORKQUEUE_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u))
+#error "NANO_OS_WAIT_OBJECT_NAME_ENABLED must be enabled to use NANO_OS_WORKQUEUE_SetName() system call"
+#endif /* ((NANO_OS_WORKQUEUE_SETNAME_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_NAME_ENABLED != 1u)) */
+
 
 /*********************** Console module *********************/
 
@@ -236,6 +382,11 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #error "Nano OS modules must be enabled to use debug module"
 #endif /* ((NANO_OS_DEBUG_ENABLED == 1u) && (NANO_OS_MODULES_ENABLED != 1u)) */
 
+/** \brief Enable the heap related requests */
+#if ((NANO_OS_DEBUG_ENABLED == 1u) && (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u) && ((NANO_OS_HEAP_ENABLED != 1u) || (NANO_OS_HEAP_GETSTATS_ENABLED != 1u)))
+#error "Heap module and NANO_OS_HEAP_GetStats() system call must be enabled to use the heap requests of the debug module"
+#endif /* ((NANO_OS_DEBUG_ENABLED == 1u) && (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u) && (...)) */
+
 
 
 #endif /* NANO_OS_SAFE_CFG_H */
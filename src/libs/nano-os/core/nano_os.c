@@ -39,6 +39,9 @@ static void NANO_OS_ComputeCpuUsage(void);
 /** \brief Idle task */
 static void* NANO_OS_IdleTask(void* param);
 
+/** \brief Handle the ticks which have not been handled yet */
+static nano_os_error_t NANO_OS_HandleTicks(void* const object, const uint32_t tick_count, const uint32_t unused);
+
 
 #if (NANO_OS_SEGGER_GDB_RTOS_PLUGIN_ENABLED == 1u)
 /** \brief Initialize debug informations for Segger GDB RTOS plugin */
@@ -71,6 +74,9 @@ nano_os_error_t NANO_OS_Init(void)
     NANO_OS_InitSeggerGdbRtosPluginInfos();
     #endif /* (NANO_OS_SEGGER_GDB_RTOS_PLUGIN_ENABLED == 1u) */
 
+    /* Init tick debt request */
+    (void)NANO_OS_INTERRUPT_InitCoalescedRequest(&g_nano_os.tick_request, NANO_OS_HandleTicks, NULL);
+
     /* Port specific initialization */
     ret = NANO_OS_PORT_Init(&port_init_data);
     if (ret == NOS_ERR_SUCCESS)
@@ -97,6 +103,14 @@ nano_os_error_t NANO_OS_Init(void)
         }
         #endif /* (NANO_OS_TIMER_ENABLED == 1u) */
 
+        #if (NANO_OS_HR_TIMER_ENABLED == 1u)
+        /* Initialize the high resolution timer module */
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            ret = NANO_OS_HR_TIMER_Init();
+        }
+        #endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
+
         #if (NANO_OS_MODULES_ENABLED == 1u)
         /* Initialize the external modules */
         if (ret == NOS_ERR_SUCCESS)
@@ -199,39 +213,18 @@ void NANO_OS_TickInterrupt(void)
     }
     #endif /* (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u) */
 
-    /* Handle timers */
-    #if (NANO_OS_TIMER_ENABLED == 1u)
-    if (NANO_OS_PORT_ATOMIC_READ32(g_nano_os.lock_count) == 0u)
-    {
-        NANO_OS_TIMER_TickHandler();
-    }
-    else
-    {
-        /* Fill interrupt service request to wake up tasks */
-        nano_os_isr_service_request_t request;
-        request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_TIMER_TickHandler);
-
-        /* Queue request */
-        ret = NANO_OS_INTERRUPT_QueueRequest(&request);
-        NANO_OS_ERROR_ASSERT_RET(ret);
-    }
-    #endif /* (NANO_OS_TIMER_ENABLED == 1u) */
-
-    /* Handle suspent tasks */
-    if (NANO_OS_PORT_ATOMIC_READ32(g_nano_os.lock_count) == 0u)
+    /* Handle the tick immediately if scheduling is not locked and no previous tick is pending,
+       otherwise defer it to the interrupt service request task which will catch up the tick debt */
+    if ((NANO_OS_PORT_ATOMIC_READ32(g_nano_os.lock_count) == 0u) &&
+        ((g_nano_os.handled_tick_count + 1u) == g_nano_os.tick_count))
     {
-        NANO_OS_SCHEDULER_HandleSuspentTasks();
+        ret = NANO_OS_HandleTicks(NULL, 1u, 0u);
     }
     else
     {
-        /* Fill interrupt service request to wake up tasks */
-        nano_os_isr_service_request_t request;
-        request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_SCHEDULER_HandleSuspentTasks);
-
-        /* Queue request */
-        ret = NANO_OS_INTERRUPT_QueueRequest(&request);
-        NANO_OS_ERROR_ASSERT_RET(ret);
+        ret = NANO_OS_INTERRUPT_QueueCoalescedRequest(&g_nano_os.tick_request);
     }
+    NANO_OS_ERROR_ASSERT_RET(ret);
 
     #if (NANO_OS_TICK_CALLBACK_ENABLED == 1u)
     /* User callback */
@@ -268,6 +261,44 @@ static void NANO_OS_ComputeCpuUsage(void)
 #endif /* (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u) */
 
 
+/** \brief Handle the ticks which have not been handled yet */
+static nano_os_error_t NANO_OS_HandleTicks(void* const object, const uint32_t tick_count, const uint32_t unused)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+    bool tick_handled = false;
+    NANO_OS_UNUSED(object);
+    NANO_OS_UNUSED(tick_count);
+    NANO_OS_UNUSED(unused);
+
+    /* Lock scheduling so that the tick interrupt keeps deferring the new ticks until the debt is paid */
+    NANO_OS_PORT_ATOMIC_INC32(g_nano_os.lock_count);
+
+    /* Handle suspent tasks for each missed tick, in order, the number of
+       queued occurrences is not needed since the debt is given by the tick counters */
+    while ((ret == NOS_ERR_SUCCESS) && (g_nano_os.handled_tick_count != NANO_OS_PORT_ATOMIC_READ32(g_nano_os.tick_count)))
+    {
+        g_nano_os.handled_tick_count++;
+        ret = NANO_OS_SCHEDULER_HandleSuspentTasks(g_nano_os.handled_tick_count);
+        tick_handled = true;
+    }
+
+    #if (NANO_OS_TIMER_ENABLED == 1u)
+    /* Handle timers only once, the timer wheel catches up all the ticks handled since its last call */
+    if ((ret == NOS_ERR_SUCCESS) && tick_handled)
+    {
+        ret = NANO_OS_TIMER_TickHandler();
+    }
+    #else
+    NANO_OS_UNUSED(tick_handled);
+    #endif /* (NANO_OS_TIMER_ENABLED == 1u) */
+
+    /* Unlock scheduling */
+    NANO_OS_PORT_ATOMIC_DEC32(g_nano_os.lock_count);
+
+    return ret;
+}
+
+
 /** \brief Idle task */
 static void* NANO_OS_IdleTask(void* param)
 {
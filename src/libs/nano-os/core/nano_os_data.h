@@ -23,6 +23,7 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #include "nano_os_interrupt.h"
 #include "nano_os_task.h"
 #include "nano_os_timer.h"
+#include "nano_os_hr_timer.h"
 
 
 
@@ -79,13 +80,19 @@ typedef struct _nano_os_t
 
 
     /** \brief Interrupt service requests */
-    nano_os_isr_service_request_t isr_requests[NANO_OS_MAX_ISR_REQUEST_COUNT];
-    /** \brief Current service request count */
-    uint8_t isr_request_count;
-    /** \brief Service request read pointer */
-    nano_os_isr_service_request_t* isr_request_read;
-    /** \brief Service request write pointer */
-    nano_os_isr_service_request_t* isr_request_write;
+    nano_os_isr_request_slot_t isr_requests[NANO_OS_MAX_ISR_REQUEST_COUNT];
+    /** \brief Service request write index (shared by the interrupt handlers) */
+    volatile uint32_t isr_request_write_index;
+    /** \brief Service request read index (ISR request task only) */
+    volatile uint32_t isr_request_read_index;
+    /** \brief Pending coalescing service requests */
+    nano_os_isr_coalesced_request_t* volatile isr_coalesced_requests;
+    /** \brief Service request statistics */
+    nano_os_isr_request_stats_t isr_request_stats;
+    /** \brief Coalescing service request to handle the ticks which have been deferred */
+    nano_os_isr_coalesced_request_t tick_request;
+    /** \brief Last tick count handled by the scheduler */
+    uint32_t handled_tick_count;
     /** \brief ISR request task context */
     nano_os_task_t isr_request_task;
     #if (NANO_OS_PORT_PROVIDES_STACKS == 1u)
@@ -136,12 +143,10 @@ typedef struct _nano_os_t
 
 
     #if (NANO_OS_TIMER_ENABLED == 1)
-    /** \brief List of started timers */
-    nano_os_timer_t* started_timers;
-    /** \brief Wait object to signal the timer task */
-    nano_os_wait_object_t timer_task_wait_object;
-    /** \brief Timer task context */
-    nano_os_task_t timer_task;
+    /** \brief Wheel of started timers */
+    nano_os_timer_wheel_t timer_wheel;
+    /** \brief Default timer service */
+    nano_os_timer_service_t timer_service;
     #if (NANO_OS_PORT_PROVIDES_STACKS == 1u)
     /** \brief Timer task stack */
     nano_os_stack_t* timer_task_stack;
@@ -151,6 +156,11 @@ typedef struct _nano_os_t
     #endif /* (NANO_OS_PORT_PROVIDES_STACKS == 1u) */
     #endif /* (NANO_OS_TIMER_ENABLED == 1) */
 
+    #if (NANO_OS_HR_TIMER_ENABLED == 1u)
+    /** \brief Queue of started high resolution timers, sorted by timeout */
+    nano_os_hr_timer_t* hr_timers;
+    #endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
+
 
     #if (NANO_OS_TASK_ID_ENABLED == 1u)
     /** \brief Next object id to assign */
@@ -72,7 +72,7 @@ typedef enum _nano_os_error_t
 	NOS_ERR_TIMER_STARTED = 15,
 	/** \brief Timer is already stopped */
     NOS_ERR_TIMER_STOPPED = 16,
-    /** \brief Timer task potentially overrun */
+    /** \brief Deprecated, reserved value which is not returned anymore (timer task overload is reported by the timer statistics) */
     NOS_ERR_TIMER_TASK_OVERRUN = 17,
     /** \brief Heap memory is corrupted */
     NOS_ERR_CORRUPTED_HEAP = 18,
@@ -89,7 +89,35 @@ typedef enum _nano_os_error_t
     /** \brief MPU region start address alignment is invalid */
     NOS_ERR_MPU_REGION_ALIGNMENT = 24,
     /** \brief MPU region attribute is invalid */
-    NOS_ERR_MPU_REGION_ATTRIBUTE = 25
+    NOS_ERR_MPU_REGION_ATTRIBUTE = 25,
+    /** \brief Blackboard is being published */
+    NOS_ERR_BLACKBOARD_BUSY = 26,
+    /** \brief The message previously received on a channel has not been replied */
+    NOS_ERR_CHANNEL_REPLY_PENDING = 27,
+    /** \brief No message has been received on the channel */
+    NOS_ERR_CHANNEL_NO_CLIENT = 28,
+    /** \brief No more free buffers in the pool of a zero-copy mailbox */
+    NOS_ERR_MAILBOX_NO_BUFFER = 29,
+    /** \brief Buffer does not belong to the zero-copy mailbox or is not in the expected state */
+    NOS_ERR_MAILBOX_INVALID_BUFFER = 30,
+    /** \brief Buffers of a zero-copy mailbox are still held by tasks */
+    NOS_ERR_MAILBOX_BUFFER_LEAK = 31,
+    /** \brief Stream buffer is full */
+    NOS_ERR_STREAM_BUFFER_FULL = 32,
+    /** \brief Not enough free space in the message buffer to store the message */
+    NOS_ERR_MESSAGE_BUFFER_FULL = 33,
+    /** \brief Receive buffer is too small to store the next message of the message buffer */
+    NOS_ERR_MESSAGE_BUFFER_TOO_SMALL = 34,
+    /** \brief Work is already pending in a work queue */
+    NOS_ERR_WORK_PENDING = 35,
+    /** \brief Work is not pending in a work queue */
+    NOS_ERR_WORK_NOT_PENDING = 36,
+    /** \brief OS called from an interrupt handler with a priority higher than the max syscall interrupt priority */
+    NOS_ERR_INVALID_INTERRUPT_PRIORITY = 37,
+    /** \brief No more free blocks in the memory pool */
+    NOS_ERR_MEM_POOL_EMPTY = 38,
+    /** \brief Block does not belong to the memory pool or is already free */
+    NOS_ERR_MEM_POOL_INVALID_BLOCK = 39
 } nano_os_error_t;
 
 
@@ -0,0 +1,359 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_hr_timer.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_HR_TIMER_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+
+/** \brief High resolution timer interrupt handler */
+static void NANO_OS_HR_TIMER_InterruptHandler(void);
+
+/** \brief Insert a timer in the started timer queue according to its timeout (interrupts must be disabled) */
+static void NANO_OS_HR_TIMER_Queue(nano_os_hr_timer_t* const timer);
+
+/** \brief Program the hardware timer on the first timer to elapse (interrupts must be disabled) */
+static void NANO_OS_HR_TIMER_Program(void);
+
+
+
+
+/** \brief Initialize the high resolution timer module */
+nano_os_error_t NANO_OS_HR_TIMER_Init(void)
+{
+    /* Empty started timer queue */
+    g_nano_os.hr_timers = NULL;
+
+    /* Initialize the hardware timer */
+    return NANO_OS_PORT_HrTimerInit(NANO_OS_HR_TIMER_InterruptHandler);
+}
+
+
+/** \brief Create a new high resolution timer */
+nano_os_error_t NANO_OS_HR_TIMER_Create(nano_os_hr_timer_t* const timer, const fp_nano_os_hr_timer_callback_func_t callback, void* const user_data)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (timer != NULL)
+    {
+        /* 0 init of the timer */
+        (void)MEMSET(timer, 0, sizeof(nano_os_hr_timer_t));
+
+        /* Save callback and user data */
+        timer->callback = callback;
+        timer->user_data = user_data;
+
+        #if (NANO_OS_TRACE_ENABLED == 1u)
+        /* Global object id */
+        timer->object_id = g_nano_os.next_object_id;
+        g_nano_os.next_object_id++;
+        #endif /* (NANO_OS_TRACE_ENABLED == 1u) */
+
+        /* Real time trace event */
+        NANO_OS_TRACE_ADD(NOS_TRACE_OBJ_CREATE, timer->object_id);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_HR_TIMER_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a high resolution timer */
+nano_os_error_t NANO_OS_HR_TIMER_Destroy(nano_os_hr_timer_t* const timer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if (timer != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_ADD(NOS_TRACE_OBJ_DESTROY, timer->object_id);
+
+        /* Stop the timer if needed */
+        (void)NANO_OS_HR_TIMER_Stop(timer);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_HR_TIMER_DESTROY_ENABLED == 1u) */
+
+
+/** \brief Start a high resolution timer (due time and period in s) */
+nano_os_error_t NANO_OS_HR_TIMER_Start(nano_os_hr_timer_t* const timer, const uint32_t first_due_time, const uint32_t period)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((timer != NULL) && (first_due_time != 0u) &&
+        (first_due_time <= NANO_OS_HR_TIMER_MAX_DELAY) && (period <= NANO_OS_HR_TIMER_MAX_DELAY))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_ADD(NOS_TRACE_HR_TIMER_START, timer->object_id);
+
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+        /* Check if the timer is already started */
+        if (!timer->started)
+        {
+            /* Configure timer */
+            timer->started = true;
+            timer->has_elapsed = false;
+            timer->period = period;
+            timer->timeout = NANO_OS_PORT_HrTimerGetTimestampInUs() + first_due_time;
+
+            /* Add timer to the started timer queue, the hardware
+               timer must be reprogrammed if it is the first to elapse */
+            NANO_OS_HR_TIMER_Queue(timer);
+            if (g_nano_os.hr_timers == timer)
+            {
+                NANO_OS_HR_TIMER_Program();
+            }
+
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            ret = NOS_ERR_TIMER_STARTED;
+        }
+
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Stop a high resolution timer */
+nano_os_error_t NANO_OS_HR_TIMER_Stop(nano_os_hr_timer_t* const timer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if (timer != NULL)
+    {
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_ADD(NOS_TRACE_HR_TIMER_STOP, timer->object_id);
+
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+        /* Check if the timer is already started */
+        if (timer->started)
+        {
+            /* Remove timer from the started timer queue */
+            if (g_nano_os.hr_timers == timer)
+            {
+                g_nano_os.hr_timers = timer->next;
+                NANO_OS_HR_TIMER_Program();
+            }
+            else
+            {
+                nano_os_hr_timer_t* previous = g_nano_os.hr_timers;
+                while ((previous != NULL) && (previous->next != timer))
+                {
+                    previous = previous->next;
+                }
+                if (previous != NULL)
+                {
+                    previous->next = timer->next;
+                }
+            }
+
+            /* Update timer state */
+            timer->next = NULL;
+            timer->started = false;
+            timer->period = 0u;
+            timer->has_elapsed = false;
+
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            ret = NOS_ERR_TIMER_STOPPED;
+        }
+
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Check if a high resolution timer has elapsed */
+nano_os_error_t NANO_OS_HR_TIMER_HasElapsed(nano_os_hr_timer_t* const timer, bool* const has_elapsed)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((timer != NULL) && (has_elapsed != NULL))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Copy and reset elapsed state */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        (*has_elapsed) = timer->has_elapsed;
+        timer->has_elapsed = false;
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief High resolution timer interrupt handler */
+static void NANO_OS_HR_TIMER_InterruptHandler(void)
+{
+    nano_os_int_status_reg_t int_status_reg;
+    nano_os_hr_timer_t* timer;
+
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+    /* Handle all the elapsed timers, in timeout order */
+    timer = g_nano_os.hr_timers;
+    while ((timer != NULL) && (NANO_OS_CAST(int32_t, timer->timeout - NANO_OS_PORT_HrTimerGetTimestampInUs()) <= 0))
+    {
+        /* Remove timer from the started timer queue */
+        g_nano_os.hr_timers = timer->next;
+        timer->next = NULL;
+
+        /* Update timer state */
+        timer->has_elapsed = true;
+
+        /* Requeue timer if periodic, before calling the callback so that the callback is allowed
+           to stop it, the next timeout is computed from the previous one to avoid any drift */
+        if (timer->period != 0u)
+        {
+            timer->timeout += timer->period;
+            NANO_OS_HR_TIMER_Queue(timer);
+        }
+        else
+        {
+            timer->started = false;
+        }
+
+        /* Call user callback function if any, with interrupts enabled */
+        if (timer->callback != NULL)
+        {
+            NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+            timer->callback(timer, timer->user_data);
+            NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        }
+
+        /* Next timer */
+        timer = g_nano_os.hr_timers;
+    }
+
+    /* Program the next timeout */
+    NANO_OS_HR_TIMER_Program();
+
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+}
+
+
+/** \brief Insert a timer in the started timer queue according to its timeout (interrupts must be disabled) */
+static void NANO_OS_HR_TIMER_Queue(nano_os_hr_timer_t* const timer)
+{
+    nano_os_hr_timer_t* previous = NULL;
+    nano_os_hr_timer_t* current = g_nano_os.hr_timers;
+
+    /* Look for the first timer elapsing after this one, timers with
+       the same timeout elapse in the order they have been queued */
+    while ((current != NULL) && (NANO_OS_CAST(int32_t, timer->timeout - current->timeout) >= 0))
+    {
+        previous = current;
+        current = current->next;
+    }
+
+    /* Insert timer */
+    timer->next = current;
+    if (previous != NULL)
+    {
+        previous->next = timer;
+    }
+    else
+    {
+        g_nano_os.hr_timers = timer;
+    }
+}
+
+
+/** \brief Program the hardware timer on the first timer to elapse (interrupts must be disabled) */
+static void NANO_OS_HR_TIMER_Program(void)
+{
+    if (g_nano_os.hr_timers != NULL)
+    {
+        NANO_OS_PORT_HrTimerSetCompare(g_nano_os.hr_timers->timeout);
+    }
+    else
+    {
+        NANO_OS_PORT_HrTimerStop();
+    }
+}
+
+
+#endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
@@ -0,0 +1,106 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_HR_TIMER_H
+#define NANO_OS_HR_TIMER_H
+
+#include "nano_os_types.h"
+#include "nano_os_port.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_HR_TIMER_ENABLED == 1u)
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Maximum due time and period of a high resolution timer in s */
+#define NANO_OS_HR_TIMER_MAX_DELAY      0x7FFFFFFFu
+
+
+/** \brief Nano OS high resolution timer pre-declaration */
+struct _nano_os_hr_timer_t;
+
+
+/** \brief Nano OS high resolution timer callback function */
+typedef void (*fp_nano_os_hr_timer_callback_func_t)(struct _nano_os_hr_timer_t* const timer, void* const user_data);
+
+
+/** \brief Nano OS high resolution timer
+ *         Works as a timer but with a s resolution, its callback is called from the high resolution
+ *         timer interrupt and must only use the system calls allowed in interrupt handlers
+ */
+typedef struct _nano_os_hr_timer_t
+{
+    /** \brief Period in s */
+    uint32_t period;
+    /** \brief Timeout timestamp in s */
+    uint32_t timeout;
+    /** \brief Callback */
+    fp_nano_os_hr_timer_callback_func_t callback;
+    /** \brief User data */
+    void* user_data;
+    /** \brief Next timer in the started timer queue */
+    struct _nano_os_hr_timer_t* next;
+    /** \brief Indicate if the timer is started */
+    bool started;
+    /** \brief Indicate if the timer has elapsed */
+    bool has_elapsed;
+
+    #if (NANO_OS_TRACE_ENABLED == 1u)
+    /** \brief Global object id affected by Nano-OS */
+    uint16_t object_id;
+    #endif /* (NANO_OS_TRACE_ENABLED == 1u) */
+} nano_os_hr_timer_t;
+
+
+
+/** \brief Initialize the high resolution timer module */
+nano_os_error_t NANO_OS_HR_TIMER_Init(void);
+
+/** \brief Create a new high resolution timer */
+nano_os_error_t NANO_OS_HR_TIMER_Create(nano_os_hr_timer_t* const timer, const fp_nano_os_hr_timer_callback_func_t callback, void* const user_data);
+
+#if (NANO_OS_HR_TIMER_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a high resolution timer */
+nano_os_error_t NANO_OS_HR_TIMER_Destroy(nano_os_hr_timer_t* const timer);
+
+#endif /* (NANO_OS_HR_TIMER_DESTROY_ENABLED == 1u) */
+
+/** \brief Start a high resolution timer (due time and period in s) */
+nano_os_error_t NANO_OS_HR_TIMER_Start(nano_os_hr_timer_t* const timer, const uint32_t first_due_time, const uint32_t period);
+
+/** \brief Stop a high resolution timer */
+nano_os_error_t NANO_OS_HR_TIMER_Stop(nano_os_hr_timer_t* const timer);
+
+/** \brief Check if a high resolution timer has elapsed */
+nano_os_error_t NANO_OS_HR_TIMER_HasElapsed(nano_os_hr_timer_t* const timer, bool* const has_elapsed);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
+
+#endif /* NANO_OS_HR_TIMER_H */
@@ -27,18 +27,34 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Interrupt service request task */
 static void* NANO_OS_INTERRUPT_ServiceTask(void* const param);
 
+/** \brief Signal the interrupt service request task */
+static nano_os_error_t NANO_OS_INTERRUPT_SignalServiceTask(void);
+
+/** \brief Check if an interrupt service request is pending */
+static bool NANO_OS_INTERRUPT_IsRequestPending(void);
+
+/** \brief Get the next interrupt service request from the queue */
+static bool NANO_OS_INTERRUPT_PopRequest(nano_os_isr_service_request_t* const isr_request);
+
+/** \brief Handle the error returned by an interrupt service request */
+static void NANO_OS_INTERRUPT_HandleRequestError(const nano_os_isr_service_request_t* const isr_request, const nano_os_error_t error);
 
 
 /** \brief Initialize the interrupt service module */
 nano_os_error_t NANO_OS_INTERRUPT_Init(const nano_os_port_init_data_t* const port_init_data)
 {
     nano_os_error_t ret;
+    uint32_t i;
     nano_os_task_init_data_t task_init_data;
 
-    /* Initialize request list */
-    g_nano_os.isr_request_count = 0u;
-    g_nano_os.isr_request_read = g_nano_os.isr_requests;
-    g_nano_os.isr_request_write = g_nano_os.isr_requests;
+    /* Initialize request list, each slot expects the write index of its first round */
+    for (i = 0u; i < NANO_OS_MAX_ISR_REQUEST_COUNT; i++)
+    {
+        g_nano_os.isr_requests[i].sequence = i;
+    }
+    g_nano_os.isr_request_write_index = 0u;
+    g_nano_os.isr_request_read_index = 0u;
+    g_nano_os.isr_coalesced_requests = NULL;
 
     /* Create service request task */
     (void)MEMSET(&task_init_data, 0, sizeof(nano_os_task_init_data_t));
@@ -73,45 +89,192 @@ nano_os_error_t NANO_OS_INTERRUPT_QueueRequest(nano_os_isr_service_request_t* co
     /* Check parameters */
     if (isr_request != NULL)
     {
-        /* Disable interrupts */
-        nano_os_int_status_reg_t int_status_reg;
-        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        uint32_t position;
+        nano_os_isr_request_slot_t* slot = NULL;
+
+        /* Reserve a slot, the compare and swap on the write index arbitrates
+           between nested interrupt handlers queuing a request at the same time */
+        ret = NOS_ERR_SUCCESS;
+        do
+        {
+            int32_t diff;
+
+            position = NANO_OS_PORT_ATOMIC_READ32(g_nano_os.isr_request_write_index);
+            slot = &g_nano_os.isr_requests[position & (NANO_OS_MAX_ISR_REQUEST_COUNT - 1u)];
+            diff = NANO_OS_CAST(int32_t, slot->sequence - position);
+            if (diff == 0)
+            {
+                /* Slot is free, try to take it */
+                if (!NANO_OS_PORT_ATOMIC_CAS32(g_nano_os.isr_request_write_index, position, position + 1u))
+                {
+                    slot = NULL;
+                }
+            }
+            else if (diff < 0)
+            {
+                /* Slot still contains a request which has not been handled => list is full */
+                ret = NOS_ERR_ISR_REQUEST_LIST_FULL;
+            }
+            else
+            {
+                /* Slot has just been taken by a nested interrupt handler, retry */
+                slot = NULL;
+            }
+        }
+        while ((ret == NOS_ERR_SUCCESS) && (slot == NULL));
 
-        /* Check if there is space left in the request list */
-        if (g_nano_os.isr_request_count == NANO_OS_MAX_ISR_REQUEST_COUNT)
+        if (ret == NOS_ERR_SUCCESS)
         {
-            /* List if already full */
-            ret = NOS_ERR_ISR_REQUEST_LIST_FULL;
+            const uint32_t used_count = position + 1u - g_nano_os.isr_request_read_index;
+            uint32_t max_used_count;
+
+            /* Fill the slot and publish it to the interrupt service task, the sequence number
+               is written through the port so that it can't be reordered before the copy */
+            (void)MEMCPY(&slot->request, isr_request, sizeof(nano_os_isr_service_request_t));
+            NANO_OS_PORT_AtomicStore32(&slot->sequence, position + 1u);
+
+            /* Update statistics */
+            do
+            {
+                max_used_count = NANO_OS_PORT_AtomicLoad32(&g_nano_os.isr_request_stats.max_used_count);
+            }
+            while ((used_count > max_used_count) &&
+                   !NANO_OS_PORT_AtomicCas32(&g_nano_os.isr_request_stats.max_used_count, max_used_count, used_count));
+
+            /* Signal interrupt service task */
+            ret = NANO_OS_INTERRUPT_SignalServiceTask();
         }
         else
         {
-            uint32_t woke_up_task_count = 0;
+            /* Update statistics */
+            (void)NANO_OS_PORT_AtomicFetchAdd32(&g_nano_os.isr_request_stats.overflow_count, 1u);
+        }
+    }
+
+    return ret;
+}
+
 
-            /* Add the request to the list */
-            (void)MEMCPY(g_nano_os.isr_request_write, isr_request, sizeof(nano_os_isr_service_request_t));
-            g_nano_os.isr_request_count++;
-            g_nano_os.isr_request_write++;
-            if (g_nano_os.isr_request_write == &g_nano_os.isr_requests[NANO_OS_MAX_ISR_REQUEST_COUNT])
+/** \brief Initialize a coalescing interrupt service request */
+nano_os_error_t NANO_OS_INTERRUPT_InitCoalescedRequest(nano_os_isr_coalesced_request_t* const isr_request,
+                                                       const fp_nano_os_isr_func_t service_func, void* const object)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((isr_request != NULL) && (service_func != NULL))
+    {
+        /* Initialize request */
+        isr_request->next = NULL;
+        isr_request->service_func = service_func;
+        isr_request->object = object;
+        isr_request->count = 0u;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Queue an occurrence of a coalescing interrupt service request */
+nano_os_error_t NANO_OS_INTERRUPT_QueueCoalescedRequest(nano_os_isr_coalesced_request_t* const isr_request)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((isr_request != NULL) && (isr_request->service_func != NULL))
+    {
+        /* Count the occurrence, only the first one adds the request to the pending list */
+        if (NANO_OS_PORT_AtomicFetchAdd32(&isr_request->count, 1u) == 0u)
+        {
+            nano_os_isr_coalesced_request_t* head;
+
+            /* Push the request on the pending list */
+            do
             {
-                g_nano_os.isr_request_write = g_nano_os.isr_requests;
+                head = g_nano_os.isr_coalesced_requests;
+                isr_request->next = head;
             }
+            while (!NANO_OS_PORT_AtomicCasPtr(NANO_OS_CAST(void* volatile*, &g_nano_os.isr_coalesced_requests),
+                                              head, isr_request));
 
             /* Signal interrupt service task */
-            ret = NANO_OS_WAIT_OBJECT_Signal(&g_nano_os.isr_request_task_wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+            ret = NANO_OS_INTERRUPT_SignalServiceTask();
+        }
+        else
+        {
+            /* Merged into the pending request */
+            (void)NANO_OS_PORT_AtomicFetchAdd32(&g_nano_os.isr_request_stats.coalesced_count, 1u);
+            ret = NOS_ERR_SUCCESS;
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Cancel a coalescing interrupt service request, its pending occurrences are dropped */
+nano_os_error_t NANO_OS_INTERRUPT_CancelCoalescedRequest(nano_os_isr_coalesced_request_t* const isr_request)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if (isr_request != NULL)
+    {
+        nano_os_isr_coalesced_request_t* volatile* current;
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Disable interrupts, the pending list can then be modified safely */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+        /* Unlink the request from the pending list */
+        current = &g_nano_os.isr_coalesced_requests;
+        while (((*current) != NULL) && ((*current) != isr_request))
+        {
+            current = &(*current)->next;
         }
+        if ((*current) != NULL)
+        {
+            (*current) = isr_request->next;
+        }
+        isr_request->next = NULL;
+        isr_request->count = 0u;
 
         /* Enable interrupts */
         NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        ret = NOS_ERR_SUCCESS;
     }
 
     return ret;
 }
 
 
+/** \brief Get the interrupt service request statistics */
+nano_os_error_t NANO_OS_INTERRUPT_GetRequestStats(nano_os_isr_request_stats_t* const stats)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if (stats != NULL)
+    {
+        /* Copy statistics */
+        (void)MEMCPY(stats, &g_nano_os.isr_request_stats, sizeof(nano_os_isr_request_stats_t));
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
 
 /** \brief Manage the entry into an interrupt handler */
 void NANO_OS_INTERRUPT_Enter(void)
 {
+    /* Check that the interrupt handler is allowed to call the OS */
+    NANO_OS_PORT_CHECK_ISR_PRIORITY();
+
     /* Increment the nesting count */
     NANO_OS_PORT_ATOMIC_INC32(g_nano_os.int_nesting_count);
 }
@@ -145,14 +308,18 @@ static void* NANO_OS_INTERRUPT_ServiceTask(void* const param)
     /* Task loop */
     while(true)
     {
-        nano_os_error_t ret;
+        nano_os_error_t ret = NOS_ERR_SUCCESS;
 
         /* Increment lock count as if it were a syscall */
         NANO_OS_PORT_ATOMIC_INC32(g_nano_os.lock_count);
 
-        /* Wait for a request */
+        /* Wait for a request, the check is done with interrupts disabled
+           so that a request queued meanwhile can't be missed */
         NANO_OS_PORT_DISABLE_INTERRUPTS();
-        ret = NANO_OS_WAIT_OBJECT_Wait(&g_nano_os.isr_request_task_wait_object, 0xFFFFFFFFu);
+        if (!NANO_OS_INTERRUPT_IsRequestPending())
+        {
+            ret = NANO_OS_WAIT_OBJECT_Wait(&g_nano_os.isr_request_task_wait_object, 0xFFFFFFFFu);
+        }
         NANO_OS_PORT_ENABLE_INTERRUPTS();
 
         /* Decrement lock count as if it were a syscall */
@@ -161,44 +328,36 @@ static void* NANO_OS_INTERRUPT_ServiceTask(void* const param)
         /* Check wait status */
         if (ret == NOS_ERR_SUCCESS)
         {
-            /* Handle requests */
-
-            /* Disable interrupts */
-            NANO_OS_PORT_DISABLE_INTERRUPTS();
+            nano_os_isr_service_request_t request;
+            nano_os_isr_coalesced_request_t* coalesced_request;
 
-            while (g_nano_os.isr_request_count != 0u)
+            /* Handle requests */
+            while (NANO_OS_INTERRUPT_PopRequest(&request))
             {
-                /* Enable interrupts during system call */
-                NANO_OS_PORT_ENABLE_INTERRUPTS();
-
                 /* Execute system call */
-                ret = g_nano_os.isr_request_read->service_func(g_nano_os.isr_request_read->object,
-                                                               g_nano_os.isr_request_read->param1,
-                                                               g_nano_os.isr_request_read->param2);
-                if (ret != NOS_ERR_SUCCESS)
-                {
-                    /* Call error handler */
-                    #if (NANO_OS_ISR_REQUEST_ERROR_CALLBACK_ENABLED == 1u)
-                    NANO_OS_USER_IsrRequestErrorCallback(g_nano_os.isr_request_read, ret);
-                    #else
-                    NANO_OS_ERROR_ASSERT_RET(ret);
-                    #endif /* (NANO_OS_ISR_REQUEST_ERROR_CALLBACK_ENABLED == 1u) */
-                }
+                ret = request.service_func(request.object, request.param1, request.param2);
+                NANO_OS_INTERRUPT_HandleRequestError(&request, ret);
+            }
+
+            /* Take all the pending coalescing requests at once */
+            coalesced_request = NANO_OS_CAST(nano_os_isr_coalesced_request_t*,
+                                             NANO_OS_PORT_AtomicExchangePtr(NANO_OS_CAST(void* volatile*, &g_nano_os.isr_coalesced_requests), NULL));
+            while (coalesced_request != NULL)
+            {
+                /* The request can be pushed again as soon as its count is reset */
+                nano_os_isr_coalesced_request_t* const next = coalesced_request->next;
 
-                /* Disable interrupts to re-check the request count and possibly re-enter the loop */
-                NANO_OS_PORT_DISABLE_INTERRUPTS();
+                /* Execute system call for all the pending occurrences */
+                request.service_func = coalesced_request->service_func;
+                request.object = coalesced_request->object;
+                request.param1 = NANO_OS_PORT_AtomicExchange32(&coalesced_request->count, 0u);
+                request.param2 = 0u;
+                ret = request.service_func(request.object, request.param1, request.param2);
+                NANO_OS_INTERRUPT_HandleRequestError(&request, ret);
 
                 /* Next request */
-                g_nano_os.isr_request_count--;
-                g_nano_os.isr_request_read++;
-                if (g_nano_os.isr_request_read == &g_nano_os.isr_requests[NANO_OS_MAX_ISR_REQUEST_COUNT])
-                {
-                    g_nano_os.isr_request_read = g_nano_os.isr_requests;
-                }
+                coalesced_request = next;
             }
-
-            /* Enable interrupts */
-            NANO_OS_PORT_DISABLE_INTERRUPTS();
         }
         else if (ret == NOS_ERR_TIMEOUT)
         {
@@ -213,3 +372,71 @@ static void* NANO_OS_INTERRUPT_ServiceTask(void* const param)
 
     return NULL;
 }
+
+
+/** \brief Signal the interrupt service request task */
+static nano_os_error_t NANO_OS_INTERRUPT_SignalServiceTask(void)
+{
+    nano_os_error_t ret;
+    uint32_t woke_up_task_count = 0u;
+    nano_os_int_status_reg_t int_status_reg;
+
+    /* Disable interrupts */
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+    /* Signal interrupt service task */
+    ret = NANO_OS_WAIT_OBJECT_Signal(&g_nano_os.isr_request_task_wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+
+    /* Enable interrupts */
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+    return ret;
+}
+
+
+/** \brief Check if an interrupt service request is pending */
+static bool NANO_OS_INTERRUPT_IsRequestPending(void)
+{
+    const uint32_t position = g_nano_os.isr_request_read_index;
+    const nano_os_isr_request_slot_t* const slot = &g_nano_os.isr_requests[position & (NANO_OS_MAX_ISR_REQUEST_COUNT - 1u)];
+    return ((NANO_OS_PORT_ATOMIC_READ32(slot->sequence) == (position + 1u)) || (g_nano_os.isr_coalesced_requests != NULL));
+}
+
+
+/** \brief Get the next interrupt service request from the queue */
+static bool NANO_OS_INTERRUPT_PopRequest(nano_os_isr_service_request_t* const isr_request)
+{
+    bool ret = false;
+    const uint32_t position = g_nano_os.isr_request_read_index;
+    nano_os_isr_request_slot_t* const slot = &g_nano_os.isr_requests[position & (NANO_OS_MAX_ISR_REQUEST_COUNT - 1u)];
+
+    /* Check if the slot has been published */
+    if (NANO_OS_PORT_ATOMIC_READ32(slot->sequence) == (position + 1u))
+    {
+        /* Copy the request and release the slot for the next round */
+        (void)MEMCPY(isr_request, &slot->request, sizeof(nano_os_isr_service_request_t));
+        NANO_OS_PORT_AtomicStore32(&slot->sequence, position + NANO_OS_MAX_ISR_REQUEST_COUNT);
+        g_nano_os.isr_request_read_index = position + 1u;
+
+        ret = true;
+    }
+
+    return ret;
+}
+
+
+/** \brief Handle the error returned by an interrupt service request */
+static void NANO_OS_INTERRUPT_HandleRequestError(const nano_os_isr_service_request_t* const isr_request, const nano_os_error_t error)
+{
+    if (error != NOS_ERR_SUCCESS)
+    {
+        /* Call error handler */
+        #if (NANO_OS_ISR_REQUEST_ERROR_CALLBACK_ENABLED == 1u)
+        NANO_OS_USER_IsrRequestErrorCallback(isr_request, error);
+        #else
+        NANO_OS_UNUSED(isr_request);
+        NANO_OS_ERROR_ASSERT_RET(error);
+        #endif /* (NANO_OS_ISR_REQUEST_ERROR_CALLBACK_ENABLED == 1u) */
+    }
+}
+
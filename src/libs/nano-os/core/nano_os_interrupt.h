@@ -49,6 +49,43 @@ typedef struct _nano_os_isr_service_request_t
     uint32_t param2;
 } nano_os_isr_service_request_t;
 
+/** \brief Slot of the interrupt service request queue */
+typedef struct _nano_os_isr_request_slot_t
+{
+    /** \brief Sequence number synchronizing the producers and the consumer of the slot */
+    volatile uint32_t sequence;
+    /** \brief Request */
+    nano_os_isr_service_request_t request;
+} nano_os_isr_request_slot_t;
+
+/** \brief Coalescing interrupt service request
+ *         Embedded into a Nano OS object, all the occurrences queued while the request
+ *         is pending are merged into a single call to the service function
+ *         (param1 = number of occurrences, param2 = 0)
+ */
+typedef struct _nano_os_isr_coalesced_request_t
+{
+    /** \brief Next pending request */
+    struct _nano_os_isr_coalesced_request_t* next;
+    /** \brief Function to execute */
+    fp_nano_os_isr_func_t service_func;
+    /** \brief Nano OS object */
+    void* object;
+    /** \brief Number of pending occurrences */
+    volatile uint32_t count;
+} nano_os_isr_coalesced_request_t;
+
+/** \brief Interrupt service request statistics */
+typedef struct _nano_os_isr_request_stats_t
+{
+    /** \brief Number of requests which have been rejected because the queue was full */
+    uint32_t overflow_count;
+    /** \brief Maximum number of requests simultaneously queued */
+    uint32_t max_used_count;
+    /** \brief Number of occurrences merged into an already pending coalescing request */
+    uint32_t coalesced_count;
+} nano_os_isr_request_stats_t;
+
 
 
 /** \brief Initialize the interrupt service module */
@@ -57,6 +94,19 @@ nano_os_error_t NANO_OS_INTERRUPT_Init(const nano_os_port_init_data_t* const por
 /** \brief Queue an interrupt service request */
 nano_os_error_t NANO_OS_INTERRUPT_QueueRequest(nano_os_isr_service_request_t* const isr_request);
 
+/** \brief Initialize a coalescing interrupt service request */
+nano_os_error_t NANO_OS_INTERRUPT_InitCoalescedRequest(nano_os_isr_coalesced_request_t* const isr_request,
+                                                       const fp_nano_os_isr_func_t service_func, void* const object);
+
+/** \brief Queue an occurrence of a coalescing interrupt service request */
+nano_os_error_t NANO_OS_INTERRUPT_QueueCoalescedRequest(nano_os_isr_coalesced_request_t* const isr_request);
+
+/** \brief Cancel a coalescing interrupt service request, its pending occurrences are dropped */
+nano_os_error_t NANO_OS_INTERRUPT_CancelCoalescedRequest(nano_os_isr_coalesced_request_t* const isr_request);
+
+/** \brief Get the interrupt service request statistics */
+nano_os_error_t NANO_OS_INTERRUPT_GetRequestStats(nano_os_isr_request_stats_t* const stats);
+
 
 /** \brief Manage the entry into an interrupt handler */
 void NANO_OS_INTERRUPT_Enter(void);
@@ -0,0 +1,230 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_interrupt_thread.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_INTERRUPT_THREAD_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+/** \brief Wake up the task of an interrupt thread */
+static nano_os_error_t NANO_OS_INTERRUPT_THREAD_WakeUp(void* const object, const uint32_t param1, const uint32_t param2);
+
+/** \brief Interrupt thread task */
+static void* NANO_OS_INTERRUPT_THREAD_Task(void* const param);
+
+
+
+
+/** \brief Create a new interrupt thread */
+nano_os_error_t NANO_OS_INTERRUPT_THREAD_Create(nano_os_interrupt_thread_t* const interrupt_thread,
+                                                const nano_os_interrupt_thread_init_data_t* const init_data)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((interrupt_thread != NULL) && (init_data != NULL) && (init_data->handler != NULL))
+    {
+        nano_os_task_init_data_t task_init_data;
+
+        /* 0 init of interrupt thread */
+        (void)MEMSET(interrupt_thread, 0, sizeof(nano_os_interrupt_thread_t));
+
+        /* Initialize interrupt thread data */
+        interrupt_thread->handler = init_data->handler;
+        interrupt_thread->mask = init_data->mask;
+        interrupt_thread->unmask = init_data->unmask;
+        interrupt_thread->user_data = init_data->user_data;
+        interrupt_thread->pending_count = 0u;
+        ret = NANO_OS_INTERRUPT_InitCoalescedRequest(&interrupt_thread->isr_request, NANO_OS_INTERRUPT_THREAD_WakeUp, interrupt_thread);
+
+        /* Init underlying wait object before the task can run */
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Initialize(&interrupt_thread->wait_object, WOT_TASK, QT_PRIORITY);
+        }
+
+        /* Create the underlying task */
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            (void)MEMCPY(&task_init_data, &init_data->task_init_data, sizeof(nano_os_task_init_data_t));
+            task_init_data.task_func = NANO_OS_INTERRUPT_THREAD_Task;
+            task_init_data.param = interrupt_thread;
+            ret = NANO_OS_TASK_Create(&interrupt_thread->task, &task_init_data);
+            if (ret != NOS_ERR_SUCCESS)
+            {
+                /* Undo the initialization so that the interrupt thread can't be triggered */
+                (void)NANO_OS_INTERRUPT_CancelCoalescedRequest(&interrupt_thread->isr_request);
+                #if (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED == 1u)
+                (void)NANO_OS_WAIT_OBJECT_Destroy(&interrupt_thread->wait_object);
+                #endif /* (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED == 1u) */
+            }
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Trigger an interrupt thread from the top half of an interrupt handler */
+nano_os_error_t NANO_OS_INTERRUPT_THREAD_Trigger(nano_os_interrupt_thread_t* const interrupt_thread)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((interrupt_thread != NULL) && (interrupt_thread->wait_object.type == WOT_TASK))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Mask the interrupt source until the bottom half has been executed */
+        if (interrupt_thread->mask != NULL)
+        {
+            interrupt_thread->mask(interrupt_thread->user_data);
+        }
+
+        /* Count the trigger */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        interrupt_thread->pending_count++;
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        /* Check if operation can be done */
+        if (WAIT_OBJECT_ISR_ISLOCKED(interrupt_thread->wait_object))
+        {
+            /* Queue request, the triggers are merged into a single wake up */
+            ret = NANO_OS_INTERRUPT_QueueCoalescedRequest(&interrupt_thread->isr_request);
+        }
+        else
+        {
+            /* No syscall in progress */
+            ret = NANO_OS_INTERRUPT_THREAD_WakeUp(interrupt_thread, 1u, 0u);
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Wake up the task of an interrupt thread */
+static nano_os_error_t NANO_OS_INTERRUPT_THREAD_WakeUp(void* const object, const uint32_t param1, const uint32_t param2)
+{
+    nano_os_error_t ret;
+    uint32_t woke_up_task_count = 0u;
+    nano_os_interrupt_thread_t* const interrupt_thread = NANO_OS_CAST(nano_os_interrupt_thread_t*, object);
+    NANO_OS_UNUSED(param1);
+    NANO_OS_UNUSED(param2);
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Lock interrupt thread against interrupt handler access */
+    WAIT_OBJECT_ISR_LOCK(interrupt_thread->wait_object);
+
+    /* Wake up the task if it is waiting */
+    ret = NANO_OS_WAIT_OBJECT_Signal(&interrupt_thread->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+
+    /* Unlock interrupt thread against interrupt handler access */
+    WAIT_OBJECT_ISR_UNLOCK(interrupt_thread->wait_object);
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Interrupt thread task */
+static void* NANO_OS_INTERRUPT_THREAD_Task(void* const param)
+{
+    nano_os_interrupt_thread_t* const interrupt_thread = NANO_OS_CAST(nano_os_interrupt_thread_t*, param);
+
+    /* Task loop */
+    while (true)
+    {
+        nano_os_error_t ret = NOS_ERR_SUCCESS;
+        uint32_t trigger_count = 0u;
+
+        /* Syscall entry */
+        NANO_OS_SYSCALL_Enter(true);
+
+        /* Lock interrupt thread against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(interrupt_thread->wait_object);
+
+        /* Wait for a trigger */
+        if (interrupt_thread->pending_count == 0u)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Wait(&interrupt_thread->wait_object, 0xFFFFFFFFu);
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Consume the triggers, the source is masked until the bottom half has been executed */
+            nano_os_int_status_reg_t int_status_reg;
+            NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+            trigger_count = interrupt_thread->pending_count;
+            interrupt_thread->pending_count = 0u;
+            NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+        }
+
+        /* Unlock interrupt thread against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(interrupt_thread->wait_object);
+
+        /* Syscall exit */
+        NANO_OS_SYSCALL_Exit();
+
+        /* Check wait status */
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Bottom half */
+            interrupt_thread->handler(interrupt_thread->user_data);
+
+            /* Unmask the interrupt source once for each time it has been masked */
+            if (interrupt_thread->unmask != NULL)
+            {
+                while (trigger_count != 0u)
+                {
+                    interrupt_thread->unmask(interrupt_thread->user_data);
+                    trigger_count--;
+                }
+            }
+        }
+        else if (ret == NOS_ERR_TIMEOUT)
+        {
+            /* No trigger, return in wait state */
+        }
+        else
+        {
+            /* Critical error */
+            NANO_OS_ERROR_Handler(ret);
+        }
+    }
+
+    return NULL;
+}
+
+
+#endif /* (NANO_OS_INTERRUPT_THREAD_ENABLED == 1u) */
@@ -0,0 +1,104 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_INTERRUPT_THREAD_H
+#define NANO_OS_INTERRUPT_THREAD_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_INTERRUPT_THREAD_ENABLED == 1u)
+
+
+#include "nano_os_task.h"
+#include "nano_os_wait_object.h"
+#include "nano_os_interrupt.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Prototype for the interrupt thread functions */
+typedef void (*fp_nano_os_interrupt_thread_func_t)(void* const user_data);
+
+
+/** \brief Interrupt thread init data */
+typedef struct _nano_os_interrupt_thread_init_data_t
+{
+    /** \brief Underlying task init data (task function and parameter are ignored) */
+    nano_os_task_init_data_t task_init_data;
+
+    /** \brief Bottom half of the interrupt handler, executed in the interrupt thread */
+    fp_nano_os_interrupt_thread_func_t handler;
+    /** \brief Mask the interrupt source, called from the top half (optional) */
+    fp_nano_os_interrupt_thread_func_t mask;
+    /** \brief Unmask the interrupt source, called when the bottom half has finished, once per mask call (optional) */
+    fp_nano_os_interrupt_thread_func_t unmask;
+    /** \brief User data passed to the functions */
+    void* user_data;
+} nano_os_interrupt_thread_init_data_t;
+
+
+/** \brief Nano OS interrupt thread
+ *         The interrupt handler (top half) only acknowledges the interrupt and triggers
+ *         the interrupt thread which masks the source and runs the bottom half
+ *         in a dedicated task scheduled at its own priority. The source is unmasked
+ *         once the bottom half has been executed.
+ */
+typedef struct _nano_os_interrupt_thread_t
+{
+    /** \brief Underlying task */
+    nano_os_task_t task;
+    /** \brief Wait object to signal the task */
+    nano_os_wait_object_t wait_object;
+
+    /** \brief Bottom half */
+    fp_nano_os_interrupt_thread_func_t handler;
+    /** \brief Mask the interrupt source */
+    fp_nano_os_interrupt_thread_func_t mask;
+    /** \brief Unmask the interrupt source */
+    fp_nano_os_interrupt_thread_func_t unmask;
+    /** \brief User data */
+    void* user_data;
+    /** \brief Number of triggers since the last execution of the bottom half */
+    volatile uint32_t pending_count;
+    /** \brief Request to wake up the task when triggered during a system call on the thread */
+    nano_os_isr_coalesced_request_t isr_request;
+} nano_os_interrupt_thread_t;
+
+
+
+
+/** \brief Create a new interrupt thread */
+nano_os_error_t NANO_OS_INTERRUPT_THREAD_Create(nano_os_interrupt_thread_t* const interrupt_thread,
+                                                const nano_os_interrupt_thread_init_data_t* const init_data);
+
+/** \brief Trigger an interrupt thread from the top half of an interrupt handler */
+nano_os_error_t NANO_OS_INTERRUPT_THREAD_Trigger(nano_os_interrupt_thread_t* const interrupt_thread);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_INTERRUPT_THREAD_ENABLED == 1u) */
+
+#endif /* NANO_OS_INTERRUPT_THREAD_H */
@@ -68,6 +68,11 @@ static bool NANO_OS_SCHEDULER_RemoveFromReadyList(nano_os_task_t* const task);
 /** \brief Remove a task from the suspent list */
 static bool NANO_OS_SCHEDULER_RemoveFromSuspentList(nano_os_task_t* const task);
 
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+/** \brief Move a ready task at the head of the ready list of its priority level */
+static bool NANO_OS_SCHEDULER_MoveToReadyListHead(nano_os_task_t* const task);
+#endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
 
 
 /** \brief First scheduling which will start Nano OS */
@@ -266,30 +271,29 @@ nano_os_error_t NANO_OS_SCHEDULER_SetTaskReady(nano_os_task_t* const task)
     /* Check parameters */
     if (task != NULL)
     {
-        bool list_ret = true;
+        bool list_ret;
 
-        /* Remove the task from the pending list */
+        /* Remove the task from the pending list (the task may not be in the
+           list anymore if its wait timeout has been cancelled) */
         if (task->state == NOS_TS_PENDING)
         {
-            list_ret = NANO_OS_SCHEDULER_RemoveFromSuspentList(task);
+            (void)NANO_OS_SCHEDULER_RemoveFromSuspentList(task);
         }
+
+        /* Add the task to the ready list */
+        list_ret = NANO_OS_SCHEDULER_AddToReadyList(task);
         if (list_ret)
         {
-            /* Add the task to the ready list */
-            list_ret = NANO_OS_SCHEDULER_AddToReadyList(task);
-            if (list_ret)
-            {
-                /* Update the task state */
-                task->state = NOS_TS_READY;
-                #if (NANO_OS_ROUND_ROBIN_ENABLED == 1u)
-                task->timeslice = NANO_OS_ROUND_ROBIN_TIMESLICE;
-                #endif /* (NANO_OS_ROUND_ROBIN_ENABLED == 1u) */
+            /* Update the task state */
+            task->state = NOS_TS_READY;
+            #if (NANO_OS_ROUND_ROBIN_ENABLED == 1u)
+            task->timeslice = NANO_OS_ROUND_ROBIN_TIMESLICE;
+            #endif /* (NANO_OS_ROUND_ROBIN_ENABLED == 1u) */
 
-                /* A schedule is needed as the task may be the highest priority task ready */
-                g_nano_os.schedule_needed = true;
+            /* A schedule is needed as the task may be the highest priority task ready */
+            g_nano_os.schedule_needed = true;
 
-                ret = NOS_ERR_SUCCESS;
-            }
+            ret = NOS_ERR_SUCCESS;
         }
     }
 
@@ -340,7 +344,7 @@ nano_os_error_t NANO_OS_SCHEDULER_SetTaskPending(nano_os_task_t* const task, con
 
 
 /** \brief Go through all the suspent tasks to check their wake-up timeout */
-nano_os_error_t NANO_OS_SCHEDULER_HandleSuspentTasks(void)
+nano_os_error_t NANO_OS_SCHEDULER_HandleSuspentTasks(const uint32_t tick)
 {
     nano_os_task_t* current;
     nano_os_error_t ret = NOS_ERR_SUCCESS;
@@ -353,13 +357,20 @@ nano_os_error_t NANO_OS_SCHEDULER_HandleSuspentTasks(void)
     while (current != NULL)
     {
         /* Check wake up time */
-        if (current->wait_timeout == g_nano_os.tick_count)
+        if (current->wait_timeout == tick)
         {
             nano_os_task_t* next = current->suspent_next;
 
             /* Update the task wait status */
             current->wait_status = NOS_ERR_TIMEOUT;
 
+            /* Remove the task from the waiting list of the wait object */
+            if (current->waiting_object != NULL)
+            {
+                (void)NANO_OS_TASK_LIST_Remove(&current->waiting_object->waiting_tasks, current);
+                current->waiting_object = NULL;
+            }
+
             /* Set the task in ready state */
             ret = NANO_OS_SCHEDULER_SetTaskReady(current);
             NANO_OS_ERROR_ASSERT_RET(ret);
@@ -408,6 +419,113 @@ nano_os_error_t NANO_OS_SCHEDULER_HandleSuspentTasks(void)
 }
 
 
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+/** \brief Set a task into ready state at the head of its priority level so that it is the next to run at this level */
+nano_os_error_t NANO_OS_SCHEDULER_HandOff(nano_os_task_t* const task)
+{
+    nano_os_int_status_reg_t int_status_reg;
+    nano_os_error_t ret;
+
+    /* Critical section */
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+    /* Set the task ready */
+    ret = NANO_OS_SCHEDULER_SetTaskReady(task);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        /* Move it at the head of its ready list */
+        (void)NANO_OS_SCHEDULER_MoveToReadyListHead(task);
+    }
+
+    /* End of critical section */
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+    return ret;
+}
+
+
+/** \brief Change the current priority of a task */
+nano_os_error_t NANO_OS_SCHEDULER_SetTaskPriority(nano_os_task_t* const task, const uint8_t priority)
+{
+    nano_os_int_status_reg_t int_status_reg;
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Critical section */
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+    /* Check parameters */
+    if ((task != NULL) && (priority < NANO_OS_NUMBER_OF_PRIORITY_LEVELS))
+    {
+        if (task->priority == priority)
+        {
+            /* Nothing to do */
+            ret = NOS_ERR_SUCCESS;
+        }
+        else if ((task->state == NOS_TS_READY) || (task->state == NOS_TS_RUNNING))
+        {
+            /* Move the task to the ready list of its new priority level */
+            bool list_ret = NANO_OS_SCHEDULER_RemoveFromReadyList(task);
+            if (list_ret)
+            {
+                task->priority = priority;
+                list_ret = NANO_OS_SCHEDULER_AddToReadyList(task);
+                if (list_ret)
+                {
+                    /* The running task must stay at the head of its ready list for round robin scheduling */
+                    if (task->state == NOS_TS_RUNNING)
+                    {
+                        (void)NANO_OS_SCHEDULER_MoveToReadyListHead(task);
+                    }
+
+                    /* A schedule is needed as the task may not be the highest priority task ready anymore */
+                    g_nano_os.schedule_needed = true;
+
+                    ret = NOS_ERR_SUCCESS;
+                }
+            }
+        }
+        else
+        {
+            /* Task is not in a ready list */
+            task->priority = priority;
+            ret = NOS_ERR_SUCCESS;
+        }
+    }
+
+    /* End of critical section */
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+    return ret;
+}
+
+
+/** \brief Cancel the wait timeout of a pending task, the task stays pending until it is explicitly set ready */
+nano_os_error_t NANO_OS_SCHEDULER_CancelTaskTimeout(nano_os_task_t* const task)
+{
+    nano_os_int_status_reg_t int_status_reg;
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Critical section */
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+    /* Check parameters */
+    if ((task != NULL) && (task->state == NOS_TS_PENDING))
+    {
+        /* Remove the task from the suspent list */
+        (void)NANO_OS_SCHEDULER_RemoveFromSuspentList(task);
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* End of critical section */
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+    return ret;
+}
+
+#endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
+
 
 
 /** \brief Get the highest priority ready task */
@@ -528,3 +646,27 @@ static bool NANO_OS_SCHEDULER_RemoveFromSuspentList(nano_os_task_t* const task)
 
     return ret;
 }
+
+
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+/** \brief Move a ready task at the head of the ready list of its priority level */
+static bool NANO_OS_SCHEDULER_MoveToReadyListHead(nano_os_task_t* const task)
+{
+    bool ret = false;
+
+    /* Remove the task from the ready list */
+    const nano_os_error_t err = NANO_OS_TASK_LIST_Remove(&g_nano_os.ready_tasks[task->priority], task);
+    if (err == NOS_ERR_SUCCESS)
+    {
+        /* Add it at the head of the list, the bitfield doesn't change */
+        task->next = g_nano_os.ready_tasks[task->priority];
+        g_nano_os.ready_tasks[task->priority] = task;
+
+        ret = true;
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
@@ -49,7 +49,20 @@ nano_os_error_t NANO_OS_SCHEDULER_SetTaskReady(nano_os_task_t* const task);
 nano_os_error_t NANO_OS_SCHEDULER_SetTaskPending(nano_os_task_t* const task, const uint32_t tick_count);
 
 /** \brief Go through all the suspent tasks to check their wake-up timeout */
-nano_os_error_t NANO_OS_SCHEDULER_HandleSuspentTasks(void);
+nano_os_error_t NANO_OS_SCHEDULER_HandleSuspentTasks(const uint32_t tick);
+
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+/** \brief Set a task into ready state at the head of its priority level so that it is the next to run at this level */
+nano_os_error_t NANO_OS_SCHEDULER_HandOff(nano_os_task_t* const task);
+
+/** \brief Change the current priority of a task */
+nano_os_error_t NANO_OS_SCHEDULER_SetTaskPriority(nano_os_task_t* const task, const uint8_t priority);
+
+/** \brief Cancel the wait timeout of a pending task, the task stays pending until it is explicitly set ready */
+nano_os_error_t NANO_OS_SCHEDULER_CancelTaskTimeout(nano_os_task_t* const task);
+
+#endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
 
 
 #ifdef __cplusplus
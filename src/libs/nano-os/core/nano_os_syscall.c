@@ -40,6 +40,10 @@ void NANO_OS_SYSCALL_Enter(const bool nano_os_must_be_started)
         {
             NANO_OS_PORT_SYSCALL_ENTER();
         }
+        else
+        {
+            NANO_OS_PORT_CHECK_ISR_PRIORITY();
+        }
 
         /* Increment the lock count */
         NANO_OS_PORT_ATOMIC_INC32(g_nano_os.lock_count);
@@ -105,6 +105,14 @@ nano_os_error_t NANO_OS_TASK_Create(nano_os_task_t* const task, const nano_os_ta
             }
             #endif /* (NANO_OS_TASK_JOIN_ENABLED == 1u) */
 
+            #if (NANO_OS_CHANNEL_ENABLED == 1u)
+            /* Init channel reply object */
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                ret = NANO_OS_WAIT_OBJECT_Initialize(&task->channel_reply_object, WOT_TASK, QT_FIFO);
+            }
+            #endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
 
             /* Register task to scheduler */
             if (ret == NOS_ERR_SUCCESS)
@@ -248,6 +256,200 @@ nano_os_error_t NANO_OS_TASK_Get(const uint16_t task_id, nano_os_task_t** task)
 #endif /* (NANO_OS_TASK_GET_ENABLED == 1u) */
 
 
+#if (NANO_OS_TASK_NOTIFY_ENABLED == 1u)
+
+/** \brief Send a notification to a task */
+nano_os_error_t NANO_OS_TASK_Notify(nano_os_task_t* const task, const uint32_t value, const nano_os_task_notify_action_t action)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((task != NULL) && (task->state != NOS_TS_FREE) && (task->state != NOS_TS_DEAD))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_TASK(NOS_TRACE_TASK_NOTIFY, task);
+
+        /* Update notification value */
+        ret = NOS_ERR_SUCCESS;
+        switch (action)
+        {
+            case NOS_TNA_NO_ACTION:
+                /* Value left unchanged */
+                break;
+
+            case NOS_TNA_SET_BITS:
+                task->notify_value |= value;
+                break;
+
+            case NOS_TNA_INCREMENT:
+                task->notify_value++;
+                break;
+
+            case NOS_TNA_OVERWRITE:
+                task->notify_value = value;
+                break;
+
+            default:
+                /* Invalid action */
+                ret = NOS_ERR_INVALID_ARG;
+                break;
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Notification is now pending */
+            task->notify_pending = true;
+
+            /* Wake up the task if it is blocked waiting for the notification */
+            if (task->notify_waiting && (task->state == NOS_TS_PENDING))
+            {
+                task->notify_waiting = false;
+                task->wait_timeout = 0u;
+                task->wait_status = NOS_ERR_SUCCESS;
+                ret = NANO_OS_SCHEDULER_SetTaskReady(task);
+            }
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u)
+
+/** \brief Send a notification to a task from an interrupt handler */
+nano_os_error_t NANO_OS_TASK_NotifyFromIsr(nano_os_task_t* const task, const uint32_t value, const nano_os_task_notify_action_t action)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((task != NULL) && (task->state != NOS_TS_FREE) && (task->state != NOS_TS_DEAD))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_TASK(NOS_TRACE_TASK_NOTIFY_ISR, task);
+
+        /* Check if operation can be done (the notification state is only
+           protected by the scheduler lock) */
+        if (NANO_OS_PORT_ATOMIC_READ32(g_nano_os.lock_count) != 0u)
+        {
+            /* Fill interrupt service request */
+            nano_os_isr_service_request_t request;
+            request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_TASK_Notify);
+            request.object = task;
+            request.param1 = value;
+            request.param2 = NANO_OS_CAST(uint32_t, action);
+
+            /* Queue request */
+            ret = NANO_OS_INTERRUPT_QueueRequest(&request);
+        }
+        else
+        {
+            /* No syscall in progress */
+            ret = NANO_OS_TASK_Notify(task, value, action);
+        }
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u) */
+
+
+/** \brief Wait for a notification on the current task for fixed number of ticks */
+nano_os_error_t NANO_OS_TASK_NotifyWait(const uint32_t clear_on_entry, const uint32_t clear_on_exit, uint32_t* const value, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+    nano_os_task_t* task;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* A task can only wait on its own notification */
+    task = g_nano_os.current_task;
+
+    /* Real time trace event */
+    NANO_OS_TRACE_TASK(NOS_TRACE_TASK_NOTIFY_WAIT, task);
+
+    /* Check if a notification is already pending */
+    if (task->notify_pending)
+    {
+        ret = NOS_ERR_SUCCESS;
+    }
+    else
+    {
+        /* Clear the requested bits before waiting */
+        task->notify_value &= ~clear_on_entry;
+
+        /* Case of NULL timeout */
+        if (tick_count == 0u)
+        {
+            ret = NOS_ERR_TIMEOUT;
+        }
+        else
+        {
+            /* Block the task directly, no wait object is involved */
+            task->waiting_object = NULL;
+            task->notify_waiting = true;
+            ret = NANO_OS_SCHEDULER_SetTaskPending(task, tick_count);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                nano_os_int_status_reg_t int_status_reg;
+
+                /* Disable interrupts */
+                NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+                /* Decrement the lock count */
+                g_nano_os.lock_count--;
+
+                /* Start a new scheduling */
+                NANO_OS_SCHEDULER_Schedule(false);
+
+                /* Increment the lock count */
+                g_nano_os.lock_count++;
+
+                /* Enable interrupts */
+                NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+                /* Get wait return value */
+                ret = task->wait_status;
+            }
+            task->notify_waiting = false;
+
+            /* A notification may have been sent after the timeout has expired
+               but before the task has been scheduled again */
+            if (task->notify_pending)
+            {
+                ret = NOS_ERR_SUCCESS;
+            }
+        }
+    }
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        /* Get the notification value */
+        if (value != NULL)
+        {
+            (*value) = task->notify_value;
+        }
+
+        /* Consume the notification */
+        task->notify_value &= ~clear_on_exit;
+        task->notify_pending = false;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_TASK_NOTIFY_ENABLED == 1u) */
+
+
 /** \brief Task startup function (should not be called directly by application) */
 void NANO_OS_TASK_Start(nano_os_task_t* const task, fp_nano_os_task_func_t task_func, void* const param)
 {
@@ -309,6 +511,12 @@ void NANO_OS_TASK_Start(nano_os_task_t* const task, fp_nano_os_task_func_t task_
             NANO_OS_ERROR_ASSERT_RET(err);
             #endif /* ((NANO_OS_TASK_SLEEP_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED == 1u)) */
 
+            #if ((NANO_OS_CHANNEL_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED == 1u))
+            /* Destroy the channel reply wait object */
+            err = NANO_OS_WAIT_OBJECT_Destroy(&task->channel_reply_object);
+            NANO_OS_ERROR_ASSERT_RET(err);
+            #endif /* ((NANO_OS_CHANNEL_ENABLED == 1u) && (NANO_OS_WAIT_OBJECT_DESTROY_ENABLED == 1u)) */
+
             /* Update task state */
             task->state = NOS_TS_DEAD;
 
@@ -54,6 +54,24 @@ typedef enum _nano_os_task_state_t
 } nano_os_task_state_t;
 
 
+#if (NANO_OS_TASK_NOTIFY_ENABLED == 1u)
+
+/** \brief Nano OS task notification actions */
+typedef enum _nano_os_task_notify_action_t
+{
+    /** \brief Only signal the task, the notification value is left unchanged */
+    NOS_TNA_NO_ACTION = 0u,
+    /** \brief Set bits in the notification value */
+    NOS_TNA_SET_BITS = 1u,
+    /** \brief Increment the notification value */
+    NOS_TNA_INCREMENT = 2u,
+    /** \brief Overwrite the notification value */
+    NOS_TNA_OVERWRITE = 3u
+} nano_os_task_notify_action_t;
+
+#endif /* (NANO_OS_TASK_NOTIFY_ENABLED == 1u) */
+
+
 
 /** \brief Nano OS task context */
 typedef struct _nano_os_task_t
@@ -114,6 +132,16 @@ typedef struct _nano_os_task_t
     #endif /* (NANO_OS_TASK_JOIN_ENABLED == 1u) */
 
 
+    #if (NANO_OS_TASK_NOTIFY_ENABLED == 1u)
+    /** \brief Notification value */
+    uint32_t notify_value;
+    /** \brief Indicate if a notification is pending */
+    bool notify_pending;
+    /** \brief Indicate if the task is blocked waiting for a notification */
+    bool notify_waiting;
+    #endif /* (NANO_OS_TASK_NOTIFY_ENABLED == 1u) */
+
+
     #if (NANO_OS_FLAG_SET_ENABLED == 1u)
     /** \brief Flag set wait mask */
     uint32_t flag_set_wait_mask;
@@ -124,8 +152,41 @@ typedef struct _nano_os_task_t
     #if (NANO_OS_MAILBOX_ENABLED == 1u)
     /** \brief Buffer to sore received mail */
     void* mailbox_buffer;
+    #if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+    /** \brief Minimum number of mails needed to wake up the task */
+    uint32_t mailbox_min_count;
+    /** \brief Maximum number of mails which can be stored in the mail buffer */
+    uint32_t mailbox_max_count;
+    /** \brief Number of mails received in the mail buffer */
+    uint32_t mailbox_received_count;
+    #endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
     #endif /* (NANO_OS_MAILBOX_ENABLED == 1u) */
 
+    #if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+    /** \brief Message to send or buffer to store the received message */
+    void* message_buffer;
+    /** \brief Size in bytes of the message to send or of the received message */
+    size_t message_size;
+    #endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
+
+    #if (NANO_OS_MEM_POOL_ENABLED == 1u)
+    /** \brief Block given by a memory pool to the waiting task */
+    void* mem_pool_block;
+    #endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
+
+    #if (NANO_OS_CHANNEL_ENABLED == 1u)
+    /** \brief Wait object to wait for the reply of a server */
+    nano_os_wait_object_t channel_reply_object;
+    /** \brief Message buffer sent to a server (request and reply) */
+    void* channel_buffer;
+    /** \brief Size in bytes of the message buffer sent to a server */
+    size_t channel_size;
+    /** \brief Client which has sent the message currently processed by the task */
+    struct _nano_os_task_t* channel_client;
+    /** \brief Priority of the task before it has inherited the priority of its client */
+    uint8_t channel_priority;
+    #endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
     #if (NANO_OS_ROUND_ROBIN_ENABLED == 1u)
     /** \brief Timeslice counter for round robin scheduling */
     uint32_t timeslice;
@@ -213,6 +274,23 @@ nano_os_error_t NANO_OS_TASK_Get(const uint16_t task_id, nano_os_task_t** task);
 
 #endif /* (NANO_OS_TASK_GET_ENABLED == 1u) */
 
+#if (NANO_OS_TASK_NOTIFY_ENABLED == 1u)
+
+/** \brief Send a notification to a task */
+nano_os_error_t NANO_OS_TASK_Notify(nano_os_task_t* const task, const uint32_t value, const nano_os_task_notify_action_t action);
+
+#if (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u)
+
+/** \brief Send a notification to a task from an interrupt handler */
+nano_os_error_t NANO_OS_TASK_NotifyFromIsr(nano_os_task_t* const task, const uint32_t value, const nano_os_task_notify_action_t action);
+
+#endif /* (NANO_OS_TASK_NOTIFYFROMISR_ENABLED == 1u) */
+
+/** \brief Wait for a notification on the current task for fixed number of ticks */
+nano_os_error_t NANO_OS_TASK_NotifyWait(const uint32_t clear_on_entry, const uint32_t clear_on_exit, uint32_t* const value, const uint32_t tick_count);
+
+#endif /* (NANO_OS_TASK_NOTIFY_ENABLED == 1u) */
+
 
 
 /** \brief Task startup function (should not be called directly by application) */
@@ -29,14 +29,34 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 
 
 
-/** \brief Timer task */
+/** \brief Initialize a timer service and create its task */
+static nano_os_error_t NANO_OS_TIMER_InitService(nano_os_timer_service_t* const service, const nano_os_task_init_data_t* const task_init_data);
+
+/** \brief Timer service task */
 static void* NANO_OS_TIMER_Task(void* const param);
 
-/** \brief Queue a timer to the started timer list */
-static void NANO_OS_TIMER_Queue(nano_os_timer_t* const timer, const uint32_t first_due_time);
+/** \brief Handle the next tick of the timer wheel */
+static void NANO_OS_TIMER_WheelStep(void);
+
+/** \brief Compute the expiry of a timer within its slack and insert it in the timer wheel (interrupts must be disabled) */
+static void NANO_OS_TIMER_Schedule(nano_os_timer_t* const timer, const uint32_t earliest_expiry);
+
+/** \brief Insert a timer in the timer wheel according to its expiry (interrupts must be disabled) */
+static void NANO_OS_TIMER_Insert(nano_os_timer_t* const timer);
+
+/** \brief Remove a timer from its list (interrupts must be disabled) */
+static void NANO_OS_TIMER_Remove(nano_os_timer_t* const timer);
+
+/** \brief Add a timer to the elapsed timer list according to its timeout (interrupts must be disabled) */
+static void NANO_OS_TIMER_AddElapsed(nano_os_timer_t* const timer);
 
-/** \brief Check if time2 represents a time which is after time1 based on the current_time */
-static bool NANO_OS_TIMER_IsAfter(const uint32_t current_time, const uint32_t time1, const uint32_t time2);
+/** \brief Requeue a periodic timer according to its overrun policy (interrupts must be disabled) */
+static void NANO_OS_TIMER_Requeue(nano_os_timer_t* const timer);
+
+#if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+/** \brief Handle an elapsed timer in interrupt context (interrupts must be disabled) */
+static void NANO_OS_TIMER_HandleIsrContext(nano_os_timer_t* const timer, nano_os_int_status_reg_t* const int_status_reg);
+#endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
 
 
 
@@ -50,10 +70,11 @@ nano_os_error_t NANO_OS_TIMER_Init(const nano_os_port_init_data_t* const port_in
     /* Check parameters */
     if (port_init_data != NULL)
     {
-        /* Initialize started timer list */
-        g_nano_os.started_timers = NULL;
+        /* Initialize timer wheel */
+        (void)MEMSET(&g_nano_os.timer_wheel, 0, sizeof(nano_os_timer_wheel_t));
+        g_nano_os.timer_wheel.time = g_nano_os.handled_tick_count + 1u;
 
-        /* Create timer task */
+        /* Create the default timer service */
         (void)MEMSET(&task_init_data, 0, sizeof(nano_os_task_init_data_t));
         #if (NANO_OS_TASK_NAME_ENABLED == 1u)
         task_init_data.name = "Timer task";
@@ -61,26 +82,45 @@ nano_os_error_t NANO_OS_TIMER_Init(const nano_os_port_init_data_t* const port_in
         task_init_data.base_priority = NANO_OS_NUMBER_OF_PRIORITY_LEVELS - 2u;
         task_init_data.stack_origin = g_nano_os.timer_task_stack;
         task_init_data.stack_size = NANO_OS_TIMER_TASK_STACK_SIZE;
-        task_init_data.task_func = NANO_OS_TIMER_Task;
-        task_init_data.param = NULL;
         #if (NANO_OS_PORT_CONTAINS_TASK_DATA == 1u)
         (void)MEMCPY(&task_init_data.port_init_data, &port_init_data->timer_task_init_data, sizeof(nano_os_port_task_init_data_t));
         #endif /* (NANO_OS_PORT_CONTAINS_TASK_DATA == 1u) */
-        ret = NANO_OS_TASK_Create(&g_nano_os.timer_task, &task_init_data);
+        ret = NANO_OS_TIMER_InitService(&g_nano_os.timer_service, &task_init_data);
+    }
 
-        /* Init underlying wait object */
-        if (ret == NOS_ERR_SUCCESS)
-        {
-            ret = NANO_OS_WAIT_OBJECT_Initialize(&g_nano_os.timer_task_wait_object, WOT_TASK, QT_PRIORITY);
-        }
+    return ret;
+}
+
+
+#if (NANO_OS_TIMER_CREATESERVICE_ENABLED == 1u)
+
+/** \brief Create a new timer service */
+nano_os_error_t NANO_OS_TIMER_CreateService(nano_os_timer_service_t* const service, const nano_os_task_init_data_t* const task_init_data)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((service != NULL) && (task_init_data != NULL))
+    {
+        /* Initialize service and create its task */
+        ret = NANO_OS_TIMER_InitService(service, task_init_data);
     }
 
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
     return ret;
 }
 
+#endif /* (NANO_OS_TIMER_CREATESERVICE_ENABLED == 1u) */
+
 
-/** \brief Create a new timer */
-nano_os_error_t NANO_OS_TIMER_Create(nano_os_timer_t* const timer, const fp_nano_os_timer_callback_func_t callback, void* const user_data)
+/** \brief Create a new timer bound to a timer service */
+nano_os_error_t NANO_OS_TIMER_Create(nano_os_timer_t* const timer, const fp_nano_os_timer_callback_func_t callback, void* const user_data,
+                                     nano_os_timer_service_t* const service)
 {
     nano_os_error_t ret = NOS_ERR_INVALID_ARG;
 
@@ -97,6 +137,16 @@ nano_os_error_t NANO_OS_TIMER_Create(nano_os_timer_t* const timer, const fp_nano
         timer->callback = callback;
         timer->user_data = user_data;
 
+        /* Bind the timer to its service */
+        if (service != NULL)
+        {
+            timer->service = service;
+        }
+        else
+        {
+            timer->service = &g_nano_os.timer_service;
+        }
+
         #if (NANO_OS_TRACE_ENABLED == 1u)
         /* Global object id */
         timer->object_id = g_nano_os.next_object_id;
@@ -158,25 +208,24 @@ nano_os_error_t NANO_OS_TIMER_Start(nano_os_timer_t* const timer, const uint32_t
     /* Check parameters */
     if ((timer != NULL) && (first_due_time != 0u))
     {
-        nano_os_timer_t* current;
-
         /* Real time trace event */
         NANO_OS_TRACE_ADD(NOS_TRACE_TIMER_START, timer->object_id);
 
         /* Check if the timer is already started */
-        current = g_nano_os.started_timers;
-        while ((current != NULL) && (current != timer))
-        {
-            current = current->next;
-        }
-        if (current == NULL)
+        if (!NANO_OS_TIMER_IS_STARTED(timer))
         {
+            nano_os_int_status_reg_t int_status_reg;
+
             /* Configure timer */
             timer->has_elapsed = false;
             timer->period = period;
+            timer->overrun_count = 0u;
 
-            /* Add timer to the timer list */
-            NANO_OS_TIMER_Queue(timer, first_due_time);
+            /* Add timer to the timer wheel */
+            NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+            timer->timeout = g_nano_os.tick_count + first_due_time;
+            NANO_OS_TIMER_Schedule(timer, g_nano_os.timer_wheel.time);
+            NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
 
             ret = NOS_ERR_SUCCESS;
         }
@@ -203,39 +252,21 @@ nano_os_error_t NANO_OS_TIMER_Stop(nano_os_timer_t* const timer)
     /* Check parameters */
     if (timer != NULL)
     {
-        nano_os_timer_t* previous;
-        nano_os_timer_t* current;
-
         /* Real time trace event */
         NANO_OS_TRACE_ADD(NOS_TRACE_TIMER_STOP, timer->object_id);
 
         /* Check if the timer is already started */
-        previous = NULL;
-        current = g_nano_os.started_timers;
-        while ((current != NULL) && (current != timer))
-        {
-            previous = current;
-            current = current->next;
-        }
-        if (current != NULL)
+        if (NANO_OS_TIMER_IS_STARTED(timer))
         {
             nano_os_int_status_reg_t int_status_reg;
 
-            /* Remove timer from the timer list */
+            /* Remove timer from the timer wheel or from the elapsed timer list */
             NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
-            if (previous == NULL)
-            {
-                g_nano_os.started_timers = timer->next;
-            }
-            else
-            {
-                previous->next = timer->next;
-            }
+            NANO_OS_TIMER_Remove(timer);
             NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
 
             /* Update timer state */
             timer->period = 0u;
-            timer->next = NULL;
             timer->has_elapsed = false;
 
             ret = NOS_ERR_SUCCESS;
@@ -280,50 +311,217 @@ nano_os_error_t NANO_OS_TIMER_HasElapsed(nano_os_timer_t* const timer, bool* con
 }
 
 
+/** \brief Set the overrun policy of a timer */
+nano_os_error_t NANO_OS_TIMER_SetOverrunPolicy(nano_os_timer_t* const timer, const nano_os_timer_overrun_policy_t overrun_policy)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((timer != NULL) &&
+        ((overrun_policy == NOS_TIMER_OVERRUN_CATCH_UP) || (overrun_policy == NOS_TIMER_OVERRUN_SKIP)))
+    {
+        /* Save policy, it will be applied on the next requeue of the timer */
+        timer->overrun_policy = overrun_policy;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Get and reset the number of periods of a timer which have been handled late or skipped */
+nano_os_error_t NANO_OS_TIMER_GetOverrunCount(nano_os_timer_t* const timer, uint32_t* const overrun_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((timer != NULL) && (overrun_count != NULL))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Copy and reset overrun count, the timer task may be updating it */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        (*overrun_count) = timer->overrun_count;
+        timer->overrun_count = 0u;
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Set the slack of a timer */
+nano_os_error_t NANO_OS_TIMER_SetSlack(nano_os_timer_t* const timer, const uint32_t slack)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((timer != NULL) && (slack <= NANO_OS_TIMER_MAX_SLACK))
+    {
+        /* Save slack, it will be applied on the next start or requeue of the timer */
+        timer->slack = slack;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+
+/** \brief Select the context in which the callback of a timer is called */
+nano_os_error_t NANO_OS_TIMER_SetIsrContext(nano_os_timer_t* const timer, const bool isr_context)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (timer != NULL)
+    {
+        /* Save context, it will be used on the next expiry of the timer */
+        timer->isr_context = isr_context;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
+
+
 /** \brief Timer tick handler */
 nano_os_error_t NANO_OS_TIMER_TickHandler(void)
 {
+    nano_os_timer_wheel_t* const wheel = &g_nano_os.timer_wheel;
+    nano_os_timer_service_t* service;
+    const uint32_t end_time = g_nano_os.handled_tick_count + 1u;
 
-    /* Check if at least one timer is started */
-    if (g_nano_os.started_timers != NULL)
+    /* Handle all the ticks since the last call, a wheel without
+       any timer doesn't need to go through the empty slots */
+    while ((wheel->time != end_time) && (wheel->timer_count != 0u))
     {
-        /* Check if at least one timer has elapsed */
-        if (g_nano_os.started_timers->timeout == g_nano_os.tick_count)
+        NANO_OS_TIMER_WheelStep();
+    }
+    wheel->time = end_time;
+
+    /* Wake up the services for which at least one timer has elapsed */
+    service = wheel->services;
+    while (service != NULL)
+    {
+        if (service->wakeup_pending)
         {
             nano_os_error_t ret;
             uint32_t woke_up_task_count = 0;
 
+            service->wakeup_pending = false;
+
             /* Lock scheduling */
             NANO_OS_PORT_ATOMIC_INC32(g_nano_os.lock_count);
 
-            /* Wake up the timer task */
-            ret = NANO_OS_WAIT_OBJECT_Signal(&g_nano_os.timer_task_wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+            /* Update statistics */
+            wheel->stats.task_activation_count++;
+
+            /* Wake up the service task, if it is still handling
+               previous timers it will handle the new ones before waiting again */
+            ret = NANO_OS_WAIT_OBJECT_Signal(&service->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
             NANO_OS_ERROR_ASSERT_RET(ret);
-            NANO_OS_ERROR_ASSERT((woke_up_task_count != 0u), NOS_ERR_TIMER_TASK_OVERRUN);
 
             /* Unlock scheduling */
             NANO_OS_PORT_ATOMIC_DEC32(g_nano_os.lock_count);
         }
+        else
+        {
+            /* No timer has elapsed for this service */
+        }
+
+        service = service->next;
     }
 
     return NOS_ERR_SUCCESS;
 }
 
 
-/** \brief Timer task */
-static void* NANO_OS_TIMER_Task(void* const param)
+/** \brief Initialize a timer service and create its task */
+static nano_os_error_t NANO_OS_TIMER_InitService(nano_os_timer_service_t* const service, const nano_os_task_init_data_t* const task_init_data)
 {
     nano_os_error_t ret;
-    NANO_OS_UNUSED(param);
+
+    /* 0 init of the service */
+    (void)MEMSET(service, 0, sizeof(nano_os_timer_service_t));
+
+    /* Init underlying wait object before the task can run */
+    ret = NANO_OS_WAIT_OBJECT_Initialize(&service->wait_object, WOT_TASK, QT_PRIORITY);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_task_init_data_t service_task_init_data;
+
+        /* Add service to the service list */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        service->next = g_nano_os.timer_wheel.services;
+        g_nano_os.timer_wheel.services = service;
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        /* Create service task from a copy of the init data, the caller's one is left untouched */
+        (void)MEMCPY(&service_task_init_data, task_init_data, sizeof(nano_os_task_init_data_t));
+        service_task_init_data.task_func = NANO_OS_TIMER_Task;
+        service_task_init_data.param = service;
+        ret = NANO_OS_TASK_Create(&service->task, &service_task_init_data);
+    }
+
+    return ret;
+}
+
+
+/** \brief Timer service task */
+static void* NANO_OS_TIMER_Task(void* const param)
+{
+    nano_os_timer_service_t* const service = NANO_OS_CAST(nano_os_timer_service_t*, param);
 
     /* Task loop */
     while(true)
     {
+        nano_os_error_t ret = NOS_ERR_SUCCESS;
+
         /* Increment lock count as if it were a syscall */
         NANO_OS_PORT_ATOMIC_INC32(g_nano_os.lock_count);
 
-        /* Wait for a timer to elapse */
-        ret = NANO_OS_WAIT_OBJECT_Wait(&g_nano_os.timer_task_wait_object, 0xFFFFFFFFu);
+        /* Wait for a timer to elapse, the check is done with interrupts
+           disabled so that a timer elapsing meanwhile can't be missed */
+        NANO_OS_PORT_DISABLE_INTERRUPTS();
+        if (service->elapsed_timers == NULL)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Wait(&service->wait_object, 0xFFFFFFFFu);
+        }
+        NANO_OS_PORT_ENABLE_INTERRUPTS();
 
         /* Decrement lock count as if it were a syscall */
         NANO_OS_PORT_ATOMIC_DEC32(g_nano_os.lock_count);
@@ -331,24 +529,43 @@ static void* NANO_OS_TIMER_Task(void* const param)
         /* Check wait status */
         if (ret == NOS_ERR_SUCCESS)
         {
-            /* Handle elapsed timers */
-            uint32_t timer_timeout;
+            /* Handle elapsed timers in expiry order, including
+               the ones which have elapsed while the service task was busy */
             nano_os_timer_t* current;
+            nano_os_timer_stats_t* const stats = &g_nano_os.timer_wheel.stats;
 
             /* Disable interrupts */
             NANO_OS_PORT_DISABLE_INTERRUPTS();
 
-            /* Go through started timer to find elapsed timers */
-            current = g_nano_os.started_timers;
-            timer_timeout = current->timeout;
-            while ((current != NULL) && (current->timeout == g_nano_os.tick_count))
+            current = service->elapsed_timers;
+            while (current != NULL)
             {
-                /* Remove timer from timer list */
-                g_nano_os.started_timers = current->next;
+                /* Number of ticks since the expiry of the timer */
+                const uint32_t tick_debt = g_nano_os.tick_count - current->expiry;
+
+                /* Remove timer from elapsed timer list */
+                NANO_OS_TIMER_Remove(current);
 
                 /* Update timer state */
                 current->has_elapsed = true;
 
+                /* Report timer task overload in the statistics */
+                if (tick_debt != 0u)
+                {
+                    stats->late_expiration_count++;
+                    if (tick_debt > stats->max_tick_debt)
+                    {
+                        stats->max_tick_debt = tick_debt;
+                    }
+                }
+
+                /* Requeue timer if periodic, before calling the callback
+                   so that the callback is allowed to stop it */
+                if (current->period != 0u)
+                {
+                    NANO_OS_TIMER_Requeue(current);
+                }
+
                 /* Call user callback function if any */
                 if (current->callback != NULL)
                 {
@@ -368,19 +585,10 @@ static void* NANO_OS_TIMER_Task(void* const param)
                     NANO_OS_PORT_DISABLE_INTERRUPTS();
                 }
 
-                /* Requeue timer if periodic */
-                if (current->period != 0u)
-                {
-                    NANO_OS_TIMER_Queue(current, 0u);
-                }
-
                 /* Next timer */
-                current = g_nano_os.started_timers;
+                current = service->elapsed_timers;
             }
 
-            /* Check that timer handling did not take more than 1 tick */
-            NANO_OS_ERROR_ASSERT((timer_timeout == g_nano_os.tick_count), NOS_ERR_TIMER_TASK_OVERRUN);
-
             /* Enable interrupts */
             NANO_OS_PORT_ENABLE_INTERRUPTS();
         }
@@ -400,84 +608,287 @@ static void* NANO_OS_TIMER_Task(void* const param)
 }
 
 
-
-/** \brief Queue a timer to the started timer list */
-static void NANO_OS_TIMER_Queue(nano_os_timer_t* const timer, const uint32_t first_due_time)
+/** \brief Handle the next tick of the timer wheel */
+static void NANO_OS_TIMER_WheelStep(void)
 {
     nano_os_int_status_reg_t int_status_reg;
-    const uint32_t current_time = NANO_OS_PORT_ATOMIC_READ32(g_nano_os.tick_count);
-
-    /* Configure timeout */
-    if (first_due_time != 0u)
+    nano_os_timer_t** slot;
+    nano_os_timer_wheel_t* const wheel = &g_nano_os.timer_wheel;
+    const uint32_t time = wheel->time;
+    uint32_t expiration_count = 0u;
+    uint32_t level = 0u;
+    uint32_t shift = 0u;
+
+    /* When a level wraps around, cascade the corresponding slot of the upper level
+       into the lower levels, the interrupts are only disabled while moving one timer */
+    while ((level < (NANO_OS_TIMER_WHEEL_LEVEL_COUNT - 1u)) && (((time >> shift) & NANO_OS_TIMER_WHEEL_SLOT_MASK) == 0u))
     {
-        timer->timeout = current_time + first_due_time;
-    }
-    else
-    {
-        timer->timeout = current_time + timer->period;
-    }
+        level++;
+        shift += NANO_OS_TIMER_WHEEL_SLOT_BITS;
+        slot = &wheel->slots[level][(time >> shift) & NANO_OS_TIMER_WHEEL_SLOT_MASK];
 
-    /* Add timer to the timer list */
-    if (g_nano_os.started_timers == NULL)
-    {
         NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
-        timer->next = g_nano_os.started_timers;
-        g_nano_os.started_timers = timer;
+        while ((*slot) != NULL)
+        {
+            nano_os_timer_t* const timer = (*slot);
+            NANO_OS_TIMER_Remove(timer);
+            NANO_OS_TIMER_Insert(timer);
+
+            NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+            NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        }
         NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
     }
-    else
+
+    /* Move the timers of the current slot of the first level to the elapsed timer list */
+    slot = &wheel->slots[0u][time & NANO_OS_TIMER_WHEEL_SLOT_MASK];
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+    while ((*slot) != NULL)
     {
-        bool is_after;
-        nano_os_timer_t* previous = NULL;
-        nano_os_timer_t* current = g_nano_os.started_timers;
-        do
+        nano_os_timer_t* const timer = (*slot);
+        NANO_OS_TIMER_Remove(timer);
+        if (timer->expiry == time)
         {
-            is_after = NANO_OS_TIMER_IsAfter(current_time, timer->timeout, current->timeout);
-            if (!is_after)
+            expiration_count++;
+
+            #if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+            if (timer->isr_context)
             {
-                previous = current;
-                current = current->next;
+                /* Call the callback right now */
+                NANO_OS_TIMER_HandleIsrContext(timer, &int_status_reg);
+            }
+            else
+            #endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
+            {
+                /* Defer the callback to the service task */
+                NANO_OS_TIMER_AddElapsed(timer);
+                timer->service->wakeup_pending = true;
             }
-        }
-        while ((current != NULL) && (!is_after));
-
-        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
-        if (previous != NULL)
-        {
-            previous->next = timer;
-            timer->next = current;
         }
         else
         {
-            timer->next = g_nano_os.started_timers;
-            g_nano_os.started_timers = timer;
+            /* Timeout beyond the range of the wheel */
+            NANO_OS_TIMER_Insert(timer);
         }
+
         NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
     }
+
+    /* Update statistics, the timers elapsing on the same tick are handled by a single activation of their service task */
+    if (expiration_count != 0u)
+    {
+        wheel->stats.expiration_count += expiration_count;
+        wheel->stats.coalesced_expiration_count += expiration_count - 1u;
+    }
+
+    /* Next tick */
+    wheel->time = time + 1u;
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
 }
 
 
-/** \brief Check if time2 represents a time which is after time1 based on the current_time */
-static bool NANO_OS_TIMER_IsAfter(const uint32_t current_time, const uint32_t time1, const uint32_t time2)
+/** \brief Compute the expiry of a timer within its slack and insert it in the timer wheel (interrupts must be disabled) */
+static void NANO_OS_TIMER_Schedule(nano_os_timer_t* const timer, const uint32_t earliest_expiry)
 {
-    bool ret = false;
+    const uint32_t latest_expiry = timer->timeout + timer->slack;
 
-    if (time1 > current_time)
+    /* The timer can't elapse before the timer wheel handles its next tick */
+    timer->expiry = timer->timeout;
+    if (NANO_OS_CAST(int32_t, earliest_expiry - timer->expiry) > 0)
     {
-        if ((time2 > time1) || (time2 < current_time))
-        {
-            ret = true;
-        }
+        timer->expiry = earliest_expiry;
+    }
+
+    /* Align the expiry on the largest power of 2 boundary within the slack window, so that
+       independent timers with overlapping windows tend to elapse on the same tick */
+    if (NANO_OS_CAST(int32_t, latest_expiry - timer->expiry) > 0)
+    {
+        /* Mask of the bits below the highest bit which differs between both ends of the window */
+        uint32_t mask = timer->expiry ^ latest_expiry;
+        mask |= (mask >> 1u);
+        mask |= (mask >> 2u);
+        mask |= (mask >> 4u);
+        mask |= (mask >> 8u);
+        mask |= (mask >> 16u);
+        timer->expiry = latest_expiry & ~(mask >> 1u);
+    }
+
+    NANO_OS_TIMER_Insert(timer);
+}
+
+
+/** \brief Insert a timer in the timer wheel according to its expiry (interrupts must be disabled) */
+static void NANO_OS_TIMER_Insert(nano_os_timer_t* const timer)
+{
+    nano_os_timer_t** slot;
+    nano_os_timer_wheel_t* const wheel = &g_nano_os.timer_wheel;
+    uint32_t delta = timer->expiry - wheel->time;
+    uint32_t level = 0u;
+    uint32_t shift = 0u;
+    uint32_t max_delta;
+
+    /* Select the level covering the remaining time */
+    while ((level < (NANO_OS_TIMER_WHEEL_LEVEL_COUNT - 1u)) && ((delta >> (shift + NANO_OS_TIMER_WHEEL_SLOT_BITS)) != 0u))
+    {
+        level++;
+        shift += NANO_OS_TIMER_WHEEL_SLOT_BITS;
+    }
+
+    /* Expiries beyond the range of the wheel are put in the farthest slot of
+       the last level and will be inserted again when this slot is cascaded */
+    max_delta = (NANO_OS_TIMER_WHEEL_SLOT_MASK << shift) | ((1u << shift) - 1u);
+    if (delta > max_delta)
+    {
+        delta = max_delta;
+    }
+
+    /* Add timer at the head of the slot */
+    slot = &wheel->slots[level][((wheel->time + delta) >> shift) & NANO_OS_TIMER_WHEEL_SLOT_MASK];
+    timer->previous = NULL;
+    timer->next = (*slot);
+    if (timer->next != NULL)
+    {
+        timer->next->previous = timer;
+    }
+    timer->list = slot;
+    (*slot) = timer;
+    wheel->timer_count++;
+}
+
+
+/** \brief Remove a timer from its list (interrupts must be disabled) */
+static void NANO_OS_TIMER_Remove(nano_os_timer_t* const timer)
+{
+    if (timer->previous != NULL)
+    {
+        timer->previous->next = timer->next;
     }
     else
     {
-        if ((time2 > time1) && (time2 < current_time))
+        (*timer->list) = timer->next;
+    }
+    if (timer->next != NULL)
+    {
+        timer->next->previous = timer->previous;
+    }
+    if (timer->list != &timer->service->elapsed_timers)
+    {
+        g_nano_os.timer_wheel.timer_count--;
+    }
+    else if (timer->next == NULL)
+    {
+        timer->service->last_elapsed_timer = timer->previous;
+    }
+    else
+    {
+        /* Not the last elapsed timer */
+    }
+    timer->next = NULL;
+    timer->previous = NULL;
+    timer->list = NULL;
+}
+
+
+/** \brief Add a timer to the elapsed timer list according to its expiry (interrupts must be disabled) */
+static void NANO_OS_TIMER_AddElapsed(nano_os_timer_t* const timer)
+{
+    nano_os_timer_service_t* const service = timer->service;
+    nano_os_timer_t* previous = service->last_elapsed_timer;
+
+    /* Keep the list sorted by expiry, the timers coming from the wheel always go at the
+       end of the list, only the periodic timers catching up may have to be inserted before */
+    while ((previous != NULL) && (NANO_OS_CAST(int32_t, previous->expiry - timer->expiry) > 0))
+    {
+        previous = previous->previous;
+    }
+
+    /* Add timer after the previous one */
+    timer->previous = previous;
+    if (previous != NULL)
+    {
+        timer->next = previous->next;
+        previous->next = timer;
+    }
+    else
+    {
+        timer->next = service->elapsed_timers;
+        service->elapsed_timers = timer;
+    }
+    if (timer->next != NULL)
+    {
+        timer->next->previous = timer;
+    }
+    else
+    {
+        service->last_elapsed_timer = timer;
+    }
+    timer->list = &service->elapsed_timers;
+}
+
+
+/** \brief Requeue a periodic timer according to its overrun policy (interrupts must be disabled) */
+static void NANO_OS_TIMER_Requeue(nano_os_timer_t* const timer)
+{
+    nano_os_timer_wheel_t* const wheel = &g_nano_os.timer_wheel;
+    const uint32_t last_handled_time = wheel->time - 1u;
+
+    /* Next timeout is computed from the previous one so that the period doesn't drift */
+    timer->timeout += timer->period;
+
+    /* Check if the end of the next slack window has already been handled by the timer wheel */
+    if (NANO_OS_CAST(int32_t, last_handled_time - (timer->timeout + timer->slack)) >= 0)
+    {
+        if (timer->overrun_policy == NOS_TIMER_OVERRUN_SKIP)
+        {
+            /* Skip all the elapsed periods */
+            const uint32_t skipped_periods = ((last_handled_time - (timer->timeout + timer->slack)) / timer->period) + 1u;
+            timer->timeout += skipped_periods * timer->period;
+            timer->overrun_count += skipped_periods;
+            wheel->stats.skipped_period_count += skipped_periods;
+            NANO_OS_TIMER_Schedule(timer, wheel->time);
+        }
+        else
         {
-            ret = true;
+            /* Catch up, the timer will be handled again by the timer task
+               and is considered as late from the end of its slack window */
+            timer->overrun_count++;
+            timer->expiry = timer->timeout + timer->slack;
+            NANO_OS_TIMER_AddElapsed(timer);
         }
     }
+    else
+    {
+        NANO_OS_TIMER_Schedule(timer, wheel->time);
+    }
+}
 
-    return ret;
+
+#if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+
+/** \brief Handle an elapsed timer in interrupt context (interrupts must be disabled) */
+static void NANO_OS_TIMER_HandleIsrContext(nano_os_timer_t* const timer, nano_os_int_status_reg_t* const int_status_reg)
+{
+    /* Update timer state */
+    timer->has_elapsed = true;
+
+    /* Requeue timer if periodic, after the tick being handled since
+       the slack may have delayed the expiry beyond the next timeout */
+    if (timer->period != 0u)
+    {
+        timer->timeout += timer->period;
+        NANO_OS_TIMER_Schedule(timer, g_nano_os.timer_wheel.time + 1u);
+    }
+
+    /* Call user callback function if any, with interrupts enabled */
+    if (timer->callback != NULL)
+    {
+        NANO_OS_PORT_LEAVE_CRITICAL(*int_status_reg);
+        timer->callback(timer, timer->user_data);
+        NANO_OS_PORT_ENTER_CRITICAL(*int_status_reg);
+    }
 }
 
+#endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
+
 #endif /* (NANO_OS_TIMER_ENABLED == 1u) */
@@ -22,6 +22,7 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "nano_os_types.h"
 #include "nano_os_port.h"
+#include "nano_os_task.h"
 
 /* Check if module is enabled */
 #if (NANO_OS_TIMER_ENABLED == 1u)
@@ -33,14 +34,40 @@ extern "C"
 #endif /* __cplusplus */
 
 
+/** \brief Number of slots in each level of the timer wheel */
+#define NANO_OS_TIMER_WHEEL_SLOT_COUNT      (1u << NANO_OS_TIMER_WHEEL_SLOT_BITS)
+
+/** \brief Mask to get the slot index in a level of the timer wheel */
+#define NANO_OS_TIMER_WHEEL_SLOT_MASK       (NANO_OS_TIMER_WHEEL_SLOT_COUNT - 1u)
+
+/** \brief Maximum slack of a timer in number of ticks */
+#define NANO_OS_TIMER_MAX_SLACK             0x7FFFFFFFu
+
+/** \brief Check if a timer is started (queued in the timer wheel or waiting to be handled by the timer task) */
+#define NANO_OS_TIMER_IS_STARTED(timer)     ((timer)->list != NULL)
+
+
 /** \brief Nano OS timer pre-declaration */
 struct _nano_os_timer_t;
 
+/** \brief Nano OS timer service pre-declaration */
+struct _nano_os_timer_service_t;
+
 
 /** \brief Nano OS timer callback function */
 typedef void (*fp_nano_os_timer_callback_func_t)(struct _nano_os_timer_t* const timer, void* const user_data);
 
 
+/** \brief Policy applied to a periodic timer when the timer task handles it after its next period has already elapsed */
+typedef enum _nano_os_timer_overrun_policy_t
+{
+    /** \brief Fire the timer once for each elapsed period, in order (default) */
+    NOS_TIMER_OVERRUN_CATCH_UP = 0,
+    /** \brief Skip the elapsed periods and fire the timer on the next period to come */
+    NOS_TIMER_OVERRUN_SKIP = 1
+} nano_os_timer_overrun_policy_t;
+
+
 /** \brief Nano OS timer */
 typedef struct _nano_os_timer_t
 {
@@ -48,14 +75,32 @@ typedef struct _nano_os_timer_t
     uint32_t period;
     /** \brief Timeout */
     uint32_t timeout;
+    /** \brief Maximum number of ticks the expiry may be delayed to be coalesced with other timers */
+    uint32_t slack;
+    /** \brief Tick at which the timer wheel elapses the timer (timeout aligned within the slack) */
+    uint32_t expiry;
     /** \brief Callback */
     fp_nano_os_timer_callback_func_t callback;
     /** \brief User data */
     void* user_data;
     /** \brief Next timer */
     struct _nano_os_timer_t* next;
+    /** \brief Previous timer */
+    struct _nano_os_timer_t* previous;
+    /** \brief List containing the timer (NULL if the timer is stopped) */
+    struct _nano_os_timer_t** list;
+    /** \brief Timer service calling the callback */
+    struct _nano_os_timer_service_t* service;
     /** \brief Indicate if the timer has elapsed */
     bool has_elapsed;
+    /** \brief Overrun policy of a periodic timer */
+    nano_os_timer_overrun_policy_t overrun_policy;
+    /** \brief Number of periods which have been handled late or skipped */
+    uint32_t overrun_count;
+    #if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+    /** \brief Indicate if the callback is called from the tick interrupt context instead of the timer task */
+    bool isr_context;
+    #endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
 
     #if (NANO_OS_TRACE_ENABLED == 1u)
     /** \brief Global object id affected by Nano-OS */
@@ -64,12 +109,84 @@ typedef struct _nano_os_timer_t
 } nano_os_timer_t;
 
 
+/** \brief Nano OS timer statistics */
+typedef struct _nano_os_timer_stats_t
+{
+    /** \brief Number of timers handled by the timer task after their timeout tick */
+    uint32_t late_expiration_count;
+    /** \brief Number of periods skipped by the periodic timers with the skip overrun policy */
+    uint32_t skipped_period_count;
+    /** \brief Maximum number of ticks between the timeout of a timer and its handling by the timer task */
+    uint32_t max_tick_debt;
+    /** \brief Number of timer expiries */
+    uint32_t expiration_count;
+    /** \brief Number of expiries which have shared their tick with a previous expiry */
+    uint32_t coalesced_expiration_count;
+    /** \brief Number of timer task activations */
+    uint32_t task_activation_count;
+} nano_os_timer_stats_t;
+
+
+/** \brief Nano OS timer service
+ *         Task handling the elapsed timers bound to the service, each
+ *         service has its own elapsed timer list so that the timers
+ *         of a service are not delayed by the callbacks of the services
+ *         with a lower priority
+ */
+typedef struct _nano_os_timer_service_t
+{
+    /** \brief Elapsed timers waiting to be handled by the service task, in expiry order */
+    nano_os_timer_t* elapsed_timers;
+    /** \brief Last elapsed timer waiting to be handled by the service task */
+    nano_os_timer_t* last_elapsed_timer;
+    /** \brief Indicate if the service task must be woken up at the end of the tick handling */
+    bool wakeup_pending;
+    /** \brief Wait object to signal the service task */
+    nano_os_wait_object_t wait_object;
+    /** \brief Service task context */
+    nano_os_task_t task;
+    /** \brief Next timer service */
+    struct _nano_os_timer_service_t* next;
+} nano_os_timer_service_t;
+
+
+/** \brief Nano OS hierarchical timer wheel
+ *         Level n holds the timers which elapse in less than
+ *         NANO_OS_TIMER_WHEEL_SLOT_COUNT^(n+1) ticks, its slots are
+ *         cascaded into the lower levels when the lower level wraps around
+ */
+typedef struct _nano_os_timer_wheel_t
+{
+    /** \brief Timer lists of each slot of each level */
+    nano_os_timer_t* slots[NANO_OS_TIMER_WHEEL_LEVEL_COUNT][NANO_OS_TIMER_WHEEL_SLOT_COUNT];
+    /** \brief Timer services */
+    nano_os_timer_service_t* services;
+    /** \brief Next tick to be handled by the wheel */
+    uint32_t time;
+    /** \brief Number of timers in the wheel slots */
+    uint32_t timer_count;
+    /** \brief Timer statistics */
+    nano_os_timer_stats_t stats;
+} nano_os_timer_wheel_t;
+
+
 
 /** \brief Initialize the timer module */
 nano_os_error_t NANO_OS_TIMER_Init(const nano_os_port_init_data_t* const port_init_data);
 
-/** \brief Create a new timer */
-nano_os_error_t NANO_OS_TIMER_Create(nano_os_timer_t* const timer, const fp_nano_os_timer_callback_func_t callback, void* const user_data);
+#if (NANO_OS_TIMER_CREATESERVICE_ENABLED == 1u)
+
+/** \brief Create a new timer service
+ *         The task function and parameter of the task init data are ignored and replaced by the timer module,
+ *         on the ports with memory protection the service task must be priviledged
+ */
+nano_os_error_t NANO_OS_TIMER_CreateService(nano_os_timer_service_t* const service, const nano_os_task_init_data_t* const task_init_data);
+
+#endif /* (NANO_OS_TIMER_CREATESERVICE_ENABLED == 1u) */
+
+/** \brief Create a new timer bound to a timer service (NULL for the default timer service) */
+nano_os_error_t NANO_OS_TIMER_Create(nano_os_timer_t* const timer, const fp_nano_os_timer_callback_func_t callback, void* const user_data,
+                                     nano_os_timer_service_t* const service);
 
 #if (NANO_OS_TIMER_DESTROY_ENABLED == 1u)
 
@@ -87,6 +204,28 @@ nano_os_error_t NANO_OS_TIMER_Stop(nano_os_timer_t* const timer);
 /** \brief Check if a timer has elapsed */
 nano_os_error_t NANO_OS_TIMER_HasElapsed(nano_os_timer_t* const timer, bool* const has_elapsed);
 
+/** \brief Set the overrun policy of a timer */
+nano_os_error_t NANO_OS_TIMER_SetOverrunPolicy(nano_os_timer_t* const timer, const nano_os_timer_overrun_policy_t overrun_policy);
+
+/** \brief Get and reset the number of periods of a timer which have been handled late or skipped */
+nano_os_error_t NANO_OS_TIMER_GetOverrunCount(nano_os_timer_t* const timer, uint32_t* const overrun_count);
+
+/** \brief Set the slack of a timer
+ *         The timer may elapse up to slack ticks after its timeout so that
+ *         it can be handled in the same timer task activation as other timers
+ */
+nano_os_error_t NANO_OS_TIMER_SetSlack(nano_os_timer_t* const timer, const uint32_t slack);
+
+#if (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u)
+
+/** \brief Select the context in which the callback of a timer is called
+ *         In interrupt context, the callback is called from the tick handling as soon as the timer
+ *         elapses, it must be short and must only use the system calls allowed in interrupt handlers
+ */
+nano_os_error_t NANO_OS_TIMER_SetIsrContext(nano_os_timer_t* const timer, const bool isr_context);
+
+#endif /* (NANO_OS_TIMER_ISR_CALLBACK_ENABLED == 1u) */
+
 
 /** \brief Timer tick handler */
 nano_os_error_t NANO_OS_TIMER_TickHandler(void);
@@ -70,6 +70,9 @@ typedef enum _nano_os_trace_event_type_t
     NOS_TRACE_TASK_START = 10u,
     NOS_TRACE_TASK_SLEEP = 11u,
     NOS_TRACE_TASK_JOIN = 12u,
+    NOS_TRACE_TASK_NOTIFY = 13u,
+    NOS_TRACE_TASK_NOTIFY_ISR = 14u,
+    NOS_TRACE_TASK_NOTIFY_WAIT = 15u,
 
     /* Semaphore events */
     NOS_TRACE_SEMAPHORE_WAIT = 20u,
@@ -94,6 +97,12 @@ typedef enum _nano_os_trace_event_type_t
     NOS_TRACE_MAILBOX_POST = 51u,
     NOS_TRACE_MAILBOX_POST_ISR = 52u,
     NOS_TRACE_MAILBOX_GETCOUNT = 53u,
+    NOS_TRACE_MAILBOX_COMMIT = 54u,
+    NOS_TRACE_MAILBOX_COMMIT_ISR = 55u,
+    NOS_TRACE_MAILBOX_RECEIVE = 56u,
+    NOS_TRACE_MAILBOX_POST_MANY = 57u,
+    NOS_TRACE_MAILBOX_WAIT_MANY = 58u,
+    NOS_TRACE_MAILBOX_POST_URGENT = 59u,
 
     /* Condition variable events */
     NOS_TRACE_COND_VAR_WAIT = 60u,
@@ -109,6 +118,10 @@ typedef enum _nano_os_trace_event_type_t
     NOS_TRACE_WAITABLE_TIMER_STOP = 81u,
     NOS_TRACE_WAITABLE_TIMER_WAIT = 82u,
 
+    /* Blackboard events */
+    NOS_TRACE_BLACKBOARD_PUBLISH = 90u,
+    NOS_TRACE_BLACKBOARD_WAIT = 91u,
+
 
     /* Scheduler events */
     NOS_TRACE_SCHEDULER_START = 100u,
@@ -119,6 +132,36 @@ typedef enum _nano_os_trace_event_type_t
     NOS_TRACE_INTERRUPT_ENTRY = 110u,
     NOS_TRACE_INTERRUPT_EXIT = 111u,
 
+    /* Channel events */
+    NOS_TRACE_CHANNEL_SEND = 120u,
+    NOS_TRACE_CHANNEL_RECEIVE = 121u,
+    NOS_TRACE_CHANNEL_REPLY = 122u,
+
+    /* Stream buffer events */
+    NOS_TRACE_STREAM_BUFFER_WRITE = 130u,
+    NOS_TRACE_STREAM_BUFFER_WRITE_ISR = 131u,
+    NOS_TRACE_STREAM_BUFFER_READ = 132u,
+    NOS_TRACE_STREAM_BUFFER_WAIT = 133u,
+
+    /* Message buffer events */
+    NOS_TRACE_MESSAGE_BUFFER_SEND = 140u,
+    NOS_TRACE_MESSAGE_BUFFER_RECEIVE = 141u,
+
+    /* Work queue events */
+    NOS_TRACE_WORKQUEUE_QUEUE = 150u,
+    NOS_TRACE_WORKQUEUE_CANCEL = 151u,
+    NOS_TRACE_WORKQUEUE_FLUSH = 152u,
+
+    /* High resolution timer events */
+    NOS_TRACE_HR_TIMER_START = 160u,
+    NOS_TRACE_HR_TIMER_STOP = 161u,
+
+    /* Memory pool events */
+    NOS_TRACE_MEM_POOL_ALLOCATE = 170u,
+    NOS_TRACE_MEM_POOL_ALLOCATE_ISR = 171u,
+    NOS_TRACE_MEM_POOL_FREE = 172u,
+    NOS_TRACE_MEM_POOL_FREE_ISR = 173u,
+
     /* User events */
     NOS_TRACE_USER_EVENT_0 = 200u,
     NOS_TRACE_USER_EVENT_31 = 231u
@@ -287,10 +287,17 @@ static nano_os_error_t NANO_OS_WAIT_OBJECT_WakeUpTasks(nano_os_wait_object_t* co
                 last_requeued_task = task;
             }
 
-            /* Get next task */
-            task = NANO_OS_TASK_LIST_PopTask(&wait_object->waiting_tasks);
+            /* Get next task, the other tasks must stay in the queue if only one task is signaled */
+            if (signal_all_tasks)
+            {
+                task = NANO_OS_TASK_LIST_PopTask(&wait_object->waiting_tasks);
+            }
+            else
+            {
+                task = NULL;
+            }
         }
-        while ((task != NULL) && signal_all_tasks);
+        while (task != NULL);
 
         /* Put the tasks which have not been woken back into the task queue */
         if (last_requeued_task != NULL)
@@ -59,9 +59,29 @@ typedef enum _nano_os_wait_object_type_t
     /** \brief Mailbox */
     WOT_MAILBOX = 6u,
     /** \brief Flag set */
-    WOT_FLAG_SET = 7u
+    WOT_FLAG_SET = 7u,
+    /** \brief Blackboard */
+    WOT_BLACKBOARD = 8u,
+    /** \brief Channel */
+    WOT_CHANNEL = 9u,
+    /** \brief Stream buffer */
+    WOT_STREAM_BUFFER = 10u,
+    /** \brief Message buffer */
+    WOT_MESSAGE_BUFFER = 11u,
+    /** \brief Work queue */
+    WOT_WORKQUEUE = 12u,
+    /** \brief Memory pool */
+    WOT_MEM_POOL = 13u,
+
+    /** \brief Senders of a mailbox (internal, part of the mailbox) */
+    WOT_MAILBOX_SENDERS = 14u,
+    /** \brief Senders of a message buffer (internal, part of the message buffer) */
+    WOT_MESSAGE_BUFFER_SENDERS = 15u
 } nano_os_wait_object_type_t;
 
+/** \brief Indicate if a wait object is an internal part of another OS object */
+#define NANO_OS_WAIT_OBJECT_IS_INTERNAL(wait_object) ((wait_object)->type >= WOT_MAILBOX_SENDERS)
+
 
 /** \brief Queuing type */
 typedef enum _nano_os_queuing_type_t
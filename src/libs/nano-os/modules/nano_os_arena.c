@@ -0,0 +1,229 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_arena.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_ARENA_ENABLED == 1u)
+
+#include "nano_os_tools.h"
+
+#if (NANO_OS_ARENA_HEAP_ENABLED == 1u)
+#include "nano_os_heap.h"
+#endif /* (NANO_OS_ARENA_HEAP_ENABLED == 1u) */
+
+
+/** \brief Round up a size to the alignment of the arena allocations */
+#define NANO_OS_ARENA_ALIGN(size)   (((size) + (NANO_OS_ARENA_ALIGNMENT - 1u)) & ~(NANO_OS_CAST(size_t, NANO_OS_ARENA_ALIGNMENT) - 1u))
+
+
+
+
+/** \brief Create a new arena in a buffer */
+nano_os_error_t NANO_OS_ARENA_Create(nano_os_arena_t* const arena, void* const buffer, const size_t size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((arena != NULL) && (buffer != NULL))
+    {
+        /* Align the start of the buffer */
+        const size_t align_size = NANO_OS_ARENA_ALIGN(NANO_OS_CAST(size_t, buffer)) - NANO_OS_CAST(size_t, buffer);
+        if (size > align_size)
+        {
+            /* 0 init of arena */
+            (void)MEMSET(arena, 0, sizeof(nano_os_arena_t));
+
+            /* Initialize arena data, the usable size is rounded down so that the end of the buffer is never crossed */
+            arena->buffer = NANO_OS_CAST(uint8_t*, buffer) + align_size;
+            arena->size = (size - align_size) & ~(NANO_OS_CAST(size_t, NANO_OS_ARENA_ALIGNMENT) - 1u);
+            arena->offset = 0u;
+
+            ret = NOS_ERR_SUCCESS;
+        }
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_ARENA_HEAP_ENABLED == 1u)
+
+/** \brief Create a new arena in a buffer allocated from the heap */
+nano_os_error_t NANO_OS_ARENA_CreateFromHeap(nano_os_arena_t* const arena, const size_t size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((arena != NULL) && (size != 0u))
+    {
+        /* Allocate the buffer, with room to align its start */
+        void* const heap_buffer = NANO_OS_HEAP_Alloc(size + (NANO_OS_ARENA_ALIGNMENT - 1u));
+        if (heap_buffer != NULL)
+        {
+            ret = NANO_OS_ARENA_Create(arena, heap_buffer, size + (NANO_OS_ARENA_ALIGNMENT - 1u));
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                arena->heap_buffer = heap_buffer;
+            }
+            #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+            else
+            {
+                NANO_OS_HEAP_Free(heap_buffer);
+            }
+            #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+        }
+        else
+        {
+            ret = NOS_ERR_FAILURE;
+        }
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_ARENA_HEAP_ENABLED == 1u) */
+
+
+/** \brief Destroy an arena (the buffer is given back to the heap if it has been allocated from it) */
+nano_os_error_t NANO_OS_ARENA_Destroy(nano_os_arena_t* const arena)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((arena != NULL) && (arena->buffer != NULL))
+    {
+        #if ((NANO_OS_ARENA_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_FREE_ENABLED == 1u))
+        /* Give the buffer back to the heap */
+        if (arena->heap_buffer != NULL)
+        {
+            NANO_OS_HEAP_Free(arena->heap_buffer);
+        }
+        #endif /* ((NANO_OS_ARENA_HEAP_ENABLED == 1u) && (NANO_OS_HEAP_FREE_ENABLED == 1u)) */
+
+        /* Invalidate arena */
+        (void)MEMSET(arena, 0, sizeof(nano_os_arena_t));
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Allocate memory from an arena */
+void* NANO_OS_ARENA_Alloc(nano_os_arena_t* const arena, const size_t size)
+{
+    void* mem = NULL;
+
+    /* Check parameters */
+    if ((arena != NULL) && (size != 0u))
+    {
+        /* Move the allocation offset forward if there is enough room left */
+        const size_t allocate_size = NANO_OS_ARENA_ALIGN(size);
+        if ((allocate_size >= size) && (allocate_size <= (arena->size - arena->offset)))
+        {
+            mem = &arena->buffer[arena->offset];
+            arena->offset += allocate_size;
+
+            #if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+            /* Update stats */
+            if (arena->offset > arena->high_water_mark)
+            {
+                arena->high_water_mark = arena->offset;
+            }
+            #endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+        }
+    }
+
+    return mem;
+}
+
+
+/** \brief Get a mark on the current position of an arena */
+nano_os_error_t NANO_OS_ARENA_GetMark(const nano_os_arena_t* const arena, nano_os_arena_mark_t* const mark)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((arena != NULL) && (mark != NULL))
+    {
+        (*mark) = arena->offset;
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Release all the memory allocated from an arena since a mark has been taken */
+nano_os_error_t NANO_OS_ARENA_Rewind(nano_os_arena_t* const arena, const nano_os_arena_mark_t mark)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters, the mark must not be ahead of the current position */
+    if ((arena != NULL) && (mark <= arena->offset))
+    {
+        arena->offset = mark;
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Release all the memory allocated from an arena */
+nano_os_error_t NANO_OS_ARENA_Reset(nano_os_arena_t* const arena)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if (arena != NULL)
+    {
+        arena->offset = 0u;
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+
+/** \brief Get the statistics of an arena */
+nano_os_error_t NANO_OS_ARENA_GetStats(const nano_os_arena_t* const arena, nano_os_arena_stats_t* const stats)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((arena != NULL) && (stats != NULL))
+    {
+        stats->size = arena->size;
+        stats->used = arena->offset;
+        stats->high_water_mark = arena->high_water_mark;
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+
+
+#endif /* (NANO_OS_ARENA_ENABLED == 1u) */
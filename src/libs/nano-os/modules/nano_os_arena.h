@@ -0,0 +1,122 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_ARENA_H
+#define NANO_OS_ARENA_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_ARENA_ENABLED == 1u)
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Nano OS arena
+ *         Memory is allocated by moving a pointer forward in a buffer
+ *         and is released all at once by rewinding the pointer to a mark
+ *         or by resetting the arena.
+ *         An arena is not protected against concurrent accesses and must
+ *         be used by a single task at a time.
+ */
+typedef struct _nano_os_arena_t
+{
+    /** \brief Start of the arena buffer */
+    uint8_t* buffer;
+    /** \brief Size of the arena buffer in bytes */
+    size_t size;
+    /** \brief Offset of the next allocation in the arena buffer */
+    size_t offset;
+    #if (NANO_OS_ARENA_HEAP_ENABLED == 1u)
+    /** \brief Buffer allocated from the heap (NULL if the arena buffer has been given at creation) */
+    void* heap_buffer;
+    #endif /* (NANO_OS_ARENA_HEAP_ENABLED == 1u) */
+    #if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+    /** \brief Highest offset reached since the creation of the arena */
+    size_t high_water_mark;
+    #endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+} nano_os_arena_t;
+
+
+/** \brief Arena mark : position to rewind the arena to */
+typedef size_t nano_os_arena_mark_t;
+
+
+#if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+
+/** \brief Arena statistics */
+typedef struct _nano_os_arena_stats_t
+{
+    /** \brief Usable size in bytes */
+    size_t size;
+    /** \brief Allocated size in bytes */
+    size_t used;
+    /** \brief Maximum allocated size in bytes since the creation of the arena */
+    size_t high_water_mark;
+} nano_os_arena_stats_t;
+
+#endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+
+
+
+
+/** \brief Create a new arena in a buffer */
+nano_os_error_t NANO_OS_ARENA_Create(nano_os_arena_t* const arena, void* const buffer, const size_t size);
+
+#if (NANO_OS_ARENA_HEAP_ENABLED == 1u)
+
+/** \brief Create a new arena in a buffer allocated from the heap */
+nano_os_error_t NANO_OS_ARENA_CreateFromHeap(nano_os_arena_t* const arena, const size_t size);
+
+#endif /* (NANO_OS_ARENA_HEAP_ENABLED == 1u) */
+
+/** \brief Destroy an arena (the buffer is given back to the heap if it has been allocated from it) */
+nano_os_error_t NANO_OS_ARENA_Destroy(nano_os_arena_t* const arena);
+
+/** \brief Allocate memory from an arena */
+void* NANO_OS_ARENA_Alloc(nano_os_arena_t* const arena, const size_t size);
+
+/** \brief Get a mark on the current position of an arena */
+nano_os_error_t NANO_OS_ARENA_GetMark(const nano_os_arena_t* const arena, nano_os_arena_mark_t* const mark);
+
+/** \brief Release all the memory allocated from an arena since a mark has been taken */
+nano_os_error_t NANO_OS_ARENA_Rewind(nano_os_arena_t* const arena, const nano_os_arena_mark_t mark);
+
+/** \brief Release all the memory allocated from an arena */
+nano_os_error_t NANO_OS_ARENA_Reset(nano_os_arena_t* const arena);
+
+#if (NANO_OS_ARENA_GETSTATS_ENABLED == 1u)
+
+/** \brief Get the statistics of an arena */
+nano_os_error_t NANO_OS_ARENA_GetStats(const nano_os_arena_t* const arena, nano_os_arena_stats_t* const stats);
+
+#endif /* (NANO_OS_ARENA_GETSTATS_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_ARENA_ENABLED == 1u) */
+
+#endif /* NANO_OS_ARENA_H */
@@ -27,6 +27,7 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #include "nano_os_user.h"
 #include "nano_os_tools.h"
 #include "nano_os_stats.h"
+#include "nano_os_heap.h"
 
 /** \brief Total size in bytes of a debug request :
  *         Header : 2
@@ -157,9 +158,17 @@ static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectCountHandler(const nano_os_deb
 static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectListHandler(const nano_os_debug_request_t* const request);
 /** \brief Handler for the get information on an object request */
 static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectInfoHandler(const nano_os_debug_request_t* const request);
+/** \brief Get the number of wait objects which are not internal parts of another object */
+static uint16_t NANO_OS_DEBUG_GetWaitObjectCount(void);
 #endif /* (NANO_OS_DEBUG_WAIT_OBJECT_REQS_ENABLED == 1u) */
 
 
+#if (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u)
+/** \brief Handler for the get heap information request */
+static nano_os_error_t NANO_OS_DEBUG_GetHeapInfoHandler(const nano_os_debug_request_t* const request);
+#endif /* (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u) */
+
+
 #if (NANO_OS_DEBUG_MEMORY_REQS_ENABLED == 1u)
 /** \brief Handler for the read data from a memory address request */
 static nano_os_error_t NANO_OS_DEBUG_ReadDataHandler(const nano_os_debug_request_t* const request);
@@ -411,6 +420,18 @@ static void* NANO_OS_DEBUG_Task(void* const param)
                     #endif /* (NANO_OS_DEBUG_WAIT_OBJECT_REQS_ENABLED == 1u) */
 
 
+                    #if (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u)
+
+                    case NDC_GET_HEAP_INFO:
+                    {
+                        /* Get information on a heap memory region */
+                        ret = NANO_OS_DEBUG_GetHeapInfoHandler(&request);
+                    }
+                    break;
+
+                    #endif /* (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u) */
+
+
                     #if (NANO_OS_DEBUG_MEMORY_REQS_ENABLED == 1u)
 
                     case NDC_READ_DATA:
@@ -721,7 +742,7 @@ static nano_os_error_t NANO_OS_DEBUG_GetTaskInfoHandler(const nano_os_debug_requ
 
             /* Send base priority */
             ret = NANO_OS_DEBUG_SerializeU8(task->base_priority);
-
+
             /* Send stack informations */
             #if (NANO_OS_STATS_GETSTACKUSAGE_ENABLED == 1u)
             ret |= NANO_OS_STATS_GetStackUsage(task, &stack_size_left, &stack_size);
@@ -764,7 +785,7 @@ static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectCountHandler(const nano_os_deb
     if (ret == NOS_ERR_SUCCESS)
     {
         /* Send wait object count */
-        ret = NANO_OS_DEBUG_SerializeU16(g_nano_os.wait_object_count);
+        ret = NANO_OS_DEBUG_SerializeU16(NANO_OS_DEBUG_GetWaitObjectCount());
     }
 
     return ret;
@@ -778,7 +799,7 @@ static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectListHandler(const nano_os_debu
     nano_os_wait_object_t* wait_object = g_nano_os.wait_objects;
 
     /* Compute total size */
-    total_size = g_nano_os.wait_object_count * sizeof(uint16_t);
+    total_size = NANO_OS_DEBUG_GetWaitObjectCount() * sizeof(uint16_t);
 
     do
     {
@@ -798,7 +819,13 @@ static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectListHandler(const nano_os_debu
         {
             do
             {
-                /* Send task id */
+                /* Skip the wait objects which are internal parts of another object */
+                while (NANO_OS_WAIT_OBJECT_IS_INTERNAL(wait_object))
+                {
+                    wait_object = wait_object->next;
+                }
+
+                /* Send object id */
                 ret = NANO_OS_DEBUG_SerializeU16(wait_object->object_id);
 
                 /* Next object */
@@ -823,7 +850,7 @@ static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectInfoHandler(const nano_os_debu
     /* Look for the requested wait object */
     while ((wait_object != NULL) && !found)
     {
-        if (wait_object->object_id == request->param1)
+        if ((wait_object->object_id == request->param1) && !NANO_OS_WAIT_OBJECT_IS_INTERNAL(wait_object))
         {
             found = true;
         }
@@ -870,9 +897,79 @@ static nano_os_error_t NANO_OS_DEBUG_GetWaitObjectInfoHandler(const nano_os_debu
     return ret;
 }
 
+/** \brief Get the number of wait objects which are not internal parts of another object */
+static uint16_t NANO_OS_DEBUG_GetWaitObjectCount(void)
+{
+    uint16_t count = 0u;
+    const nano_os_wait_object_t* wait_object = g_nano_os.wait_objects;
+
+    while (wait_object != NULL)
+    {
+        if (!NANO_OS_WAIT_OBJECT_IS_INTERNAL(wait_object))
+        {
+            count++;
+        }
+        wait_object = wait_object->next;
+    }
+
+    return count;
+}
+
 #endif /* (NANO_OS_DEBUG_WAIT_OBJECT_REQS_ENABLED == 1u) */
 
 
+#if (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u)
+
+/** \brief Handler for the get heap information request */
+static nano_os_error_t NANO_OS_DEBUG_GetHeapInfoHandler(const nano_os_debug_request_t* const request)
+{
+    nano_os_error_t ret;
+    uint32_t region_count = 0u;
+    nano_os_heap_region_info_t region_info;
+
+    /* Get the requested memory region */
+    (void)NANO_OS_HEAP_GetRegionCount(&region_count);
+    ret = NANO_OS_HEAP_GetRegionInfo(request->param1, &region_info);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        /* Compute response size */
+        const uint8_t name_len = NANO_OS_CAST(uint8_t, STRNLEN(region_info.name, 200u));
+        const uint16_t total_size = 2u * sizeof(uint8_t) + 6u * sizeof(uint32_t) + (sizeof(uint8_t) + name_len);
+
+        /* Send response header */
+        ret = NANO_OS_DEBUG_SendResponse(request, NOS_ERR_SUCCESS, total_size, false);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Send number of regions and attributes */
+            ret = NANO_OS_DEBUG_SerializeU8(NANO_OS_CAST(uint8_t, region_count));
+            ret |= NANO_OS_DEBUG_SerializeU8(NANO_OS_CAST(uint8_t, region_info.attributes));
+
+            /* Send memory area */
+            ret |= NANO_OS_DEBUG_SerializeU32(NANO_OS_CAST(uint32_t, region_info.start));
+            ret |= NANO_OS_DEBUG_SerializeU32(region_info.size);
+
+            /* Send statistics */
+            ret |= NANO_OS_DEBUG_SerializeU32(region_info.stats.allocated_memory);
+            ret |= NANO_OS_DEBUG_SerializeU32(region_info.stats.allocated_blocks);
+            ret |= NANO_OS_DEBUG_SerializeU32(region_info.stats.free_memory);
+            ret |= NANO_OS_DEBUG_SerializeU32(region_info.stats.free_blocks);
+
+            /* Send name */
+            ret |= NANO_OS_DEBUG_SerializeString(region_info.name, name_len);
+        }
+    }
+    else
+    {
+        /* Memory region doesn't exist */
+        ret = NANO_OS_DEBUG_SendErrorResponse(request, ret);
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_DEBUG_HEAP_REQS_ENABLED == 1u) */
+
+
 #if (NANO_OS_DEBUG_MEMORY_REQS_ENABLED == 1u)
 
 /** \brief Handler for the read data from a memory address request */
@@ -35,6 +35,16 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Minimum allocation size in bytes (to preserve memory alignment) */
 #define NANO_OS_HEAP_MIN_ALLOC_SIZE             4u
 
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+
+/** \brief Magic number for the start of a block held by a size class cache */
+#define NANO_OS_HEAP_CACHED_START_MAGIC         0xCAC4EB10u
+
+/** \brief Link to the next block of a cache, stored in the data area of a cached block */
+#define NANO_OS_HEAP_CACHE_NEXT(block)          (*NANO_OS_CAST(nano_os_heap_block_header_t**, NANO_OS_CAST(uint8_t*, (block)) + sizeof(nano_os_heap_block_header_t)))
+
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
 
 #if (NANO_OS_HEAP_CONSOLE_CMD_ENABLED == 1u)
 
@@ -49,45 +59,122 @@ static const nano_os_console_cmd_desc_t heap_module_commands[] = {
 #endif /* (NANO_OS_HEAP_CONSOLE_CMD_ENABLED == 1u) */
 
 
+/** \brief Initialize a memory region of the heap */
+static nano_os_error_t NANO_OS_HEAP_InitRegion(nano_os_heap_region_t* const region, void* const region_start, const size_t region_size,
+                                               const uint32_t attributes, const char* const name);
+
+/** \brief Allocate a block from a memory region */
+static void* NANO_OS_HEAP_RegionAlloc(nano_os_heap_region_t* const region, const uint32_t allocate_size);
+
+/** \brief Allocate a block from the memory regions (heap must be locked) */
+static void* NANO_OS_HEAP_RegionsAlloc(const uint32_t allocate_size, const uint32_t attributes, const nano_os_heap_fallback_t fallback);
+
+#if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+/** \brief Get the memory region containing a block */
+static nano_os_heap_region_t* NANO_OS_HEAP_FindRegion(const nano_os_heap_block_header_t* const block);
+
+/** \brief Give a block back to its memory region (heap must be locked) */
+static void NANO_OS_HEAP_RegionsFree(nano_os_heap_block_header_t* const block);
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+
+/** \brief Check the configuration of the size classes */
+static bool NANO_OS_HEAP_CacheCheckClasses(void);
+
+/** \brief Allocate a block from the cache of the smallest size class big enough (NULL if no size class matches or if the heap is exhausted) */
+static void* NANO_OS_HEAP_CacheAlloc(const size_t mem_size);
+
+/** \brief Allocate a batch of blocks from the heap to refill the cache of a size class, the first block is not cached and is returned */
+static nano_os_heap_block_header_t* NANO_OS_HEAP_CacheRefill(const uint32_t class_index);
+
+/** \brief Keep a de-allocated block in the cache of its size class (false if no size class matches) */
+static bool NANO_OS_HEAP_CacheFree(nano_os_heap_block_header_t* const block);
+
+/** \brief Give a list of cached blocks back to the heap */
+static nano_os_error_t NANO_OS_HEAP_CacheRelease(nano_os_heap_block_header_t* block);
+
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
+
+#if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+
+/** \brief Get the index of the most significant bit set in a non zero value */
+static uint32_t NANO_OS_HEAP_TlsfFls(uint32_t value);
+
+/** \brief Compute the free list indexes corresponding to a block size */
+static void NANO_OS_HEAP_TlsfMapping(const uint32_t size, uint32_t* const fl, uint32_t* const sl);
+
+/** \brief Get the next block in memory (NULL if the block is the last one of the region) */
+static nano_os_heap_block_header_t* NANO_OS_HEAP_TlsfNext(const nano_os_heap_region_t* const region, const nano_os_heap_block_header_t* const block);
+
+/** \brief Insert a free block in its free list */
+static void NANO_OS_HEAP_TlsfInsert(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* const block);
+
+/** \brief Remove a free block from its free list */
+static void NANO_OS_HEAP_TlsfRemove(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* const block);
+
+/** \brief Allocate a block from the free lists */
+static void* NANO_OS_HEAP_TlsfAlloc(nano_os_heap_region_t* const region, const uint32_t allocate_size);
+
+#if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+/** \brief De-allocate a block and merge it with its free neighbours in memory */
+static void NANO_OS_HEAP_TlsfFree(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* block);
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+#else
+
+/** \brief Allocate a block from the first free block big enough */
+static void* NANO_OS_HEAP_FirstFitAlloc(nano_os_heap_region_t* const region, const uint32_t allocate_size);
+
+#if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+/** \brief De-allocate a block and merge it with its free neighbours in memory */
+static void NANO_OS_HEAP_FirstFitFree(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* mem_block);
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+#endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+
+
 /** \brief Heap module data */
 static nano_os_heap_module_t heap_module;
 
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
 
+/** \brief Block sizes in bytes of the size classes */
+static const uint32_t heap_cache_class_sizes[NANO_OS_HEAP_CACHE_CLASS_COUNT] = NANO_OS_HEAP_CACHE_CLASS_SIZES;
 
+/** \brief Maximum number of cached blocks of the size classes */
+static const uint32_t heap_cache_class_depths[NANO_OS_HEAP_CACHE_CLASS_COUNT] = NANO_OS_HEAP_CACHE_CLASS_DEPTHS;
 
+/** \brief Number of blocks moved at once between the caches of the size classes and the heap */
+static const uint32_t heap_cache_class_batches[NANO_OS_HEAP_CACHE_CLASS_COUNT] = NANO_OS_HEAP_CACHE_CLASS_BATCHES;
 
-/** \brief Initialize the heap module */
-nano_os_error_t NANO_OS_HEAP_Init(void* const heap_area_start, const size_t heap_area_size)
-{
-    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
 
-    /* Check parameters */
-    if ((heap_area_start != NULL) && (heap_area_size > sizeof(nano_os_heap_block_header_t)))
-    {
-        /* 0 init of the module */
-        (void)MEMSET(&heap_module, 0, sizeof(nano_os_heap_module_t));
 
-        /* Save heap description */
-        heap_module.heap_start = heap_area_start;
-        heap_module.heap_size = heap_area_size;
 
-        #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
-        heap_module.first_allocated = NULL;
-        #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
 
-        /* Create first block */
-        heap_module.first_free = NANO_OS_CAST(nano_os_heap_block_header_t*, heap_area_start);
-        (void)MEMSET(heap_module.first_free, 0, sizeof(nano_os_heap_block_header_t));
-        heap_module.first_free->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
-        heap_module.first_free->size = heap_area_size - sizeof(nano_os_heap_block_header_t);
+/** \brief Initialize the heap module */
+nano_os_error_t NANO_OS_HEAP_Init(void* const heap_area_start, const size_t heap_area_size, const uint32_t heap_area_attributes)
+{
+    nano_os_error_t ret;
 
-        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
-        /* Initialize stats */
-        heap_module.heap_stats.free_blocks = 1u;
-        heap_module.heap_stats.free_memory = heap_area_size - sizeof(nano_os_heap_block_header_t);
-        heap_module.heap_stats.allocated_blocks = 0u;
-        heap_module.heap_stats.allocated_memory = 0u;
-        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+    /* 0 init of the module */
+    (void)MEMSET(&heap_module, 0, sizeof(nano_os_heap_module_t));
+
+    /* The heap area is the first memory region */
+    ret = NANO_OS_HEAP_InitRegion(&heap_module.regions[0u], heap_area_start, heap_area_size, heap_area_attributes, "main");
+    #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+    /* Check the size classes of the caches */
+    if ((ret == NOS_ERR_SUCCESS) && !NANO_OS_HEAP_CacheCheckClasses())
+    {
+        ret = NOS_ERR_INVALID_ARG;
+    }
+    #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        heap_module.region_count = 1u;
 
         /* Initialize heap mutex */
         ret = NANO_OS_MUTEX_Create(&heap_module.heap_mutex, QT_PRIORITY);
@@ -106,8 +193,82 @@ nano_os_error_t NANO_OS_HEAP_Init(void* const heap_area_start, const size_t heap
     return ret;
 }
 
+
+#if (NANO_OS_HEAP_MAX_REGION_COUNT > 1u)
+
+/** \brief Add a memory region to the heap */
+nano_os_error_t NANO_OS_HEAP_AddRegion(void* const region_start, const size_t region_size,
+                                       const uint32_t attributes, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters, the heap must have been initialized */
+    if ((region_start != NULL) && (name != NULL) && (heap_module.region_count != 0u))
+    {
+        /* Lock the heap */
+        ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            uint32_t i;
+            const uint8_t* const start = NANO_OS_CAST(const uint8_t*, region_start);
+
+            /* Check that a region is available and that the new region doesn't overlap the existing ones */
+            bool is_valid = (heap_module.region_count < NANO_OS_HEAP_MAX_REGION_COUNT);
+            for (i = 0u; (i < heap_module.region_count) && is_valid; i++)
+            {
+                const uint8_t* const region_end = NANO_OS_CAST(const uint8_t*, heap_module.regions[i].heap_start) + heap_module.regions[i].heap_size;
+                is_valid = (((start + region_size) <= NANO_OS_CAST(const uint8_t*, heap_module.regions[i].heap_start)) ||
+                            (start >= region_end));
+            }
+            if (is_valid)
+            {
+                /* Add the region after the existing ones */
+                ret = NANO_OS_HEAP_InitRegion(&heap_module.regions[heap_module.region_count], region_start, region_size, attributes, name);
+                if (ret == NOS_ERR_SUCCESS)
+                {
+                    heap_module.region_count++;
+                }
+            }
+            else
+            {
+                ret = NOS_ERR_INVALID_ARG;
+            }
+
+            /* Unlock the heap */
+            (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
+        }
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_HEAP_MAX_REGION_COUNT > 1u) */
+
+
 /** \brief Allocate memory from the heap */
 void* NANO_OS_HEAP_Alloc(const size_t mem_size)
+{
+    void* mem_allocated;
+
+    #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+    /* Small blocks are first looked for in the cache of their size class */
+    mem_allocated = NANO_OS_HEAP_CacheAlloc(mem_size);
+    if (mem_allocated == NULL)
+    {
+        /* All the regions have the requested attributes, they are used in the order they have been added */
+        mem_allocated = NANO_OS_HEAP_AllocWithHint(mem_size, NOS_HEAP_ATTR_NONE, NOS_HEAP_FALLBACK_NONE);
+    }
+    #else
+    /* All the regions have the requested attributes, they are used in the order they have been added */
+    mem_allocated = NANO_OS_HEAP_AllocWithHint(mem_size, NOS_HEAP_ATTR_NONE, NOS_HEAP_FALLBACK_NONE);
+    #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
+    return mem_allocated;
+}
+
+
+/** \brief Allocate memory from the heap regions having the requested attributes */
+void* NANO_OS_HEAP_AllocWithHint(const size_t mem_size, const uint32_t attributes, const nano_os_heap_fallback_t fallback)
 {
     void* mem_allocated = NULL;
 
@@ -117,7 +278,6 @@ void* NANO_OS_HEAP_Alloc(const size_t mem_size)
         nano_os_error_t ret;
 
         /* Compute the block size to allocate */
-        uint32_t total_free_size_needed = sizeof(nano_os_heap_block_header_t);
         uint32_t allocate_size = NANO_OS_CAST(uint32_t, mem_size);
         if (allocate_size < NANO_OS_HEAP_MIN_ALLOC_SIZE)
         {
@@ -128,106 +288,34 @@ void* NANO_OS_HEAP_Alloc(const size_t mem_size)
         {
             allocate_size++;
         }
-        total_free_size_needed += allocate_size;
 
         /* Lock the heap */
         ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
         if (ret == NOS_ERR_SUCCESS)
         {
-            /* Look for a free block with at least the needed size */
-            #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
-            nano_os_heap_block_header_t* previous_free_block = NULL;
-            nano_os_heap_block_header_t* free_block = heap_module.first_free;
-            while ((free_block != NULL) &&
-                   (free_block->size < allocate_size))
-            {
-                previous_free_block = free_block;
-                free_block = free_block->next_in_list;
-            }
-            #else
-            nano_os_heap_block_header_t* free_block = heap_module.first_free;
-            if ((free_block == NULL) ||
-                (free_block->size < total_free_size_needed))
-            {
-                free_block = NULL;
-            }
-            #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
-            if (free_block != NULL)
-            {
-                uint32_t size_left_in_block;
+            /* Allocate the block */
+            mem_allocated = NANO_OS_HEAP_RegionsAlloc(allocate_size, attributes, fallback);
 
-                /* Check block validity */
-                NANO_OS_ERROR_ASSERT((free_block->start_magic == NANO_OS_HEAP_FREE_START_MAGIC), NOS_ERR_CORRUPTED_HEAP);
-
-                /* Compute the size left in the free block */
-                size_left_in_block = free_block->size - allocate_size;
-                if (size_left_in_block > sizeof(nano_os_heap_block_header_t))
-                {
-                    /* Allocate a new block at the end of the free block */
-                    nano_os_heap_block_header_t* new_free_block = NANO_OS_CAST(nano_os_heap_block_header_t*,
-                                                                               NANO_OS_CAST(uint8_t*, free_block) + total_free_size_needed);
-                    new_free_block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
-                    new_free_block->size = size_left_in_block - sizeof(nano_os_heap_block_header_t);
-                    free_block->size = allocate_size;
-
-                    #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
-                    new_free_block->next_in_list = free_block->next_in_list;
-                    free_block->next_in_list = new_free_block;
-
-                    #if (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u)
-                    new_free_block->previous = free_block;
-                    new_free_block->next = free_block->next;
-                    free_block->next = new_free_block;
-                    #endif /* (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u) */
-
-                    #else
-                    heap_module.first_free = new_free_block;
-                    #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
-
-                    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
-                    /* Update stats */
-                    heap_module.heap_stats.free_blocks++;
-                    heap_module.heap_stats.free_memory -= sizeof(nano_os_heap_block_header_t);
-                    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
-                }
-                #if (NANO_OS_HEAP_FREE_ENABLED != 1u)
-                else
-                {
-                    heap_module.first_free = NULL;
-                }
-                #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
-
-                /* Allocate data in the free block */
-                free_block->start_magic = NANO_OS_HEAP_ALLOC_START_MAGIC;
-                mem_allocated = NANO_OS_CAST(nano_os_heap_block_header_t*,
-                                             NANO_OS_CAST(uint8_t*, free_block) + sizeof(nano_os_heap_block_header_t));
+            /* Unlock the heap */
+            (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
+        }
 
-                /* Update the free and allocated lists */
-                #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
-                if (previous_free_block != NULL)
-                {
-                    previous_free_block->next_in_list = free_block->next_in_list;
-                }
-                else
+        #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+        /* The missing memory may be held by the caches, give it back to the heap and retry */
+        if ((mem_allocated == NULL) && (ret == NOS_ERR_SUCCESS))
+        {
+            ret = NANO_OS_HEAP_FlushCaches();
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
+                if (ret == NOS_ERR_SUCCESS)
                 {
-                    heap_module.first_free = free_block->next_in_list;
+                    mem_allocated = NANO_OS_HEAP_RegionsAlloc(allocate_size, attributes, fallback);
+                    (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
                 }
-                free_block->next_in_list = heap_module.first_allocated;
-                heap_module.first_allocated = free_block;
-                #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
-
-                #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
-                /* Update stats */
-                heap_module.heap_stats.allocated_blocks++;
-                heap_module.heap_stats.allocated_memory += allocate_size;
-                heap_module.heap_stats.free_blocks--;
-                heap_module.heap_stats.free_memory -= allocate_size;
-                #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
             }
-
-            /* Unlock the heap */
-            (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
         }
+        #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
     }
 
     return mem_allocated;
@@ -242,120 +330,75 @@ void NANO_OS_HEAP_Free(void* mem)
     /* Check parameters */
     if (mem != NULL)
     {
-        nano_os_error_t ret;
+        bool is_cached = false;
 
         /* Check memory area validity */
         nano_os_heap_block_header_t* mem_block = NANO_OS_CAST(nano_os_heap_block_header_t*,
                                                               NANO_OS_CAST(uint8_t*, mem) - sizeof(nano_os_heap_block_header_t));
         NANO_OS_ERROR_ASSERT((mem_block->start_magic == NANO_OS_HEAP_ALLOC_START_MAGIC), NOS_ERR_CORRUPTED_HEAP);
 
-        /* Lock the heap */
-        ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
-        if (ret == NOS_ERR_SUCCESS)
+        #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+        /* Small blocks are kept in the cache of their size class */
+        is_cached = NANO_OS_HEAP_CacheFree(mem_block);
+        #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+        if (!is_cached)
         {
-            /* Look for the block in allocated list */
-            nano_os_heap_block_header_t* previous_block = NULL;
-            nano_os_heap_block_header_t* current_block = heap_module.first_allocated;
-            while ((current_block != NULL) &&
-                   (current_block != mem_block))
+            /* Lock the heap */
+            const nano_os_error_t ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
+            if (ret == NOS_ERR_SUCCESS)
             {
-                previous_block = current_block;
-                current_block = current_block->next_in_list;
+                /* De-allocate block */
+                NANO_OS_HEAP_RegionsFree(mem_block);
+
+                /* Unlock the heap */
+                (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
             }
-            if (current_block != NULL)
-            {
-                /* Remove block from allocated list */
-                mem_block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
-                if (previous_block != NULL)
-                {
-                    previous_block->next_in_list = mem_block->next_in_list;
-                }
-                else
-                {
-                    heap_module.first_allocated = mem_block->next_in_list;
-                }
-                mem_block->next_in_list = heap_module.first_free;
-                heap_module.first_free = mem_block;
+        }
+    }
 
-                #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
-                /* Update stats */
-                heap_module.heap_stats.allocated_blocks--;
-                heap_module.heap_stats.allocated_memory -= mem_block->size;
-                heap_module.heap_stats.free_blocks++;
-                heap_module.heap_stats.free_memory += mem_block->size;
-                #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+    return;
+}
 
-                #if (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u)
-                /* Try to merge this memory block with the previous in memory
-                   to obtain a larger free block */
-                if ((mem_block->previous != NULL) &&
-                    (mem_block->previous->start_magic == NANO_OS_HEAP_FREE_START_MAGIC))
-                {
-                    heap_module.first_free = mem_block->next_in_list;
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
 
-                    mem_block->previous->size += mem_block->size + sizeof(nano_os_heap_block_header_t);
-                    mem_block->previous->next = mem_block->next;
-                    if (mem_block->next != NULL)
-                    {
-                        mem_block->next->previous = mem_block->previous;
-                    }
-                    mem_block->start_magic = 0u;
-                    mem_block = mem_block->previous;
-
-                    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
-                    /* Update stats */
-                    heap_module.heap_stats.free_blocks--;
-                    heap_module.heap_stats.free_memory += sizeof(nano_os_heap_block_header_t);
-                    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
-                }
 
-                /* Try to merge this memory block with the next in memory
-                   to obtain a larger free block */
-                if ((mem_block->next != NULL) &&
-                    (mem_block->next->start_magic == NANO_OS_HEAP_FREE_START_MAGIC))
-                {
-                    previous_block = NULL;
-                    current_block = heap_module.first_free;
-                    while ((current_block != NULL) &&
-                           (current_block != mem_block->next))
-                    {
-                        previous_block = current_block;
-                        current_block = current_block->next_in_list;
-                    }
-                    NANO_OS_ERROR_ASSERT(previous_block != NULL, NOS_ERR_CORRUPTED_HEAP);
-                    previous_block->next_in_list = mem_block->next->next_in_list;
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
 
-                    mem_block->next->start_magic = 0u;
-                    mem_block->size += mem_block->next->size + sizeof(nano_os_heap_block_header_t);
-                    mem_block->next = mem_block->next->next;
-                    if (mem_block->next != NULL)
-                    {
-                        mem_block->next->previous = mem_block;
-                    }
+/** \brief Give all the blocks held by the size class caches back to the heap */
+nano_os_error_t NANO_OS_HEAP_FlushCaches(void)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+    uint32_t i;
 
-                    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
-                    /* Update stats */
-                    heap_module.heap_stats.free_blocks--;
-                    heap_module.heap_stats.free_memory += sizeof(nano_os_heap_block_header_t);
-                    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
-                }
-                #endif /* (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u) */
-            }
-            else
+    for (i = 0u; i < NANO_OS_HEAP_CACHE_CLASS_COUNT; i++)
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_heap_block_header_t* first_block;
+        nano_os_heap_cache_t* const cache = &heap_module.caches[i];
+
+        /* Detach all the cached blocks */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        first_block = cache->first_block;
+        cache->first_block = NULL;
+        cache->block_count = 0u;
+        cache->cached_memory = 0u;
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        /* Give them back to the heap */
+        if (first_block != NULL)
+        {
+            const nano_os_error_t err = NANO_OS_HEAP_CacheRelease(first_block);
+            if (err != NOS_ERR_SUCCESS)
             {
-                /* This block was not previously allocated or heap is corrupted */
-                NANO_OS_ERROR_Handler(NOS_ERR_CORRUPTED_HEAP);
+                ret = err;
             }
-
-            /* Unlock the heap */
-            (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
         }
     }
 
-    return;
+    return ret;
 }
 
-#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
 
 
 #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
@@ -372,8 +415,32 @@ nano_os_error_t NANO_OS_HEAP_GetStats(nano_os_heap_stats_t* const heap_stats)
         ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
         if (ret == NOS_ERR_SUCCESS)
         {
-            /* Copy statistics */
-            (void)MEMCPY(heap_stats, &heap_module.heap_stats, sizeof(nano_os_heap_stats_t));
+            uint32_t i;
+
+            /* Sum the statistics of all the regions */
+            (void)MEMSET(heap_stats, 0, sizeof(nano_os_heap_stats_t));
+            for (i = 0u; i < heap_module.region_count; i++)
+            {
+                const nano_os_heap_stats_t* const region_stats = &heap_module.regions[i].heap_stats;
+                heap_stats->allocated_memory += region_stats->allocated_memory;
+                heap_stats->allocated_blocks += region_stats->allocated_blocks;
+                heap_stats->free_memory += region_stats->free_memory;
+                heap_stats->free_blocks += region_stats->free_blocks;
+            }
+
+            #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+            /* Sum the blocks held by the caches */
+            for (i = 0u; i < NANO_OS_HEAP_CACHE_CLASS_COUNT; i++)
+            {
+                nano_os_int_status_reg_t int_status_reg;
+                const nano_os_heap_cache_t* const cache = &heap_module.caches[i];
+
+                NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+                heap_stats->cached_memory += cache->cached_memory;
+                heap_stats->cached_blocks += cache->block_count;
+                NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+            }
+            #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
 
             /* Unlock the heap */
             ret = NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
@@ -386,6 +453,54 @@ nano_os_error_t NANO_OS_HEAP_GetStats(nano_os_heap_stats_t* const heap_stats)
 #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
 
 
+/** \brief Get the number of memory regions of the heap */
+nano_os_error_t NANO_OS_HEAP_GetRegionCount(uint32_t* const region_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if (region_count != NULL)
+    {
+        /* Regions are never removed, no need to lock the heap */
+        (*region_count) = heap_module.region_count;
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Get the information on a memory region of the heap */
+nano_os_error_t NANO_OS_HEAP_GetRegionInfo(const uint32_t region_index, nano_os_heap_region_info_t* const region_info)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((region_info != NULL) && (region_index < heap_module.region_count))
+    {
+        /* Lock the heap */
+        ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Copy the region description */
+            const nano_os_heap_region_t* const region = &heap_module.regions[region_index];
+            region_info->name = region->name;
+            region_info->attributes = region->attributes;
+            region_info->start = region->heap_start;
+            region_info->size = region->heap_size;
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            (void)MEMCPY(&region_info->stats, &region->heap_stats, sizeof(nano_os_heap_stats_t));
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+
+            /* Unlock the heap */
+            ret = NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
+        }
+    }
+
+    return ret;
+}
+
+
 #if (NANO_OS_HEAP_CONSOLE_CMD_ENABLED == 1u)
 
 /** \brief Handle the 'heap' console command */
@@ -400,12 +515,20 @@ static void NANO_OS_HEAP_ConsoleCmdHandler(void* const user_data, const uint32_t
     ret = NANO_OS_HEAP_GetStats(&heap_stats);
     if (ret == NOS_ERR_SUCCESS)
     {
+        uint32_t i;
+        size_t heap_size = 0u;
         char temp_str[10u];
 
+        /* Compute the total size */
+        for (i = 0u; i < heap_module.region_count; i++)
+        {
+            heap_size += heap_module.regions[i].heap_size;
+        }
+
         /* Display statistics */
         (void)NANO_OS_USER_ConsoleWriteString("Heap statistics :\r\n");
         (void)NANO_OS_USER_ConsoleWriteString(" - Total size : ");
-        (void)ITOA(heap_module.heap_size, temp_str, 10u);
+        (void)ITOA(heap_size, temp_str, 10u);
         (void)NANO_OS_USER_ConsoleWriteString(temp_str);
         (void)NANO_OS_USER_ConsoleWriteString("\r\n - Allocated memory : ");
         (void)ITOA(heap_stats.allocated_memory, temp_str, 10u);
@@ -419,6 +542,59 @@ static void NANO_OS_HEAP_ConsoleCmdHandler(void* const user_data, const uint32_t
         (void)NANO_OS_USER_ConsoleWriteString("\r\n - Free blocks : ");
         (void)ITOA(heap_stats.free_blocks, temp_str, 10u);
         (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Cached memory : ");
+        (void)ITOA(heap_stats.cached_memory, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Cached blocks : ");
+        (void)ITOA(heap_stats.cached_blocks, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
+        /* Display the regions */
+        for (i = 0u; i < heap_module.region_count; i++)
+        {
+            nano_os_heap_region_info_t region_info;
+            if (NANO_OS_HEAP_GetRegionInfo(i, &region_info) == NOS_ERR_SUCCESS)
+            {
+                (void)NANO_OS_USER_ConsoleWriteString("\r\n - Region ");
+                (void)NANO_OS_USER_ConsoleWriteString(region_info.name);
+                (void)NANO_OS_USER_ConsoleWriteString(" (attributes : ");
+                (void)ITOA(region_info.attributes, temp_str, 16u);
+                (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+                (void)NANO_OS_USER_ConsoleWriteString(") : size = ");
+                (void)ITOA(region_info.size, temp_str, 10u);
+                (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+                (void)NANO_OS_USER_ConsoleWriteString(", allocated = ");
+                (void)ITOA(region_info.stats.allocated_memory, temp_str, 10u);
+                (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+                (void)NANO_OS_USER_ConsoleWriteString(", free = ");
+                (void)ITOA(region_info.stats.free_memory, temp_str, 10u);
+                (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+            }
+        }
+
+        #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+        /* Display the caches, the counters are read without protection since they are only informative */
+        for (i = 0u; i < NANO_OS_HEAP_CACHE_CLASS_COUNT; i++)
+        {
+            const nano_os_heap_cache_t* const cache = &heap_module.caches[i];
+            (void)NANO_OS_USER_ConsoleWriteString("\r\n - Cache ");
+            (void)ITOA(heap_cache_class_sizes[i], temp_str, 10u);
+            (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+            (void)NANO_OS_USER_ConsoleWriteString(" bytes : blocks = ");
+            (void)ITOA(cache->block_count, temp_str, 10u);
+            (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            (void)NANO_OS_USER_ConsoleWriteString(", hits = ");
+            (void)ITOA(cache->hit_count, temp_str, 10u);
+            (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+            (void)NANO_OS_USER_ConsoleWriteString(", misses = ");
+            (void)ITOA(cache->miss_count, temp_str, 10u);
+            (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        }
+        #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
         (void)NANO_OS_USER_ConsoleWriteString("\r\n");
     }
     else
@@ -429,4 +605,894 @@ static void NANO_OS_HEAP_ConsoleCmdHandler(void* const user_data, const uint32_t
 
 #endif /* (NANO_OS_HEAP_CONSOLE_CMD_ENABLED == 1u) */
 
+
+/** \brief Initialize a memory region of the heap */
+static nano_os_error_t NANO_OS_HEAP_InitRegion(nano_os_heap_region_t* const region, void* const region_start, const size_t region_size,
+                                               const uint32_t attributes, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((region_start != NULL) && (region_size > sizeof(nano_os_heap_block_header_t))
+        #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+        && (region_size < (1u << NANO_OS_HEAP_TLSF_MAX_SIZE_BITS))
+        #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+       )
+    {
+        #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+        nano_os_heap_block_header_t* first_block;
+        #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+
+        /* 0 init of the region */
+        (void)MEMSET(region, 0, sizeof(nano_os_heap_region_t));
+
+        /* Save region description */
+        region->name = name;
+        region->attributes = attributes;
+        region->heap_start = region_start;
+        region->heap_size = region_size;
+
+        #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+
+        /* Create first block, its size is aligned so that all the block sizes stay aligned */
+        first_block = NANO_OS_CAST(nano_os_heap_block_header_t*, region_start);
+        (void)MEMSET(first_block, 0, sizeof(nano_os_heap_block_header_t));
+        first_block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
+        first_block->size = (region_size - sizeof(nano_os_heap_block_header_t)) & ~((1u << NANO_OS_HEAP_TLSF_ALIGN_SHIFT) - 1u);
+        region->heap_end = NANO_OS_CAST(uint8_t*, first_block) + sizeof(nano_os_heap_block_header_t) + first_block->size;
+        NANO_OS_HEAP_TlsfInsert(region, first_block);
+
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        /* Initialize stats */
+        region->heap_stats.free_blocks = 1u;
+        region->heap_stats.free_memory = first_block->size;
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+
+        #else
+
+        #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+        region->first_allocated = NULL;
+        #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+        /* Create first block */
+        region->first_free = NANO_OS_CAST(nano_os_heap_block_header_t*, region_start);
+        (void)MEMSET(region->first_free, 0, sizeof(nano_os_heap_block_header_t));
+        region->first_free->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
+        region->first_free->size = region_size - sizeof(nano_os_heap_block_header_t);
+
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        /* Initialize stats */
+        region->heap_stats.free_blocks = 1u;
+        region->heap_stats.free_memory = region_size - sizeof(nano_os_heap_block_header_t);
+        region->heap_stats.allocated_blocks = 0u;
+        region->heap_stats.allocated_memory = 0u;
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+
+        #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Allocate a block from a memory region */
+static void* NANO_OS_HEAP_RegionAlloc(nano_os_heap_region_t* const region, const uint32_t allocate_size)
+{
+    #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+    return NANO_OS_HEAP_TlsfAlloc(region, allocate_size);
+    #else
+    return NANO_OS_HEAP_FirstFitAlloc(region, allocate_size);
+    #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+}
+
+
+/** \brief Allocate a block from the memory regions (heap must be locked) */
+static void* NANO_OS_HEAP_RegionsAlloc(const uint32_t allocate_size, const uint32_t attributes, const nano_os_heap_fallback_t fallback)
+{
+    uint32_t i;
+    void* mem_allocated = NULL;
+
+    /* Look first in the regions having all the requested attributes */
+    for (i = 0u; (i < heap_module.region_count) && (mem_allocated == NULL); i++)
+    {
+        nano_os_heap_region_t* const region = &heap_module.regions[i];
+        if ((region->attributes & attributes) == attributes)
+        {
+            mem_allocated = NANO_OS_HEAP_RegionAlloc(region, allocate_size);
+        }
+    }
+
+    /* Then in the other regions if allowed by the fallback policy */
+    if (fallback == NOS_HEAP_FALLBACK_ANY)
+    {
+        for (i = 0u; (i < heap_module.region_count) && (mem_allocated == NULL); i++)
+        {
+            nano_os_heap_region_t* const region = &heap_module.regions[i];
+            if ((region->attributes & attributes) != attributes)
+            {
+                mem_allocated = NANO_OS_HEAP_RegionAlloc(region, allocate_size);
+            }
+        }
+    }
+
+    return mem_allocated;
+}
+
+
+#if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+
+/** \brief Get the memory region containing a block */
+static nano_os_heap_region_t* NANO_OS_HEAP_FindRegion(const nano_os_heap_block_header_t* const block)
+{
+    uint32_t i;
+    nano_os_heap_region_t* region = NULL;
+    const uint8_t* const block_start = NANO_OS_CAST(const uint8_t*, block);
+
+    for (i = 0u; (i < heap_module.region_count) && (region == NULL); i++)
+    {
+        const uint8_t* const region_start = NANO_OS_CAST(const uint8_t*, heap_module.regions[i].heap_start);
+        if ((block_start >= region_start) && (block_start < (region_start + heap_module.regions[i].heap_size)))
+        {
+            region = &heap_module.regions[i];
+        }
+    }
+
+    return region;
+}
+
+
+/** \brief Give a block back to its memory region (heap must be locked) */
+static void NANO_OS_HEAP_RegionsFree(nano_os_heap_block_header_t* const block)
+{
+    /* Look for the region containing the block */
+    nano_os_heap_region_t* const region = NANO_OS_HEAP_FindRegion(block);
+    if (region != NULL)
+    {
+        #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+
+        /* De-allocate block and merge it with its free neighbours in memory */
+        NANO_OS_HEAP_TlsfFree(region, block);
+
+        #else
+
+        /* De-allocate block and merge it with its free neighbours in memory */
+        NANO_OS_HEAP_FirstFitFree(region, block);
+
+        #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+    }
+    else
+    {
+        /* This block doesn't belong to the heap */
+        NANO_OS_ERROR_Handler(NOS_ERR_CORRUPTED_HEAP);
+    }
+}
+
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+
+/** \brief Check the configuration of the size classes */
+static bool NANO_OS_HEAP_CacheCheckClasses(void)
+{
+    uint32_t i;
+    bool is_valid = true;
+
+    /* Sizes must be increasing, 32bits aligned and big enough to store the link to the next cached block,
+       batches must not be empty and must fit in the caches */
+    for (i = 0u; (i < NANO_OS_HEAP_CACHE_CLASS_COUNT) && is_valid; i++)
+    {
+        is_valid = (((heap_cache_class_sizes[i] & 3u) == 0u) &&
+                    (heap_cache_class_sizes[i] >= sizeof(nano_os_heap_block_header_t*)) &&
+                    ((i == 0u) || (heap_cache_class_sizes[i] > heap_cache_class_sizes[i - 1u])) &&
+                    (heap_cache_class_batches[i] != 0u) &&
+                    (heap_cache_class_batches[i] <= heap_cache_class_depths[i]));
+    }
+
+    return is_valid;
+}
+
+
+/** \brief Allocate a block from the cache of the smallest size class big enough (NULL if no size class matches or if the heap is exhausted) */
+static void* NANO_OS_HEAP_CacheAlloc(const size_t mem_size)
+{
+    void* mem_allocated = NULL;
+
+    /* Look for the size class */
+    uint32_t class_index = 0u;
+    while ((class_index < NANO_OS_HEAP_CACHE_CLASS_COUNT) && (heap_cache_class_sizes[class_index] < mem_size))
+    {
+        class_index++;
+    }
+    if ((mem_size != 0u) && (class_index < NANO_OS_HEAP_CACHE_CLASS_COUNT))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_heap_block_header_t* block;
+        nano_os_heap_cache_t* const cache = &heap_module.caches[class_index];
+
+        /* Take the first cached block */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        block = cache->first_block;
+        if (block != NULL)
+        {
+            cache->first_block = NANO_OS_HEAP_CACHE_NEXT(block);
+            cache->block_count--;
+            cache->cached_memory -= block->size;
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            cache->hit_count++;
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        }
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        else
+        {
+            cache->miss_count++;
+        }
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        /* Refill the cache if it was empty */
+        if (block == NULL)
+        {
+            block = NANO_OS_HEAP_CacheRefill(class_index);
+        }
+        if (block != NULL)
+        {
+            block->start_magic = NANO_OS_HEAP_ALLOC_START_MAGIC;
+            mem_allocated = NANO_OS_CAST(uint8_t*, block) + sizeof(nano_os_heap_block_header_t);
+        }
+    }
+
+    return mem_allocated;
+}
+
+
+/** \brief Allocate a batch of blocks from the heap to refill the cache of a size class, the first block is not cached and is returned */
+static nano_os_heap_block_header_t* NANO_OS_HEAP_CacheRefill(const uint32_t class_index)
+{
+    nano_os_heap_block_header_t* block = NULL;
+    nano_os_heap_block_header_t* first_block = NULL;
+    nano_os_heap_block_header_t* last_block = NULL;
+    uint32_t block_count = 0u;
+    uint32_t cached_memory = 0u;
+
+    /* Lock the heap */
+    nano_os_error_t ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        uint32_t i;
+        bool is_allocated = true;
+
+        /* Allocate the batch of blocks in a single lock of the heap */
+        for (i = 0u; (i < heap_cache_class_batches[class_index]) && is_allocated; i++)
+        {
+            void* const mem_allocated = NANO_OS_HEAP_RegionsAlloc(heap_cache_class_sizes[class_index], NOS_HEAP_ATTR_NONE, NOS_HEAP_FALLBACK_NONE);
+            is_allocated = (mem_allocated != NULL);
+            if (is_allocated)
+            {
+                nano_os_heap_block_header_t* const new_block = NANO_OS_CAST(nano_os_heap_block_header_t*,
+                                                                            NANO_OS_CAST(uint8_t*, mem_allocated) - sizeof(nano_os_heap_block_header_t));
+                if (block == NULL)
+                {
+                    /* First block is for the caller */
+                    block = new_block;
+                }
+                else
+                {
+                    /* Next ones are chained to be cached */
+                    new_block->start_magic = NANO_OS_HEAP_CACHED_START_MAGIC;
+                    NANO_OS_HEAP_CACHE_NEXT(new_block) = first_block;
+                    if (first_block == NULL)
+                    {
+                        last_block = new_block;
+                    }
+                    first_block = new_block;
+                    block_count++;
+                    cached_memory += new_block->size;
+                }
+            }
+        }
+
+        /* Unlock the heap */
+        (void)NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
+    }
+
+    /* Add the chained blocks to the cache */
+    if (first_block != NULL)
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_heap_cache_t* const cache = &heap_module.caches[class_index];
+
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        NANO_OS_HEAP_CACHE_NEXT(last_block) = cache->first_block;
+        cache->first_block = first_block;
+        cache->block_count += block_count;
+        cache->cached_memory += cached_memory;
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+    }
+
+    return block;
+}
+
+
+/** \brief Keep a de-allocated block in the cache of its size class (false if no size class matches) */
+static bool NANO_OS_HEAP_CacheFree(nano_os_heap_block_header_t* const block)
+{
+    bool is_cached = false;
+
+    /* Look for the biggest size class which fits in the block, the block can be bigger than
+       the size of its class when the allocator didn't split it to avoid a too small free block */
+    uint32_t class_index = NANO_OS_HEAP_CACHE_CLASS_COUNT;
+    while ((class_index > 0u) && (heap_cache_class_sizes[class_index - 1u] > block->size))
+    {
+        class_index--;
+    }
+    if ((class_index > 0u) && (block->size <= (heap_cache_class_sizes[class_index - 1u] + sizeof(nano_os_heap_block_header_t))))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_heap_block_header_t* released_blocks = NULL;
+        nano_os_heap_cache_t* const cache = &heap_module.caches[class_index - 1u];
+
+        block->start_magic = NANO_OS_HEAP_CACHED_START_MAGIC;
+
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+        /* If the cache is full, detach a batch of blocks to give them back to the heap */
+        if (cache->block_count >= heap_cache_class_depths[class_index - 1u])
+        {
+            uint32_t i;
+            nano_os_heap_block_header_t* last_block = cache->first_block;
+
+            released_blocks = cache->first_block;
+            cache->cached_memory -= last_block->size;
+            for (i = 1u; i < heap_cache_class_batches[class_index - 1u]; i++)
+            {
+                last_block = NANO_OS_HEAP_CACHE_NEXT(last_block);
+                cache->cached_memory -= last_block->size;
+            }
+            cache->first_block = NANO_OS_HEAP_CACHE_NEXT(last_block);
+            cache->block_count -= heap_cache_class_batches[class_index - 1u];
+            NANO_OS_HEAP_CACHE_NEXT(last_block) = NULL;
+        }
+
+        /* Add the block to the cache */
+        NANO_OS_HEAP_CACHE_NEXT(block) = cache->first_block;
+        cache->first_block = block;
+        cache->block_count++;
+        cache->cached_memory += block->size;
+
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        /* Give the detached blocks back to the heap */
+        if (released_blocks != NULL)
+        {
+            (void)NANO_OS_HEAP_CacheRelease(released_blocks);
+        }
+        is_cached = true;
+    }
+
+    return is_cached;
+}
+
+
+/** \brief Give a list of cached blocks back to the heap */
+static nano_os_error_t NANO_OS_HEAP_CacheRelease(nano_os_heap_block_header_t* block)
+{
+    /* Lock the heap */
+    nano_os_error_t ret = NANO_OS_MUTEX_Lock(&heap_module.heap_mutex, 0xFFFFFFFFu);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        /* De-allocate all the blocks in a single lock of the heap */
+        while (block != NULL)
+        {
+            nano_os_heap_block_header_t* const next_block = NANO_OS_HEAP_CACHE_NEXT(block);
+            block->start_magic = NANO_OS_HEAP_ALLOC_START_MAGIC;
+            NANO_OS_HEAP_RegionsFree(block);
+            block = next_block;
+        }
+
+        /* Unlock the heap */
+        ret = NANO_OS_MUTEX_Unlock(&heap_module.heap_mutex);
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
+
+#if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+
+/** \brief Get the index of the most significant bit set in a non zero value */
+static uint32_t NANO_OS_HEAP_TlsfFls(uint32_t value)
+{
+    uint32_t index = 0u;
+
+    /* Binary search in a constant number of steps */
+    if ((value & 0xFFFF0000u) != 0u)
+    {
+        value >>= 16u;
+        index += 16u;
+    }
+    if ((value & 0x0000FF00u) != 0u)
+    {
+        value >>= 8u;
+        index += 8u;
+    }
+    if ((value & 0x000000F0u) != 0u)
+    {
+        value >>= 4u;
+        index += 4u;
+    }
+    if ((value & 0x0000000Cu) != 0u)
+    {
+        value >>= 2u;
+        index += 2u;
+    }
+    if ((value & 0x00000002u) != 0u)
+    {
+        index += 1u;
+    }
+
+    return index;
+}
+
+
+/** \brief Compute the free list indexes corresponding to a block size */
+static void NANO_OS_HEAP_TlsfMapping(const uint32_t size, uint32_t* const fl, uint32_t* const sl)
+{
+    if (size < (1u << NANO_OS_HEAP_TLSF_FL_INDEX_SHIFT))
+    {
+        /* Small blocks are linearly spread on the first level 0 */
+        (*fl) = 0u;
+        (*sl) = size >> NANO_OS_HEAP_TLSF_ALIGN_SHIFT;
+    }
+    else
+    {
+        /* First level is the power of 2 range of the size, second level
+           is the subdivision of this range given by the next bits of the size */
+        const uint32_t msb = NANO_OS_HEAP_TlsfFls(size);
+        (*fl) = msb - NANO_OS_HEAP_TLSF_FL_INDEX_SHIFT + 1u;
+        (*sl) = (size >> (msb - NANO_OS_HEAP_TLSF_SL_INDEX_BITS)) & (NANO_OS_HEAP_TLSF_SL_INDEX_COUNT - 1u);
+    }
+}
+
+
+/** \brief Get the next block in memory (NULL if the block is the last one of the region) */
+static nano_os_heap_block_header_t* NANO_OS_HEAP_TlsfNext(const nano_os_heap_region_t* const region, const nano_os_heap_block_header_t* const block)
+{
+    uint8_t* next = NANO_OS_CAST(uint8_t*, block) + sizeof(nano_os_heap_block_header_t) + block->size;
+    if (next == region->heap_end)
+    {
+        next = NULL;
+    }
+    return NANO_OS_CAST(nano_os_heap_block_header_t*, next);
+}
+
+
+/** \brief Insert a free block in its free list */
+static void NANO_OS_HEAP_TlsfInsert(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* const block)
+{
+    uint32_t fl;
+    uint32_t sl;
+
+    /* Add block at the head of its free list */
+    NANO_OS_HEAP_TlsfMapping(block->size, &fl, &sl);
+    block->previous_in_list = NULL;
+    block->next_in_list = region->free_lists[fl][sl];
+    if (block->next_in_list != NULL)
+    {
+        block->next_in_list->previous_in_list = block;
+    }
+    region->free_lists[fl][sl] = block;
+
+    /* The free list is not empty anymore */
+    region->fl_bitmap |= (1u << fl);
+    region->sl_bitmaps[fl] |= (1u << sl);
+}
+
+
+/** \brief Remove a free block from its free list */
+static void NANO_OS_HEAP_TlsfRemove(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* const block)
+{
+    uint32_t fl;
+    uint32_t sl;
+
+    NANO_OS_HEAP_TlsfMapping(block->size, &fl, &sl);
+    if (block->previous_in_list != NULL)
+    {
+        block->previous_in_list->next_in_list = block->next_in_list;
+    }
+    else
+    {
+        region->free_lists[fl][sl] = block->next_in_list;
+
+        /* Update the bitmaps if the free list is now empty */
+        if (block->next_in_list == NULL)
+        {
+            region->sl_bitmaps[fl] &= ~(1u << sl);
+            if (region->sl_bitmaps[fl] == 0u)
+            {
+                region->fl_bitmap &= ~(1u << fl);
+            }
+        }
+    }
+    if (block->next_in_list != NULL)
+    {
+        block->next_in_list->previous_in_list = block->previous_in_list;
+    }
+    block->next_in_list = NULL;
+    block->previous_in_list = NULL;
+}
+
+
+/** \brief Allocate a block from the free lists */
+static void* NANO_OS_HEAP_TlsfAlloc(nano_os_heap_region_t* const region, const uint32_t allocate_size)
+{
+    void* mem_allocated = NULL;
+    uint32_t search_size = allocate_size;
+    uint32_t fl;
+    uint32_t sl;
+
+    /* Round up the size to the next free list so that
+       any block of the selected free list is big enough */
+    if (search_size >= (1u << NANO_OS_HEAP_TLSF_FL_INDEX_SHIFT))
+    {
+        search_size += (1u << (NANO_OS_HEAP_TlsfFls(search_size) - NANO_OS_HEAP_TLSF_SL_INDEX_BITS)) - 1u;
+    }
+    NANO_OS_HEAP_TlsfMapping(search_size, &fl, &sl);
+    if ((allocate_size < (1u << NANO_OS_HEAP_TLSF_MAX_SIZE_BITS)) && (fl < NANO_OS_HEAP_TLSF_FL_INDEX_COUNT))
+    {
+        /* Look for a non empty free list in the same first level, then in the upper first levels */
+        uint32_t sl_map = region->sl_bitmaps[fl] & (0xFFFFFFFFu << sl);
+        if (sl_map == 0u)
+        {
+            const uint32_t fl_map = region->fl_bitmap & (0xFFFFFFFFu << (fl + 1u));
+            if (fl_map != 0u)
+            {
+                fl = NANO_OS_HEAP_TlsfFls(fl_map & (~fl_map + 1u));
+                sl_map = region->sl_bitmaps[fl];
+            }
+        }
+        if (sl_map != 0u)
+        {
+            nano_os_heap_block_header_t* block;
+            uint32_t size_left_in_block;
+
+            /* Take the first block of the free list */
+            sl = NANO_OS_HEAP_TlsfFls(sl_map & (~sl_map + 1u));
+            block = region->free_lists[fl][sl];
+
+            /* Check block validity */
+            NANO_OS_ERROR_ASSERT((block->start_magic == NANO_OS_HEAP_FREE_START_MAGIC), NOS_ERR_CORRUPTED_HEAP);
+            NANO_OS_HEAP_TlsfRemove(region, block);
+
+            /* Split the block if the size left can hold another block */
+            size_left_in_block = block->size - allocate_size;
+            if (size_left_in_block > sizeof(nano_os_heap_block_header_t))
+            {
+                nano_os_heap_block_header_t* next_block;
+                nano_os_heap_block_header_t* const new_free_block = NANO_OS_CAST(nano_os_heap_block_header_t*,
+                                                                                 NANO_OS_CAST(uint8_t*, block) + sizeof(nano_os_heap_block_header_t) + allocate_size);
+                new_free_block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
+                new_free_block->size = size_left_in_block - sizeof(nano_os_heap_block_header_t);
+                new_free_block->previous = block;
+                block->size = allocate_size;
+                next_block = NANO_OS_HEAP_TlsfNext(region, new_free_block);
+                if (next_block != NULL)
+                {
+                    next_block->previous = new_free_block;
+                }
+                NANO_OS_HEAP_TlsfInsert(region, new_free_block);
+
+                #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+                /* Update stats */
+                region->heap_stats.free_blocks++;
+                region->heap_stats.free_memory -= sizeof(nano_os_heap_block_header_t);
+                #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+            }
+
+            /* Allocate data in the block */
+            block->start_magic = NANO_OS_HEAP_ALLOC_START_MAGIC;
+            mem_allocated = NANO_OS_CAST(uint8_t*, block) + sizeof(nano_os_heap_block_header_t);
+
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            /* Update stats */
+            region->heap_stats.allocated_blocks++;
+            region->heap_stats.allocated_memory += block->size;
+            region->heap_stats.free_blocks--;
+            region->heap_stats.free_memory -= block->size;
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        }
+    }
+
+    return mem_allocated;
+}
+
+
+#if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+
+/** \brief De-allocate a block and merge it with its free neighbours in memory */
+static void NANO_OS_HEAP_TlsfFree(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* block)
+{
+    nano_os_heap_block_header_t* next_block;
+
+    /* Release the block */
+    block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
+
+    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+    /* Update stats */
+    region->heap_stats.allocated_blocks--;
+    region->heap_stats.allocated_memory -= block->size;
+    region->heap_stats.free_blocks++;
+    region->heap_stats.free_memory += block->size;
+    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+
+    /* Merge this block with the previous in memory if it is free */
+    if ((block->previous != NULL) &&
+        (block->previous->start_magic == NANO_OS_HEAP_FREE_START_MAGIC))
+    {
+        nano_os_heap_block_header_t* const previous_block = block->previous;
+        NANO_OS_HEAP_TlsfRemove(region, previous_block);
+        previous_block->size += block->size + sizeof(nano_os_heap_block_header_t);
+        block->start_magic = 0u;
+        block = previous_block;
+
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        /* Update stats */
+        region->heap_stats.free_blocks--;
+        region->heap_stats.free_memory += sizeof(nano_os_heap_block_header_t);
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+    }
+
+    /* Merge this block with the next in memory if it is free */
+    next_block = NANO_OS_HEAP_TlsfNext(region, block);
+    if ((next_block != NULL) &&
+        (next_block->start_magic == NANO_OS_HEAP_FREE_START_MAGIC))
+    {
+        NANO_OS_HEAP_TlsfRemove(region, next_block);
+        block->size += next_block->size + sizeof(nano_os_heap_block_header_t);
+        next_block->start_magic = 0u;
+
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        /* Update stats */
+        region->heap_stats.free_blocks--;
+        region->heap_stats.free_memory += sizeof(nano_os_heap_block_header_t);
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+    }
+
+    /* Update the link of the next block in memory to the merged block */
+    next_block = NANO_OS_HEAP_TlsfNext(region, block);
+    if (next_block != NULL)
+    {
+        next_block->previous = block;
+    }
+
+    /* Add the merged block to its free list */
+    NANO_OS_HEAP_TlsfInsert(region, block);
+}
+
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+#else
+
+/** \brief Allocate a block from the first free block big enough */
+static void* NANO_OS_HEAP_FirstFitAlloc(nano_os_heap_region_t* const region, const uint32_t allocate_size)
+{
+    void* mem_allocated = NULL;
+    const uint32_t total_free_size_needed = sizeof(nano_os_heap_block_header_t) + allocate_size;
+
+    /* Look for a free block with at least the needed size */
+    #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+    nano_os_heap_block_header_t* previous_free_block = NULL;
+    nano_os_heap_block_header_t* free_block = region->first_free;
+    while ((free_block != NULL) &&
+           (free_block->size < allocate_size))
+    {
+        previous_free_block = free_block;
+        free_block = free_block->next_in_list;
+    }
+    #else
+    nano_os_heap_block_header_t* free_block = region->first_free;
+    if ((free_block == NULL) ||
+        (free_block->size < total_free_size_needed))
+    {
+        free_block = NULL;
+    }
+    #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+    if (free_block != NULL)
+    {
+        uint32_t size_left_in_block;
+
+        /* Check block validity */
+        NANO_OS_ERROR_ASSERT((free_block->start_magic == NANO_OS_HEAP_FREE_START_MAGIC), NOS_ERR_CORRUPTED_HEAP);
+
+        /* Compute the size left in the free block */
+        size_left_in_block = free_block->size - allocate_size;
+        if (size_left_in_block > sizeof(nano_os_heap_block_header_t))
+        {
+            /* Allocate a new block at the end of the free block */
+            nano_os_heap_block_header_t* new_free_block = NANO_OS_CAST(nano_os_heap_block_header_t*,
+                                                                       NANO_OS_CAST(uint8_t*, free_block) + total_free_size_needed);
+            new_free_block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
+            new_free_block->size = size_left_in_block - sizeof(nano_os_heap_block_header_t);
+            free_block->size = allocate_size;
+
+            #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+            new_free_block->next_in_list = free_block->next_in_list;
+            free_block->next_in_list = new_free_block;
+
+            #if (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u)
+            new_free_block->previous = free_block;
+            new_free_block->next = free_block->next;
+            if (new_free_block->next != NULL)
+            {
+                new_free_block->next->previous = new_free_block;
+            }
+            free_block->next = new_free_block;
+            #endif /* (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u) */
+
+            #else
+            region->first_free = new_free_block;
+            #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            /* Update stats */
+            region->heap_stats.free_blocks++;
+            region->heap_stats.free_memory -= sizeof(nano_os_heap_block_header_t);
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        }
+        #if (NANO_OS_HEAP_FREE_ENABLED != 1u)
+        else
+        {
+            region->first_free = NULL;
+        }
+        #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+        /* Allocate data in the free block */
+        free_block->start_magic = NANO_OS_HEAP_ALLOC_START_MAGIC;
+        mem_allocated = NANO_OS_CAST(nano_os_heap_block_header_t*,
+                                     NANO_OS_CAST(uint8_t*, free_block) + sizeof(nano_os_heap_block_header_t));
+
+        /* Update the free and allocated lists */
+        #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+        if (previous_free_block != NULL)
+        {
+            previous_free_block->next_in_list = free_block->next_in_list;
+        }
+        else
+        {
+            region->first_free = free_block->next_in_list;
+        }
+        free_block->next_in_list = region->first_allocated;
+        region->first_allocated = free_block;
+        #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        /* Update stats */
+        region->heap_stats.allocated_blocks++;
+        region->heap_stats.allocated_memory += allocate_size;
+        region->heap_stats.free_blocks--;
+        region->heap_stats.free_memory -= allocate_size;
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+    }
+
+    return mem_allocated;
+}
+
+
+#if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+
+/** \brief De-allocate a block and merge it with its free neighbours in memory */
+static void NANO_OS_HEAP_FirstFitFree(nano_os_heap_region_t* const region, nano_os_heap_block_header_t* mem_block)
+{
+    nano_os_heap_block_header_t* previous_block = NULL;
+    nano_os_heap_block_header_t* current_block;
+
+    /* Look for the block in allocated list */
+    current_block = region->first_allocated;
+    while ((current_block != NULL) &&
+           (current_block != mem_block))
+    {
+        previous_block = current_block;
+        current_block = current_block->next_in_list;
+    }
+    if (current_block != NULL)
+    {
+        /* Remove block from allocated list */
+        mem_block->start_magic = NANO_OS_HEAP_FREE_START_MAGIC;
+        if (previous_block != NULL)
+        {
+            previous_block->next_in_list = mem_block->next_in_list;
+        }
+        else
+        {
+            region->first_allocated = mem_block->next_in_list;
+        }
+        mem_block->next_in_list = region->first_free;
+        region->first_free = mem_block;
+
+        #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+        /* Update stats */
+        region->heap_stats.allocated_blocks--;
+        region->heap_stats.allocated_memory -= mem_block->size;
+        region->heap_stats.free_blocks++;
+        region->heap_stats.free_memory += mem_block->size;
+        #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+
+        #if (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u)
+        /* Try to merge this memory block with the previous in memory
+           to obtain a larger free block */
+        if ((mem_block->previous != NULL) &&
+            (mem_block->previous->start_magic == NANO_OS_HEAP_FREE_START_MAGIC))
+        {
+            region->first_free = mem_block->next_in_list;
+
+            mem_block->previous->size += mem_block->size + sizeof(nano_os_heap_block_header_t);
+            mem_block->previous->next = mem_block->next;
+            if (mem_block->next != NULL)
+            {
+                mem_block->next->previous = mem_block->previous;
+            }
+            mem_block->start_magic = 0u;
+            mem_block = mem_block->previous;
+
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            /* Update stats */
+            region->heap_stats.free_blocks--;
+            region->heap_stats.free_memory += sizeof(nano_os_heap_block_header_t);
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        }
+
+        /* Try to merge this memory block with the next in memory
+           to obtain a larger free block */
+        if ((mem_block->next != NULL) &&
+            (mem_block->next->start_magic == NANO_OS_HEAP_FREE_START_MAGIC))
+        {
+            previous_block = NULL;
+            current_block = region->first_free;
+            while ((current_block != NULL) &&
+                   (current_block != mem_block->next))
+            {
+                previous_block = current_block;
+                current_block = current_block->next_in_list;
+            }
+            NANO_OS_ERROR_ASSERT(current_block != NULL, NOS_ERR_CORRUPTED_HEAP);
+            if (previous_block != NULL)
+            {
+                previous_block->next_in_list = mem_block->next->next_in_list;
+            }
+            else
+            {
+                region->first_free = mem_block->next->next_in_list;
+            }
+
+            mem_block->next->start_magic = 0u;
+            mem_block->size += mem_block->next->size + sizeof(nano_os_heap_block_header_t);
+            mem_block->next = mem_block->next->next;
+            if (mem_block->next != NULL)
+            {
+                mem_block->next->previous = mem_block;
+            }
+
+            #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+            /* Update stats */
+            region->heap_stats.free_blocks--;
+            region->heap_stats.free_memory += sizeof(nano_os_heap_block_header_t);
+            #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+        }
+        #endif /* (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u) */
+    }
+    else
+    {
+        /* This block was not previously allocated or heap is corrupted */
+        NANO_OS_ERROR_Handler(NOS_ERR_CORRUPTED_HEAP);
+    }
+}
+
+#endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+
+#endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+
 #endif /* (NANO_OS_HEAP_ENABLED == 1u) */
@@ -35,6 +35,46 @@ extern "C"
 #endif /* __cplusplus */
 
 
+#if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+
+/** \brief Alignment of the block sizes of the TLSF allocator (log2) */
+#define NANO_OS_HEAP_TLSF_ALIGN_SHIFT       2u
+
+/** \brief Number of second level free lists of the TLSF allocator for each first level */
+#define NANO_OS_HEAP_TLSF_SL_INDEX_COUNT    (1u << NANO_OS_HEAP_TLSF_SL_INDEX_BITS)
+
+/** \brief Sizes below 2^shift are all handled by the first level 0 of the TLSF allocator */
+#define NANO_OS_HEAP_TLSF_FL_INDEX_SHIFT    (NANO_OS_HEAP_TLSF_SL_INDEX_BITS + NANO_OS_HEAP_TLSF_ALIGN_SHIFT)
+
+/** \brief Number of first levels of the TLSF allocator */
+#define NANO_OS_HEAP_TLSF_FL_INDEX_COUNT    (NANO_OS_HEAP_TLSF_MAX_SIZE_BITS - NANO_OS_HEAP_TLSF_FL_INDEX_SHIFT + 1u)
+
+#endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+
+
+/** \brief Heap region attributes */
+typedef enum _nano_os_heap_attribute_t
+{
+    /** \brief General purpose memory */
+    NOS_HEAP_ATTR_NONE = 0x00u,
+    /** \brief Fast memory (core coupled or tightly coupled memory) */
+    NOS_HEAP_ATTR_FAST = 0x01u,
+    /** \brief Memory which can be accessed by the DMA controllers */
+    NOS_HEAP_ATTR_DMA = 0x02u,
+    /** \brief Large memory for bulk data */
+    NOS_HEAP_ATTR_BULK = 0x04u
+} nano_os_heap_attribute_t;
+
+
+/** \brief Heap fallback policy when no region with the requested attributes can satisfy an allocation */
+typedef enum _nano_os_heap_fallback_t
+{
+    /** \brief The allocation fails */
+    NOS_HEAP_FALLBACK_NONE = 0u,
+    /** \brief The allocation is done in any other region */
+    NOS_HEAP_FALLBACK_ANY = 1u
+} nano_os_heap_fallback_t;
+
 
 /** \brief Heap block header */
 typedef struct _nano_os_heap_block_header_t
@@ -44,7 +84,15 @@ typedef struct _nano_os_heap_block_header_t
     /** \brief Block size */
     uint32_t size;
 
-    #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
+    #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+    /** \brief Previous block in memory */
+    struct _nano_os_heap_block_header_t* previous;
+    /** \brief Next block in free list */
+    struct _nano_os_heap_block_header_t* next_in_list;
+    /** \brief Previous block in free list */
+    struct _nano_os_heap_block_header_t* previous_in_list;
+
+    #elif (NANO_OS_HEAP_FREE_ENABLED == 1u)
     /** \brief Next block in list */
     struct _nano_os_heap_block_header_t* next_in_list;
 
@@ -55,7 +103,7 @@ typedef struct _nano_os_heap_block_header_t
     struct _nano_os_heap_block_header_t* next;
     #endif /* (NANO_OS_HEAP_MERGE_FREE_BLOCKS_ENABLED == 1u) */
 
-    #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+    #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
 } nano_os_heap_block_header_t;
 
 
@@ -71,30 +119,103 @@ typedef struct _nano_os_heap_stats_t
     uint32_t free_memory;
     /** \brief Total free block count */
     uint32_t free_blocks;
+    #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+    /** \brief Memory size in bytes held by the size class caches (included in the allocated memory) */
+    uint32_t cached_memory;
+    /** \brief Block count held by the size class caches (included in the allocated blocks) */
+    uint32_t cached_blocks;
+    #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
 } nano_os_heap_stats_t;
 #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
 
 
+/** \brief Heap region information */
+typedef struct _nano_os_heap_region_info_t
+{
+    /** \brief Name */
+    const char* name;
+    /** \brief Attributes (combination of nano_os_heap_attribute_t) */
+    uint32_t attributes;
+    /** \brief Start of the region */
+    void* start;
+    /** \brief Size of the region in bytes */
+    size_t size;
+    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+    /** \brief Region statistics */
+    nano_os_heap_stats_t stats;
+    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+} nano_os_heap_region_info_t;
 
-/** \brief Heap module data */
-typedef struct _nano_os_heap_module_t
+
+/** \brief Heap memory region */
+typedef struct _nano_os_heap_region_t
 {
+    /** \brief Name */
+    const char* name;
+    /** \brief Attributes (combination of nano_os_heap_attribute_t) */
+    uint32_t attributes;
     /** \brief Start of the heap area */
     void* heap_start;
     /** \brief Size of the heap area in bytes */
     size_t heap_size;
-    /** \brief Mutex to protect the heap area */
-    nano_os_mutex_t heap_mutex;
+    #if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+    /** \brief End of the memory blocks */
+    void* heap_end;
+    /** \brief Bitmap of the first levels containing at least one non empty free list */
+    uint32_t fl_bitmap;
+    /** \brief Bitmaps of the non empty free lists of each first level */
+    uint32_t sl_bitmaps[NANO_OS_HEAP_TLSF_FL_INDEX_COUNT];
+    /** \brief Free lists, indexed by first level and second level */
+    nano_os_heap_block_header_t* free_lists[NANO_OS_HEAP_TLSF_FL_INDEX_COUNT][NANO_OS_HEAP_TLSF_SL_INDEX_COUNT];
+    #else
     /** \brief First free memory block */
     nano_os_heap_block_header_t* first_free;
     #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
     /** \brief First allocated memory block */
     nano_os_heap_block_header_t* first_allocated;
     #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
+    #endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
     #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
     /** \brief Heap statistics */
     nano_os_heap_stats_t heap_stats;
     #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+} nano_os_heap_region_t;
+
+
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+/** \brief Heap cache of a size class : free blocks kept aside to be reused without locking the heap */
+typedef struct _nano_os_heap_cache_t
+{
+    /** \brief First cached block */
+    nano_os_heap_block_header_t* first_block;
+    /** \brief Number of cached blocks */
+    uint32_t block_count;
+    /** \brief Memory size in bytes of the cached blocks */
+    uint32_t cached_memory;
+    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+    /** \brief Number of allocations served by the cache */
+    uint32_t hit_count;
+    /** \brief Number of allocations which needed a refill of the cache */
+    uint32_t miss_count;
+    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+} nano_os_heap_cache_t;
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
+
+
+/** \brief Heap module data */
+typedef struct _nano_os_heap_module_t
+{
+    /** \brief Memory regions, the first one is the heap area given at initialization */
+    nano_os_heap_region_t regions[NANO_OS_HEAP_MAX_REGION_COUNT];
+    /** \brief Number of memory regions */
+    uint32_t region_count;
+    /** \brief Mutex to protect the heap regions */
+    nano_os_mutex_t heap_mutex;
+    #if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+    /** \brief Caches of the size classes (protected by critical sections) */
+    nano_os_heap_cache_t caches[NANO_OS_HEAP_CACHE_CLASS_COUNT];
+    #endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
     #if (NANO_OS_HEAP_CONSOLE_CMD_ENABLED == 1u)
     /** \brief Heap console command group */
     nano_os_console_cmd_group_desc_t heap_cmd_group;
@@ -109,22 +230,42 @@ typedef struct _nano_os_heap_module_t
 
 
 
-/** \brief Initialize the heap module */
-nano_os_error_t NANO_OS_HEAP_Init(void* const heap_area_start, const size_t heap_area_size);
+/** \brief Initialize the heap module, the heap area is the first memory region (heap_area_attributes is a combination of nano_os_heap_attribute_t) */
+nano_os_error_t NANO_OS_HEAP_Init(void* const heap_area_start, const size_t heap_area_size, const uint32_t heap_area_attributes);
+
+#if (NANO_OS_HEAP_MAX_REGION_COUNT > 1u)
+/** \brief Add a memory region to the heap */
+nano_os_error_t NANO_OS_HEAP_AddRegion(void* const region_start, const size_t region_size,
+                                       const uint32_t attributes, const char* const name);
+#endif /* (NANO_OS_HEAP_MAX_REGION_COUNT > 1u) */
 
 /** \brief Allocate memory from the heap */
 void* NANO_OS_HEAP_Alloc(const size_t mem_size);
 
+/** \brief Allocate memory from the heap regions having the requested attributes */
+void* NANO_OS_HEAP_AllocWithHint(const size_t mem_size, const uint32_t attributes, const nano_os_heap_fallback_t fallback);
+
 #if (NANO_OS_HEAP_FREE_ENABLED == 1u)
 /** \brief De-allocate previously allocated memory from the heap */
 void NANO_OS_HEAP_Free(void* mem);
 #endif /* (NANO_OS_HEAP_FREE_ENABLED == 1u) */
 
+#if (NANO_OS_HEAP_CACHE_ENABLED == 1u)
+/** \brief Give all the blocks held by the size class caches back to the heap */
+nano_os_error_t NANO_OS_HEAP_FlushCaches(void);
+#endif /* (NANO_OS_HEAP_CACHE_ENABLED == 1u) */
+
 #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
 /** \brief Get the heap module statistics */
 nano_os_error_t NANO_OS_HEAP_GetStats(nano_os_heap_stats_t* const heap_stats);
 #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
 
+/** \brief Get the number of memory regions of the heap */
+nano_os_error_t NANO_OS_HEAP_GetRegionCount(uint32_t* const region_count);
+
+/** \brief Get the information on a memory region of the heap */
+nano_os_error_t NANO_OS_HEAP_GetRegionInfo(const uint32_t region_index, nano_os_heap_region_info_t* const region_info);
+
 
 #ifdef __cplusplus
 }
@@ -41,6 +41,11 @@ static void NANO_OS_STATS_ConsoleStackCmdHandler(void* const user_data, const ui
 static void NANO_OS_STATS_ConsoleMemstatsCmdHandler(void* const user_data, const uint32_t command_id, const char* const params);
 #endif /* (NANO_OS_STATS_MEMSTATS_CMD_ENABLED == 1u) */
 
+#if (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u)
+/** \brief Handle the 'timerstats' console command */
+static void NANO_OS_STATS_ConsoleTimerstatsCmdHandler(void* const user_data, const uint32_t command_id, const char* const params);
+#endif /* (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u) */
+
 /** \brief Console commands for the statistics module */
 static const nano_os_console_cmd_desc_t stats_module_commands[] = {
                                                                         {"tasks", "Display the list of the tasks", NANO_OS_STATS_ConsoleTasksCmdHandler},
@@ -52,6 +57,10 @@ static const nano_os_console_cmd_desc_t stats_module_commands[] = {
                                                                         #if (NANO_OS_STATS_MEMSTATS_CMD_ENABLED == 1u)
                                                                         {"memstats", "Display the memory statistics", NANO_OS_STATS_ConsoleMemstatsCmdHandler},
                                                                         #endif /* (NANO_OS_STATS_MEMSTATS_CMD_ENABLED == 1u) */
+
+                                                                        #if (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u)
+                                                                        {"timerstats", "[reset] Display the timer statistics", NANO_OS_STATS_ConsoleTimerstatsCmdHandler},
+                                                                        #endif /* (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u) */
                                                                   };
 
 #endif /* ((NANO_OS_CONSOLE_ENABLED == 1u) && (NANO_OS_STATS_CONSOLE_CMD_ENABLED == 1u)) */
@@ -141,6 +150,34 @@ nano_os_error_t NANO_OS_STATS_GetMemoryStats(nano_os_mem_stats_t* const memory_s
         memory_stats->waitable_timer_size = sizeof(nano_os_waitable_timer_t);
         #endif /* (NANO_OS_WAITABLE_TIMER_ENABLED == 1u) */
 
+        #if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+        memory_stats->blackboard_size = sizeof(nano_os_blackboard_t);
+        #endif /* (NANO_OS_BLACKBOARD_ENABLED == 1u) */
+
+        #if (NANO_OS_CHANNEL_ENABLED == 1u)
+        memory_stats->channel_size = sizeof(nano_os_channel_t);
+        #endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
+        #if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+        memory_stats->stream_buffer_size = sizeof(nano_os_stream_buffer_t);
+        #endif /* (NANO_OS_STREAM_BUFFER_ENABLED == 1u) */
+
+        #if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+        memory_stats->message_buffer_size = sizeof(nano_os_message_buffer_t);
+        #endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
+
+        #if (NANO_OS_WORKQUEUE_ENABLED == 1u)
+        memory_stats->workqueue_size = sizeof(nano_os_workqueue_t);
+        #endif /* (NANO_OS_WORKQUEUE_ENABLED == 1u) */
+
+        #if (NANO_OS_MEM_POOL_ENABLED == 1u)
+        memory_stats->mem_pool_size = sizeof(nano_os_mem_pool_t);
+        #endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
+
+        #if (NANO_OS_ARENA_ENABLED == 1u)
+        memory_stats->arena_size = sizeof(nano_os_arena_t);
+        #endif /* (NANO_OS_ARENA_ENABLED == 1u) */
+
         /* Compute the memory occupied by all the tasks */
         task = g_nano_os.tasks;
         memory_stats->all_tasks_size = 0u;
@@ -160,8 +197,14 @@ nano_os_error_t NANO_OS_STATS_GetMemoryStats(nano_os_mem_stats_t* const memory_s
             switch (wait_object->type)
             {
                 case WOT_TASK:
+                    /* Intended fallthrough */
+
+                case WOT_MAILBOX_SENDERS:
+                    /* Intended fallthrough */
+
+                case WOT_MESSAGE_BUFFER_SENDERS:
                 {
-                    /* Not taken into account because part of a task context */
+                    /* Not taken into account because part of a task context or of another object */
                     break;
                 }
 
@@ -213,6 +256,54 @@ nano_os_error_t NANO_OS_STATS_GetMemoryStats(nano_os_mem_stats_t* const memory_s
                 }
                 #endif /* (NANO_OS_TIMER_ENABLED == 1u) */
 
+                #if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+                case WOT_BLACKBOARD:
+                {
+                    memory_stats->all_os_objects_size += sizeof(nano_os_blackboard_t);
+                    break;
+                }
+                #endif /* (NANO_OS_BLACKBOARD_ENABLED == 1u) */
+
+                #if (NANO_OS_CHANNEL_ENABLED == 1u)
+                case WOT_CHANNEL:
+                {
+                    memory_stats->all_os_objects_size += sizeof(nano_os_channel_t);
+                    break;
+                }
+                #endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
+                #if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+                case WOT_STREAM_BUFFER:
+                {
+                    memory_stats->all_os_objects_size += sizeof(nano_os_stream_buffer_t);
+                    break;
+                }
+                #endif /* (NANO_OS_STREAM_BUFFER_ENABLED == 1u) */
+
+                #if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+                case WOT_MESSAGE_BUFFER:
+                {
+                    memory_stats->all_os_objects_size += sizeof(nano_os_message_buffer_t);
+                    break;
+                }
+                #endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
+
+                #if (NANO_OS_WORKQUEUE_ENABLED == 1u)
+                case WOT_WORKQUEUE:
+                {
+                    memory_stats->all_os_objects_size += sizeof(nano_os_workqueue_t);
+                    break;
+                }
+                #endif /* (NANO_OS_WORKQUEUE_ENABLED == 1u) */
+
+                #if (NANO_OS_MEM_POOL_ENABLED == 1u)
+                case WOT_MEM_POOL:
+                {
+                    memory_stats->all_os_objects_size += sizeof(nano_os_mem_pool_t);
+                    break;
+                }
+                #endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
+
                 default:
                 {
                     /* Invalid object */
@@ -282,12 +373,42 @@ nano_os_error_t NANO_OS_STATS_GetStackUsage(const nano_os_task_t* const task, ui
 #endif /* (NANO_OS_STATS_GETSTACKUSAGE_ENABLED == 1u) */
 
 
+#if (NANO_OS_STATS_GETTIMERSTATS_ENABLED == 1u)
+
+/** \brief Get the timer statistics and optionally reset them */
+nano_os_error_t NANO_OS_STATS_GetTimerStats(nano_os_timer_stats_t* const timer_stats, const bool reset)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if (timer_stats != NULL)
+    {
+        nano_os_int_status_reg_t int_status_reg;
+
+        /* Copy the statistics, they are updated by the timer task */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+        (void)MEMCPY(timer_stats, &g_nano_os.timer_wheel.stats, sizeof(nano_os_timer_stats_t));
+        if (reset)
+        {
+            (void)MEMSET(&g_nano_os.timer_wheel.stats, 0, sizeof(nano_os_timer_stats_t));
+        }
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_STATS_GETTIMERSTATS_ENABLED == 1u) */
+
+
 #if ((NANO_OS_CONSOLE_ENABLED == 1u) && (NANO_OS_STATS_CONSOLE_CMD_ENABLED == 1u))
 
 /** \brief Strings corresponding to task states */
 static const char* const task_states[] = { "FREE", "READY", "PENDING", "RUNNING", "DEAD" };
 /** \brief Strings corresponding to wait object types */
-static const char* const wait_objects[] = { "NOT_INIT", "TASK", "SEMAPHORE", "MUTEX", "COND_VAR", "TIMER", "MAILBOX", "FLAG_SET" };
+static const char* const wait_objects[] = { "NOT_INIT", "TASK", "SEMAPHORE", "MUTEX", "COND_VAR", "TIMER", "MAILBOX", "FLAG_SET", "BLACKBOARD", "CHANNEL", "STREAM_BUFFER", "MESSAGE_BUFFER", "WORKQUEUE", "MEM_POOL", "MAILBOX", "MESSAGE_BUFFER" };
 
 /** \brief Handle the 'tasks' console command */
 static void NANO_OS_STATS_ConsoleTasksCmdHandler(void* const user_data, const uint32_t command_id, const char* const params)
@@ -340,7 +461,7 @@ static void NANO_OS_STATS_ConsoleTasksCmdHandler(void* const user_data, const ui
             {
                 (void)NANO_OS_USER_ConsoleWriteString(" (");
                 if ((current->waiting_object != NULL) &&
-                    (current->waiting_object->type >= WOT_NOT_INIT) && (current->waiting_object->type <= WOT_FLAG_SET))
+                    (current->waiting_object->type >= WOT_NOT_INIT) && (current->waiting_object->type <= WOT_MESSAGE_BUFFER_SENDERS))
                 {
                     (void)NANO_OS_USER_ConsoleWriteString(wait_objects[current->waiting_object->type]);
                 }
@@ -510,6 +631,48 @@ static void NANO_OS_STATS_ConsoleMemstatsCmdHandler(void* const user_data, const
         (void)NANO_OS_USER_ConsoleWriteString(temp_str);
         #endif /* (NANO_OS_WAITABLE_TIMER_ENABLED == 1u) */
 
+        #if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Blackboard size : ");
+        (void)ITOA(memory_stats.blackboard_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_BLACKBOARD_ENABLED == 1u) */
+
+        #if (NANO_OS_CHANNEL_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Channel size : ");
+        (void)ITOA(memory_stats.channel_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
+        #if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Stream buffer size : ");
+        (void)ITOA(memory_stats.stream_buffer_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_STREAM_BUFFER_ENABLED == 1u) */
+
+        #if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Message buffer size : ");
+        (void)ITOA(memory_stats.message_buffer_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
+
+        #if (NANO_OS_WORKQUEUE_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Work queue size : ");
+        (void)ITOA(memory_stats.workqueue_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_WORKQUEUE_ENABLED == 1u) */
+
+        #if (NANO_OS_MEM_POOL_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Memory pool size : ");
+        (void)ITOA(memory_stats.mem_pool_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
+
+        #if (NANO_OS_ARENA_ENABLED == 1u)
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Arena size : ");
+        (void)ITOA(memory_stats.arena_size, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+        #endif /* (NANO_OS_ARENA_ENABLED == 1u) */
+
         (void)NANO_OS_USER_ConsoleWriteString("\r\n - All tasks size : ");
         (void)ITOA(memory_stats.all_tasks_size, temp_str, 10u);
         (void)NANO_OS_USER_ConsoleWriteString(temp_str);
@@ -518,6 +681,36 @@ static void NANO_OS_STATS_ConsoleMemstatsCmdHandler(void* const user_data, const
         (void)ITOA(memory_stats.all_os_objects_size, temp_str, 10u);
         (void)NANO_OS_USER_ConsoleWriteString(temp_str);
 
+        #if (NANO_OS_HEAP_ENABLED == 1u)
+        {
+            uint32_t i;
+            uint32_t region_count = 0u;
+            nano_os_heap_region_info_t region_info;
+
+            /* Usage of each memory region of the heap */
+            (void)NANO_OS_HEAP_GetRegionCount(&region_count);
+            for (i = 0u; i < region_count; i++)
+            {
+                if (NANO_OS_HEAP_GetRegionInfo(i, &region_info) == NOS_ERR_SUCCESS)
+                {
+                    (void)NANO_OS_USER_ConsoleWriteString("\r\n - Heap region ");
+                    (void)NANO_OS_USER_ConsoleWriteString(region_info.name);
+                    (void)NANO_OS_USER_ConsoleWriteString(" size : ");
+                    (void)ITOA(region_info.size, temp_str, 10u);
+                    (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+                    #if (NANO_OS_HEAP_GETSTATS_ENABLED == 1u)
+                    (void)NANO_OS_USER_ConsoleWriteString(", allocated : ");
+                    (void)ITOA(region_info.stats.allocated_memory, temp_str, 10u);
+                    (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+                    (void)NANO_OS_USER_ConsoleWriteString(", free : ");
+                    (void)ITOA(region_info.stats.free_memory, temp_str, 10u);
+                    (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+                    #endif /* (NANO_OS_HEAP_GETSTATS_ENABLED == 1u) */
+                }
+            }
+        }
+        #endif /* (NANO_OS_HEAP_ENABLED == 1u) */
+
         (void)NANO_OS_USER_ConsoleWriteString("\r\n");
     }
     else
@@ -528,6 +721,67 @@ static void NANO_OS_STATS_ConsoleMemstatsCmdHandler(void* const user_data, const
 
 #endif /* (NANO_OS_STATS_MEMSTATS_CMD_ENABLED == 1u) */
 
+
+#if (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u)
+
+/** \brief Handle the 'timerstats' console command */
+static void NANO_OS_STATS_ConsoleTimerstatsCmdHandler(void* const user_data, const uint32_t command_id, const char* const params)
+{
+    nano_os_error_t ret;
+    nano_os_timer_stats_t timer_stats;
+    bool reset = false;
+    NANO_OS_UNUSED(user_data);
+    NANO_OS_UNUSED(command_id);
+
+    /* Check if the statistics must be reset */
+    if ((params != NULL) && (STRNCMP(params, "reset", 6u) == 0))
+    {
+        reset = true;
+    }
+
+    /* Get the statistics */
+    ret = NANO_OS_STATS_GetTimerStats(&timer_stats, reset);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        char temp_str[12u];
+
+        /* Display statistics */
+        (void)NANO_OS_USER_ConsoleWriteString("Timer statistics :\r\n");
+
+        (void)NANO_OS_USER_ConsoleWriteString(" - Late expirations : ");
+        (void)ITOA(timer_stats.late_expiration_count, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Skipped periods : ");
+        (void)ITOA(timer_stats.skipped_period_count, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Max tick debt : ");
+        (void)ITOA(timer_stats.max_tick_debt, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Expirations : ");
+        (void)ITOA(timer_stats.expiration_count, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Coalesced expirations : ");
+        (void)ITOA(timer_stats.coalesced_expiration_count, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n - Timer task activations : ");
+        (void)ITOA(timer_stats.task_activation_count, temp_str, 10u);
+        (void)NANO_OS_USER_ConsoleWriteString(temp_str);
+
+        (void)NANO_OS_USER_ConsoleWriteString("\r\n");
+    }
+    else
+    {
+        (void)NANO_OS_USER_ConsoleWriteString("Unable to get timer statistics\r\n");
+    }
+}
+
+#endif /* (NANO_OS_STATS_TIMERSTATS_CMD_ENABLED == 1u) */
+
 #endif /* ((NANO_OS_CONSOLE_ENABLED == 1u) && (NANO_OS_STATS_CONSOLE_CMD_ENABLED == 1u)) */
 
 
@@ -26,6 +26,7 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #if (NANO_OS_STATS_ENABLED == 1u)
 
 #include "nano_os_task.h"
+#include "nano_os_timer.h"
 #include "nano_os_console.h"
 
 #ifdef __cplusplus
@@ -107,6 +108,41 @@ typedef struct _nano_os_mem_stats_t
     size_t waitable_timer_size;
     #endif /* (NANO_OS_WAITABLE_TIMER_ENABLED == 1u) */
 
+    #if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+    /** \brief Size of a blackboard in bytes */
+    size_t blackboard_size;
+    #endif /* (NANO_OS_BLACKBOARD_ENABLED == 1u) */
+
+    #if (NANO_OS_CHANNEL_ENABLED == 1u)
+    /** \brief Size of a channel in bytes */
+    size_t channel_size;
+    #endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
+    #if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+    /** \brief Size of a stream buffer in bytes */
+    size_t stream_buffer_size;
+    #endif /* (NANO_OS_STREAM_BUFFER_ENABLED == 1u) */
+
+    #if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+    /** \brief Size of a message buffer in bytes */
+    size_t message_buffer_size;
+    #endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
+
+    #if (NANO_OS_WORKQUEUE_ENABLED == 1u)
+    /** \brief Size of a work queue in bytes */
+    size_t workqueue_size;
+    #endif /* (NANO_OS_WORKQUEUE_ENABLED == 1u) */
+
+    #if (NANO_OS_MEM_POOL_ENABLED == 1u)
+    /** \brief Size of a memory pool in bytes */
+    size_t mem_pool_size;
+    #endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
+
+    #if (NANO_OS_ARENA_ENABLED == 1u)
+    /** \brief Size of an arena in bytes */
+    size_t arena_size;
+    #endif /* (NANO_OS_ARENA_ENABLED == 1u) */
+
     /** \brief Size of all the task managed by Nano OS (including their stack) in bytes */
     size_t all_tasks_size;
 
@@ -129,6 +165,12 @@ nano_os_error_t NANO_OS_STATS_GetStackUsage(const nano_os_task_t* const task, ui
 
 #endif /* (NANO_OS_STATS_GETSTACKUSAGE_ENABLED == 1u) */
 
+#if (NANO_OS_STATS_GETTIMERSTATS_ENABLED == 1u)
+
+/** \brief Get the timer statistics and optionally reset them */
+nano_os_error_t NANO_OS_STATS_GetTimerStats(nano_os_timer_stats_t* const timer_stats, const bool reset);
+
+#endif /* (NANO_OS_STATS_GETTIMERSTATS_ENABLED == 1u) */
 
 
 #ifdef __cplusplus
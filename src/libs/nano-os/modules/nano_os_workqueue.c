@@ -0,0 +1,556 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_workqueue.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_WORKQUEUE_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+/** \brief Make a work pending on a work queue */
+static nano_os_error_t NANO_OS_WORKQUEUE_AddWork(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work);
+
+/** \brief Add a work at the end of a work queue and wake up a worker */
+static nano_os_error_t NANO_OS_WORKQUEUE_LinkWork(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work);
+
+/** \brief Remove a queued work from its work queue */
+static nano_os_error_t NANO_OS_WORKQUEUE_RemoveWork(nano_os_work_t* const work);
+
+/** \brief Update the number of pending works after the completion or the cancellation of a work */
+static nano_os_error_t NANO_OS_WORKQUEUE_WorkDone(nano_os_workqueue_t* const workqueue);
+
+#if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+/** \brief Delayed work timer callback */
+static void NANO_OS_WORKQUEUE_TimerCallback(nano_os_timer_t* const timer, void* const user_data);
+#endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+
+/** \brief Worker task */
+static void* NANO_OS_WORKQUEUE_WorkerTask(void* const param);
+
+
+
+
+/** \brief Create a new work queue (the task function and the parameter of the worker tasks init data are ignored) */
+nano_os_error_t NANO_OS_WORKQUEUE_Create(nano_os_workqueue_t* const workqueue, nano_os_task_t* const workers,
+                                         const nano_os_task_init_data_t* const workers_init_data, const uint32_t worker_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((workqueue != NULL) && (workers != NULL) && (workers_init_data != NULL) && (worker_count != 0u))
+    {
+        /* 0 init of work queue */
+        (void)MEMSET(workqueue, 0, sizeof(nano_os_workqueue_t));
+
+        /* Init underlying wait objects */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&workqueue->wait_object, WOT_WORKQUEUE, QT_PRIORITY);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Initialize(&workqueue->flush_wait_object, WOT_TASK, QT_PRIORITY);
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            uint32_t i;
+
+            /* Initialize work queue data */
+            workqueue->first_work = NULL;
+            workqueue->last_work = NULL;
+            workqueue->pending_count = 0u;
+            workqueue->workers = workers;
+            workqueue->worker_count = worker_count;
+
+            /* Create the worker tasks, they will start at the end of the system call */
+            for (i = 0u; (i < worker_count) && (ret == NOS_ERR_SUCCESS); i++)
+            {
+                nano_os_task_init_data_t task_init_data;
+                (void)MEMCPY(&task_init_data, &workers_init_data[i], sizeof(nano_os_task_init_data_t));
+                task_init_data.task_func = NANO_OS_WORKQUEUE_WorkerTask;
+                task_init_data.param = workqueue;
+                ret = NANO_OS_TASK_Create(&workers[i], &task_init_data);
+            }
+
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, workqueue);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Initialize a work */
+nano_os_error_t NANO_OS_WORKQUEUE_InitWork(nano_os_work_t* const work, const fp_nano_os_work_func_t func, void* const context)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((work != NULL) && (func != NULL))
+    {
+        /* 0 init of work */
+        (void)MEMSET(work, 0, sizeof(nano_os_work_t));
+
+        /* Initialize work data */
+        work->func = func;
+        work->context = context;
+        work->state = NOS_WS_IDLE;
+        work->running = false;
+        work->workqueue = NULL;
+        work->next = NULL;
+
+        #if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+        /* Create the delay timer */
+        ret = NANO_OS_TIMER_Create(&work->timer, NANO_OS_WORKQUEUE_TimerCallback, work, NULL);
+        #else
+        ret = NOS_ERR_SUCCESS;
+        #endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+    }
+
+    return ret;
+}
+
+
+/** \brief Queue a work */
+nano_os_error_t NANO_OS_WORKQUEUE_Queue(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((workqueue != NULL) && (work != NULL) && (work->func != NULL) && (workqueue->wait_object.type == WOT_WORKQUEUE))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_WORKQUEUE_QUEUE, workqueue);
+
+        /* A pending work can't be queued twice, a running work can be queued again */
+        if ((work->state == NOS_WS_DELAYED) || (work->state == NOS_WS_QUEUED))
+        {
+            ret = NOS_ERR_WORK_PENDING;
+        }
+        else
+        {
+            ret = NANO_OS_WORKQUEUE_AddWork(workqueue, work);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+
+/** \brief Queue a work after a fixed number of ticks */
+nano_os_error_t NANO_OS_WORKQUEUE_QueueDelayed(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((workqueue != NULL) && (work != NULL) && (work->func != NULL) && (workqueue->wait_object.type == WOT_WORKQUEUE))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_WORKQUEUE_QUEUE, workqueue);
+
+        /* A pending work can't be queued twice, a running work can be queued again */
+        if ((work->state == NOS_WS_DELAYED) || (work->state == NOS_WS_QUEUED))
+        {
+            ret = NOS_ERR_WORK_PENDING;
+        }
+        else if (tick_count == 0u)
+        {
+            /* No delay */
+            ret = NANO_OS_WORKQUEUE_AddWork(workqueue, work);
+        }
+        else
+        {
+            /* Start the delay timer, the work will be queued by the timer task */
+            ret = NANO_OS_TIMER_Start(&work->timer, tick_count, 0u);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                work->workqueue = workqueue;
+                work->state = NOS_WS_DELAYED;
+            }
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+
+
+/** \brief Cancel a pending work (a running work is not interrupted) */
+nano_os_error_t NANO_OS_WORKQUEUE_Cancel(nano_os_work_t* const work)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((work != NULL) && (work->func != NULL))
+    {
+        /* Check work state */
+        if (work->state == NOS_WS_QUEUED)
+        {
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_WORKQUEUE_CANCEL, work->workqueue);
+
+            /* Remove the work from the queue */
+            if (work->running)
+            {
+                /* The work has been queued again during its execution
+                   but it has not been dispatched yet */
+                work->state = NOS_WS_RUNNING;
+                ret = NOS_ERR_SUCCESS;
+            }
+            else
+            {
+                ret = NANO_OS_WORKQUEUE_RemoveWork(work);
+                if (ret == NOS_ERR_SUCCESS)
+                {
+                    work->state = NOS_WS_IDLE;
+                }
+            }
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                ret = NANO_OS_WORKQUEUE_WorkDone(work->workqueue);
+            }
+        }
+        #if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+        else if (work->state == NOS_WS_DELAYED)
+        {
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_WORKQUEUE_CANCEL, work->workqueue);
+
+            /* Stop the delay timer, if it has already elapsed
+               the timer callback will ignore the cancelled work */
+            (void)NANO_OS_TIMER_Stop(&work->timer);
+            work->state = NOS_WS_IDLE;
+            ret = NOS_ERR_SUCCESS;
+        }
+        #endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+        else
+        {
+            ret = NOS_ERR_WORK_NOT_PENDING;
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Wait for the completion of all the queued and running works of a work queue for fixed number of ticks */
+nano_os_error_t NANO_OS_WORKQUEUE_Flush(nano_os_workqueue_t* const workqueue, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((workqueue != NULL) && (workqueue->wait_object.type == WOT_WORKQUEUE))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_WORKQUEUE_FLUSH, workqueue);
+
+        /* Check if some works are still pending */
+        if (workqueue->pending_count == 0u)
+        {
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            /* Wait for the completion of the works */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&workqueue->flush_wait_object, tick_count);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_WORKQUEUE_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a work queue */
+nano_os_error_t NANO_OS_WORKQUEUE_SetName(nano_os_workqueue_t* const workqueue, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (workqueue != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, workqueue);
+
+        /* Save the name */
+        workqueue->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_WORKQUEUE_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Make a work pending on a work queue */
+static nano_os_error_t NANO_OS_WORKQUEUE_AddWork(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Update work state */
+    work->workqueue = workqueue;
+    work->state = NOS_WS_QUEUED;
+    workqueue->pending_count++;
+
+    /* A running work is only added to the queue once its execution has
+       completed so that it never runs concurrently on several workers */
+    if (!work->running)
+    {
+        ret = NANO_OS_WORKQUEUE_LinkWork(workqueue, work);
+    }
+
+    return ret;
+}
+
+
+/** \brief Add a work at the end of a work queue and wake up a worker */
+static nano_os_error_t NANO_OS_WORKQUEUE_LinkWork(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work)
+{
+    uint32_t woke_up_task_count = 0u;
+
+    /* Add the work to the queue */
+    work->next = NULL;
+    if (workqueue->last_work == NULL)
+    {
+        workqueue->first_work = work;
+    }
+    else
+    {
+        workqueue->last_work->next = work;
+    }
+    workqueue->last_work = work;
+
+    /* Wake up a worker */
+    return NANO_OS_WAIT_OBJECT_Signal(&workqueue->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+}
+
+
+/** \brief Remove a queued work from its work queue */
+static nano_os_error_t NANO_OS_WORKQUEUE_RemoveWork(nano_os_work_t* const work)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+    nano_os_workqueue_t* const workqueue = work->workqueue;
+    nano_os_work_t* previous = NULL;
+    nano_os_work_t* current = workqueue->first_work;
+
+    /* Look for the work */
+    while ((current != NULL) && (current != work))
+    {
+        previous = current;
+        current = current->next;
+    }
+    if (current != NULL)
+    {
+        /* Remove the work */
+        if (previous == NULL)
+        {
+            workqueue->first_work = work->next;
+        }
+        else
+        {
+            previous->next = work->next;
+        }
+        if (workqueue->last_work == work)
+        {
+            workqueue->last_work = previous;
+        }
+        work->next = NULL;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Update the number of pending works after the completion or the cancellation of a work */
+static nano_os_error_t NANO_OS_WORKQUEUE_WorkDone(nano_os_workqueue_t* const workqueue)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Wake up all the tasks waiting for the completion of the works */
+    workqueue->pending_count--;
+    if (workqueue->pending_count == 0u)
+    {
+        uint32_t woke_up_task_count = 0u;
+        ret = NANO_OS_WAIT_OBJECT_Signal(&workqueue->flush_wait_object, NOS_ERR_SUCCESS, true, NULL, &woke_up_task_count);
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+
+/** \brief Delayed work timer callback */
+static void NANO_OS_WORKQUEUE_TimerCallback(nano_os_timer_t* const timer, void* const user_data)
+{
+    nano_os_work_t* const work = NANO_OS_CAST(nano_os_work_t*, user_data);
+    NANO_OS_UNUSED(timer);
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Queue the work if it has not been cancelled meanwhile */
+    if (work->state == NOS_WS_DELAYED)
+    {
+        const nano_os_error_t ret = NANO_OS_WORKQUEUE_AddWork(work->workqueue, work);
+        NANO_OS_ERROR_ASSERT_RET(ret);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+}
+
+#endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+
+
+/** \brief Worker task */
+static void* NANO_OS_WORKQUEUE_WorkerTask(void* const param)
+{
+    nano_os_workqueue_t* const workqueue = NANO_OS_CAST(nano_os_workqueue_t*, param);
+
+    /* Task loop */
+    while (true)
+    {
+        nano_os_error_t ret = NOS_ERR_SUCCESS;
+        nano_os_work_t* work = NULL;
+
+        /* Syscall entry */
+        NANO_OS_SYSCALL_Enter(true);
+
+        /* Wait for a work */
+        if (workqueue->first_work == NULL)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Wait(&workqueue->wait_object, 0xFFFFFFFFu);
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Take the first work, another worker may already have taken it */
+            work = workqueue->first_work;
+            if (work != NULL)
+            {
+                workqueue->first_work = work->next;
+                if (workqueue->first_work == NULL)
+                {
+                    workqueue->last_work = NULL;
+                }
+                work->next = NULL;
+                work->state = NOS_WS_RUNNING;
+                work->running = true;
+            }
+        }
+
+        /* Syscall exit */
+        NANO_OS_SYSCALL_Exit();
+
+        /* Check wait status */
+        if (work != NULL)
+        {
+            /* Execute the work */
+            work->func(work->context);
+
+            /* Syscall entry */
+            NANO_OS_SYSCALL_Enter(true);
+
+            /* The work may have been queued again during its execution,
+               it can now be dispatched to any worker */
+            work->running = false;
+            if (work->state == NOS_WS_RUNNING)
+            {
+                work->state = NOS_WS_IDLE;
+            }
+            else if (work->state == NOS_WS_QUEUED)
+            {
+                ret = NANO_OS_WORKQUEUE_LinkWork(work->workqueue, work);
+            }
+            else
+            {
+                /* Delayed again, the timer will queue the work */
+            }
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                ret = NANO_OS_WORKQUEUE_WorkDone(workqueue);
+            }
+            NANO_OS_ERROR_ASSERT_RET(ret);
+
+            /* Syscall exit */
+            NANO_OS_SYSCALL_Exit();
+        }
+        else if ((ret == NOS_ERR_SUCCESS) || (ret == NOS_ERR_TIMEOUT))
+        {
+            /* No work to execute, return in wait state */
+        }
+        else
+        {
+            /* Critical error */
+            NANO_OS_ERROR_Handler(ret);
+        }
+    }
+
+    return NULL;
+}
+
+
+#endif /* (NANO_OS_WORKQUEUE_ENABLED == 1u) */
@@ -0,0 +1,147 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_WORKQUEUE_H
+#define NANO_OS_WORKQUEUE_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_WORKQUEUE_ENABLED == 1u)
+
+
+#include "nano_os_task.h"
+#include "nano_os_timer.h"
+#include "nano_os_wait_object.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Work function */
+typedef void (*fp_nano_os_work_func_t)(void* const context);
+
+
+/** \brief Nano OS work states */
+typedef enum _nano_os_work_state_t
+{
+    /** \brief Work is not pending */
+    NOS_WS_IDLE = 0u,
+    /** \brief Work is waiting for its delay to elapse */
+    NOS_WS_DELAYED = 1u,
+    /** \brief Work is queued */
+    NOS_WS_QUEUED = 2u,
+    /** \brief Work is being executed */
+    NOS_WS_RUNNING = 3u
+} nano_os_work_state_t;
+
+
+/** \brief Nano OS work queue pre-declaration */
+struct _nano_os_workqueue_t;
+
+
+/** \brief Nano OS work item */
+typedef struct _nano_os_work_t
+{
+    /** \brief Work function */
+    fp_nano_os_work_func_t func;
+    /** \brief Work context */
+    void* context;
+    /** \brief Work state */
+    nano_os_work_state_t state;
+    /** \brief Indicate if the work is being executed (it may have been queued again meanwhile) */
+    bool running;
+    /** \brief Work queue on which the work is pending */
+    struct _nano_os_workqueue_t* workqueue;
+    /** \brief Next queued work */
+    struct _nano_os_work_t* next;
+
+    #if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+    /** \brief Timer for delayed work */
+    nano_os_timer_t timer;
+    #endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+} nano_os_work_t;
+
+
+/** \brief Nano OS work queue
+ *         Works are executed in order by a pool of worker tasks
+ *         which can be created at different priorities
+ */
+typedef struct _nano_os_workqueue_t
+{
+    /** \brief Underlying wait object (worker tasks waiting for a work) */
+    nano_os_wait_object_t wait_object;
+    /** \brief Wait object for the tasks waiting for the completion of the works */
+    nano_os_wait_object_t flush_wait_object;
+
+    /** \brief First queued work */
+    nano_os_work_t* first_work;
+    /** \brief Last queued work */
+    nano_os_work_t* last_work;
+    /** \brief Number of queued or running works */
+    uint32_t pending_count;
+    /** \brief Worker tasks */
+    nano_os_task_t* workers;
+    /** \brief Number of worker tasks */
+    uint32_t worker_count;
+} nano_os_workqueue_t;
+
+
+
+
+/** \brief Create a new work queue (the task function and the parameter of the worker tasks init data are ignored) */
+nano_os_error_t NANO_OS_WORKQUEUE_Create(nano_os_workqueue_t* const workqueue, nano_os_task_t* const workers,
+                                         const nano_os_task_init_data_t* const workers_init_data, const uint32_t worker_count);
+
+/** \brief Initialize a work */
+nano_os_error_t NANO_OS_WORKQUEUE_InitWork(nano_os_work_t* const work, const fp_nano_os_work_func_t func, void* const context);
+
+/** \brief Queue a work */
+nano_os_error_t NANO_OS_WORKQUEUE_Queue(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work);
+
+#if (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u)
+
+/** \brief Queue a work after a fixed number of ticks */
+nano_os_error_t NANO_OS_WORKQUEUE_QueueDelayed(nano_os_workqueue_t* const workqueue, nano_os_work_t* const work, const uint32_t tick_count);
+
+#endif /* (NANO_OS_WORKQUEUE_DELAYED_ENABLED == 1u) */
+
+/** \brief Cancel a pending work (a running work is not interrupted) */
+nano_os_error_t NANO_OS_WORKQUEUE_Cancel(nano_os_work_t* const work);
+
+/** \brief Wait for the completion of all the queued and running works of a work queue for fixed number of ticks */
+nano_os_error_t NANO_OS_WORKQUEUE_Flush(nano_os_workqueue_t* const workqueue, const uint32_t tick_count);
+
+#if (NANO_OS_WORKQUEUE_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a work queue */
+nano_os_error_t NANO_OS_WORKQUEUE_SetName(nano_os_workqueue_t* const workqueue, const char* const name);
+
+#endif /* (NANO_OS_WORKQUEUE_SETNAME_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_WORKQUEUE_ENABLED == 1u) */
+
+#endif /* NANO_OS_WORKQUEUE_H */
@@ -39,6 +39,17 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 	.global NANO_OS_PORT_SaveInterruptStatus
 	.global NANO_OS_PORT_RestoreInterruptStatus
 
+	.global NANO_OS_PORT_AtomicCas32
+	.global NANO_OS_PORT_AtomicCasPtr
+	.global NANO_OS_PORT_AtomicLoad32
+	.global NANO_OS_PORT_AtomicLoadPtr
+	.global NANO_OS_PORT_AtomicStore32
+	.global NANO_OS_PORT_AtomicStorePtr
+	.global NANO_OS_PORT_AtomicExchange32
+	.global NANO_OS_PORT_AtomicExchangePtr
+	.global NANO_OS_PORT_AtomicFetchAdd32
+	.global NANO_OS_PORT_AtomicFetchOr32
+
 	.global NANO_OS_PORT_FirstContextSwitchAsm
 	.global NANO_OS_PORT_ContextSwitch
 	.global NANO_OS_PORT_ContextSwitchFromIsr
@@ -86,6 +97,121 @@ NANO_OS_PORT_RestoreInterruptStatus:
     bx      lr
 
 
+.thumb_func
+.type NANO_OS_PORT_AtomicCasPtr, %function
+/* bool NANO_OS_PORT_AtomicCasPtr(void* volatile* const var, void* const expected, void* const desired)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicCas32 */
+NANO_OS_PORT_AtomicCasPtr:
+
+.thumb_func
+.type NANO_OS_PORT_AtomicCas32, %function
+/* bool NANO_OS_PORT_AtomicCas32(volatile uint32_t* const var, const uint32_t expected, const uint32_t desired)
+   Atomically replace the value of a 32bits variable if it is equal to the expected value (no exclusive access
+   instructions on this core, interrupts are masked during the compare and swap) -> Register R0 */
+NANO_OS_PORT_AtomicCas32:
+
+    push    {r4}
+    mrs     r3, primask
+    cpsid   i
+    ldr     r4, [r0]
+    cmp     r4, r1
+    bne     NANO_OS_PORT_AtomicCas32_Fail
+    str     r2, [r0]
+    movs    r0, #1
+    b       NANO_OS_PORT_AtomicCas32_End
+NANO_OS_PORT_AtomicCas32_Fail:
+    movs    r0, #0
+NANO_OS_PORT_AtomicCas32_End:
+    msr     primask, r3
+    pop     {r4}
+    bx      lr
+
+
+.thumb_func
+.type NANO_OS_PORT_AtomicLoadPtr, %function
+/* void* NANO_OS_PORT_AtomicLoadPtr(void* volatile* const var)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicLoad32 */
+NANO_OS_PORT_AtomicLoadPtr:
+.thumb_func
+.type NANO_OS_PORT_AtomicLoad32, %function
+/* uint32_t NANO_OS_PORT_AtomicLoad32(const volatile uint32_t* const var)
+   Atomically read the value of a 32bits variable -> Register R0 */
+NANO_OS_PORT_AtomicLoad32:
+
+    ldr     r0, [r0]
+    bx      lr
+
+
+.thumb_func
+.type NANO_OS_PORT_AtomicStorePtr, %function
+/* void NANO_OS_PORT_AtomicStorePtr(void* volatile* const var, void* const value)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicStore32 */
+NANO_OS_PORT_AtomicStorePtr:
+.thumb_func
+.type NANO_OS_PORT_AtomicStore32, %function
+/* void NANO_OS_PORT_AtomicStore32(volatile uint32_t* const var, const uint32_t value)
+   Atomically write the value of a 32bits variable */
+NANO_OS_PORT_AtomicStore32:
+
+    str     r1, [r0]
+    bx      lr
+
+
+.thumb_func
+.type NANO_OS_PORT_AtomicExchangePtr, %function
+/* void* NANO_OS_PORT_AtomicExchangePtr(void* volatile* const var, void* const value)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicExchange32 */
+NANO_OS_PORT_AtomicExchangePtr:
+.thumb_func
+.type NANO_OS_PORT_AtomicExchange32, %function
+/* uint32_t NANO_OS_PORT_AtomicExchange32(volatile uint32_t* const var, const uint32_t value)
+   Atomically replace the value of a 32bits variable and return its previous value (no exclusive access
+   instructions on this core, interrupts are masked during the operation) -> Register R0 */
+NANO_OS_PORT_AtomicExchange32:
+
+    mrs     r2, primask
+    cpsid   i
+    ldr     r3, [r0]
+    str     r1, [r0]
+    msr     primask, r2
+    movs    r0, r3
+    bx      lr
+
+
+.thumb_func
+.type NANO_OS_PORT_AtomicFetchAdd32, %function
+/* uint32_t NANO_OS_PORT_AtomicFetchAdd32(volatile uint32_t* const var, const uint32_t value)
+   Atomically add a value to a 32bits variable and return its previous value (no exclusive access
+   instructions on this core, interrupts are masked during the operation) -> Register R0 */
+NANO_OS_PORT_AtomicFetchAdd32:
+
+    mrs     r2, primask
+    cpsid   i
+    ldr     r3, [r0]
+    adds    r1, r1, r3
+    str     r1, [r0]
+    msr     primask, r2
+    movs    r0, r3
+    bx      lr
+
+
+.thumb_func
+.type NANO_OS_PORT_AtomicFetchOr32, %function
+/* uint32_t NANO_OS_PORT_AtomicFetchOr32(volatile uint32_t* const var, const uint32_t value)
+   Atomically OR a value into a 32bits variable and return its previous value (no exclusive access
+   instructions on this core, interrupts are masked during the operation) -> Register R0 */
+NANO_OS_PORT_AtomicFetchOr32:
+
+    mrs     r2, primask
+    cpsid   i
+    ldr     r3, [r0]
+    orrs    r1, r1, r3
+    str     r1, [r0]
+    msr     primask, r2
+    movs    r0, r3
+    bx      lr
+
+
 
 
 .thumb_func
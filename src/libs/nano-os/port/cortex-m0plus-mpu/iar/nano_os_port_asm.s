@@ -36,6 +36,17 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 	PUBLIC NANO_OS_PORT_SaveInterruptStatus
 	PUBLIC NANO_OS_PORT_RestoreInterruptStatus
 
+	PUBLIC NANO_OS_PORT_AtomicCas32
+	PUBLIC NANO_OS_PORT_AtomicCasPtr
+	PUBLIC NANO_OS_PORT_AtomicLoad32
+	PUBLIC NANO_OS_PORT_AtomicLoadPtr
+	PUBLIC NANO_OS_PORT_AtomicStore32
+	PUBLIC NANO_OS_PORT_AtomicStorePtr
+	PUBLIC NANO_OS_PORT_AtomicExchange32
+	PUBLIC NANO_OS_PORT_AtomicExchangePtr
+	PUBLIC NANO_OS_PORT_AtomicFetchAdd32
+	PUBLIC NANO_OS_PORT_AtomicFetchOr32
+
 	PUBLIC NANO_OS_PORT_FirstContextSwitchAsm
 	PUBLIC NANO_OS_PORT_ContextSwitch
 	PUBLIC NANO_OS_PORT_ContextSwitchFromIsr
@@ -77,6 +88,101 @@ NANO_OS_PORT_RestoreInterruptStatus:
     bx      lr
 
 
+/* bool NANO_OS_PORT_AtomicCasPtr(void* volatile* const var, void* const expected, void* const desired)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicCas32 */
+NANO_OS_PORT_AtomicCasPtr:
+
+/* bool NANO_OS_PORT_AtomicCas32(volatile uint32_t* const var, const uint32_t expected, const uint32_t desired)
+   Atomically replace the value of a 32bits variable if it is equal to the expected value (no exclusive access
+   instructions on this core, interrupts are masked during the compare and swap) -> Register R0 */
+NANO_OS_PORT_AtomicCas32:
+
+    push    {r4}
+    mrs     r3, primask
+    cpsid   i
+    ldr     r4, [r0]
+    cmp     r4, r1
+    bne     NANO_OS_PORT_AtomicCas32_Fail
+    str     r2, [r0]
+    movs    r0, #1
+    b       NANO_OS_PORT_AtomicCas32_End
+NANO_OS_PORT_AtomicCas32_Fail:
+    movs    r0, #0
+NANO_OS_PORT_AtomicCas32_End:
+    msr     primask, r3
+    pop     {r4}
+    bx      lr
+
+
+/* void* NANO_OS_PORT_AtomicLoadPtr(void* volatile* const var)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicLoad32 */
+NANO_OS_PORT_AtomicLoadPtr:
+/* uint32_t NANO_OS_PORT_AtomicLoad32(const volatile uint32_t* const var)
+   Atomically read the value of a 32bits variable -> Register R0 */
+NANO_OS_PORT_AtomicLoad32:
+
+    ldr     r0, [r0]
+    bx      lr
+
+
+/* void NANO_OS_PORT_AtomicStorePtr(void* volatile* const var, void* const value)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicStore32 */
+NANO_OS_PORT_AtomicStorePtr:
+/* void NANO_OS_PORT_AtomicStore32(volatile uint32_t* const var, const uint32_t value)
+   Atomically write the value of a 32bits variable */
+NANO_OS_PORT_AtomicStore32:
+
+    str     r1, [r0]
+    bx      lr
+
+
+/* void* NANO_OS_PORT_AtomicExchangePtr(void* volatile* const var, void* const value)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicExchange32 */
+NANO_OS_PORT_AtomicExchangePtr:
+/* uint32_t NANO_OS_PORT_AtomicExchange32(volatile uint32_t* const var, const uint32_t value)
+   Atomically replace the value of a 32bits variable and return its previous value (no exclusive access
+   instructions on this core, interrupts are masked during the operation) -> Register R0 */
+NANO_OS_PORT_AtomicExchange32:
+
+    mrs     r2, primask
+    cpsid   i
+    ldr     r3, [r0]
+    str     r1, [r0]
+    msr     primask, r2
+    movs    r0, r3
+    bx      lr
+
+
+/* uint32_t NANO_OS_PORT_AtomicFetchAdd32(volatile uint32_t* const var, const uint32_t value)
+   Atomically add a value to a 32bits variable and return its previous value (no exclusive access
+   instructions on this core, interrupts are masked during the operation) -> Register R0 */
+NANO_OS_PORT_AtomicFetchAdd32:
+
+    mrs     r2, primask
+    cpsid   i
+    ldr     r3, [r0]
+    adds    r1, r1, r3
+    str     r1, [r0]
+    msr     primask, r2
+    movs    r0, r3
+    bx      lr
+
+
+/* uint32_t NANO_OS_PORT_AtomicFetchOr32(volatile uint32_t* const var, const uint32_t value)
+   Atomically OR a value into a 32bits variable and return its previous value (no exclusive access
+   instructions on this core, interrupts are masked during the operation) -> Register R0 */
+NANO_OS_PORT_AtomicFetchOr32:
+
+    mrs     r2, primask
+    cpsid   i
+    ldr     r3, [r0]
+    orrs    r1, r1, r3
+    str     r1, [r0]
+    msr     primask, r2
+    movs    r0, r3
+    bx      lr
+
+
 
 
 /* void NANO_OS_PORT_SwitchToPriviledgedMode(void)
@@ -50,6 +50,9 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #define NANO_OS_PORT_PROVIDES_SYSTEM_TIMER              0u
 #endif /* NANO_OS_PORT_CM_NO_SYSTICK */
 
+/** \brief Indicate if the port provides the high resolution timer for Nano OS */
+#define NANO_OS_PORT_PROVIDES_HR_TIMER                  0u
+
 /** \brief Minimum stack size in number of elements for this port */
 #define NANO_OS_PORT_MIN_STACK_SIZE                     64u
 
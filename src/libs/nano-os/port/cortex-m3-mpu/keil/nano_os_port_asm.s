@@ -37,6 +37,20 @@ MPU_RBAR_REG  EQU     0xE000ED9C
 	EXPORT NANO_OS_PORT_SaveInterruptStatus
 	EXPORT NANO_OS_PORT_RestoreInterruptStatus
 
+	EXPORT NANO_OS_PORT_RaiseBasepri
+	EXPORT NANO_OS_PORT_SetBasepri
+
+	EXPORT NANO_OS_PORT_AtomicCas32
+	EXPORT NANO_OS_PORT_AtomicCasPtr
+	EXPORT NANO_OS_PORT_AtomicLoad32
+	EXPORT NANO_OS_PORT_AtomicLoadPtr
+	EXPORT NANO_OS_PORT_AtomicStore32
+	EXPORT NANO_OS_PORT_AtomicStorePtr
+	EXPORT NANO_OS_PORT_AtomicExchange32
+	EXPORT NANO_OS_PORT_AtomicExchangePtr
+	EXPORT NANO_OS_PORT_AtomicFetchAdd32
+	EXPORT NANO_OS_PORT_AtomicFetchOr32
+
 	EXPORT NANO_OS_PORT_FirstContextSwitchAsm
 	EXPORT NANO_OS_PORT_ContextSwitch
 	EXPORT NANO_OS_PORT_ContextSwitchFromIsr
@@ -48,6 +62,7 @@ MPU_RBAR_REG  EQU     0xE000ED9C
 	EXPORT NANO_OS_PORT_PendSvHandler
 
     EXTERN g_nano_os
+    EXTERN g_nano_os_port_kernel_basepri
 
 
 
@@ -78,6 +93,110 @@ NANO_OS_PORT_RestoreInterruptStatus
     bx      lr
 
 
+/* nano_os_int_status_reg_t NANO_OS_PORT_RaiseBasepri(const uint32_t basepri)
+   Raise the interrupt masking level and return the previous value of the BASEPRI register -> Register R0 */
+NANO_OS_PORT_RaiseBasepri
+
+    mrs     r1, basepri
+    msr     basepri_max, r0
+    isb
+    mov     r0, r1
+    bx      lr
+
+
+/* void NANO_OS_PORT_SetBasepri(const uint32_t basepri)
+   Set the interrupt masking level -> Register R0 */
+NANO_OS_PORT_SetBasepri
+
+    msr     basepri, r0
+    bx      lr
+
+
+/* bool NANO_OS_PORT_AtomicCasPtr(void* volatile* const var, void* const expected, void* const desired)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicCas32 */
+NANO_OS_PORT_AtomicCasPtr
+
+/* bool NANO_OS_PORT_AtomicCas32(volatile uint32_t* const var, const uint32_t expected, const uint32_t desired)
+   Atomically replace the value of a 32bits variable if it is equal to the expected value (exclusive access) -> Register R0 */
+NANO_OS_PORT_AtomicCas32
+
+    ldrex   r3, [r0]
+    cmp     r3, r1
+    bne     NANO_OS_PORT_AtomicCas32_Fail
+    strex   r3, r2, [r0]
+    cmp     r3, #0
+    bne     NANO_OS_PORT_AtomicCas32
+    movs    r0, #1
+    bx      lr
+NANO_OS_PORT_AtomicCas32_Fail
+    clrex
+    movs    r0, #0
+    bx      lr
+
+
+/* void* NANO_OS_PORT_AtomicLoadPtr(void* volatile* const var)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicLoad32 */
+NANO_OS_PORT_AtomicLoadPtr
+/* uint32_t NANO_OS_PORT_AtomicLoad32(const volatile uint32_t* const var)
+   Atomically read the value of a 32bits variable -> Register R0 */
+NANO_OS_PORT_AtomicLoad32
+
+    ldr     r0, [r0]
+    bx      lr
+
+
+/* void NANO_OS_PORT_AtomicStorePtr(void* volatile* const var, void* const value)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicStore32 */
+NANO_OS_PORT_AtomicStorePtr
+/* void NANO_OS_PORT_AtomicStore32(volatile uint32_t* const var, const uint32_t value)
+   Atomically write the value of a 32bits variable */
+NANO_OS_PORT_AtomicStore32
+
+    str     r1, [r0]
+    bx      lr
+
+
+/* void* NANO_OS_PORT_AtomicExchangePtr(void* volatile* const var, void* const value)
+   Pointers are 32bits wide on this core, same implementation as NANO_OS_PORT_AtomicExchange32 */
+NANO_OS_PORT_AtomicExchangePtr
+/* uint32_t NANO_OS_PORT_AtomicExchange32(volatile uint32_t* const var, const uint32_t value)
+   Atomically replace the value of a 32bits variable and return its previous value (exclusive access) -> Register R0 */
+NANO_OS_PORT_AtomicExchange32
+
+    ldrex   r2, [r0]
+    strex   r3, r1, [r0]
+    cmp     r3, #0
+    bne     NANO_OS_PORT_AtomicExchange32
+    mov     r0, r2
+    bx      lr
+
+
+/* uint32_t NANO_OS_PORT_AtomicFetchAdd32(volatile uint32_t* const var, const uint32_t value)
+   Atomically add a value to a 32bits variable and return its previous value (exclusive access) -> Register R0 */
+NANO_OS_PORT_AtomicFetchAdd32
+
+    ldrex   r2, [r0]
+    add     r3, r2, r1
+    strex   r12, r3, [r0]
+    cmp     r12, #0
+    bne     NANO_OS_PORT_AtomicFetchAdd32
+    mov     r0, r2
+    bx      lr
+
+
+/* uint32_t NANO_OS_PORT_AtomicFetchOr32(volatile uint32_t* const var, const uint32_t value)
+   Atomically OR a value into a 32bits variable and return its previous value (exclusive access) -> Register R0 */
+NANO_OS_PORT_AtomicFetchOr32
+
+    ldrex   r2, [r0]
+    orr     r3, r2, r1
+    strex   r12, r3, [r0]
+    cmp     r12, #0
+    bne     NANO_OS_PORT_AtomicFetchOr32
+    mov     r0, r2
+    bx      lr
+
+
 
 
 /* void NANO_OS_PORT_SwitchToPriviledgedMode(void)
@@ -110,6 +229,8 @@ NANO_OS_PORT_FirstContextSwitchAsm
     mov		sp, r1
 
     /* Enable interrupts */
+    movs    r0, #0
+    msr     basepri, r0
     cpsie	i
 
 	/* Start first context switch */
@@ -147,11 +268,19 @@ NANO_OS_PORT_ContextSwitch
     orr     r2, r2, r0
     str     r2, [r1]
 
+    /* Save the interrupt masking state of the OS protected code */
+    mrs     r2, primask
+    mrs     r3, basepri
+
     /* Enable interrupt to perform context switch */
+    movs    r0, #0
+    msr     basepri, r0
     cpsie   i
+    isb
 
     /* Disable interrupt before returning to OS */
-    cpsid   i
+    msr     basepri, r3
+    msr     primask, r2
 
     /* Return to OS protected code */
     bx      lr
@@ -224,8 +353,16 @@ NANO_OS_PORT_SvcHandler_SwitchToPriviledgedMode
    Handler for the PendSv exception. Performs context switchs */
 NANO_OS_PORT_PendSvHandler
 
-    /* Disable interrupts */
+    /* Disable interrupts (only the ones which can call the OS if BASEPRI is used) */
+    ldr     r0, =g_nano_os_port_kernel_basepri
+    ldr     r0, [r0]
+    cbnz    r0, NANO_OS_PORT_PendSvHandler_UseBasepri
     cpsid   i
+    b       NANO_OS_PORT_PendSvHandler_Masked
+NANO_OS_PORT_PendSvHandler_UseBasepri
+    msr     basepri, r0
+    isb
+NANO_OS_PORT_PendSvHandler_Masked
 
     /* Save the additionnals registers to the current task stack */
     mrs		r12, psp
@@ -265,6 +402,8 @@ NANO_OS_PORT_PendSvHandler
     msr		psp, r12
 
     /* Enable interrupts */
+    movs    r0, #0
+    msr     basepri, r0
     cpsie   i
 
     /* Exit exception */
@@ -50,6 +50,22 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #define NANO_OS_PORT_PROVIDES_SYSTEM_TIMER              0u
 #endif /* NANO_OS_PORT_CM_NO_SYSTICK */
 
+/** \brief Indicate if the port provides the high resolution timer for Nano OS */
+#define NANO_OS_PORT_PROVIDES_HR_TIMER                  0u
+
+#ifdef NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY
+/** \brief Indicate if the port masks the interrupts in the critical sections using the BASEPRI register
+           (interrupts with a higher priority than NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY are never masked) */
+#define NANO_OS_PORT_USE_BASEPRI                        1u
+#if (NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY == 0u)
+#error "NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY must not be 0 (BASEPRI = 0 doesn't mask any interrupt)"
+#endif /* (NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY == 0u) */
+#else
+/** \brief Indicate if the port masks the interrupts in the critical sections using the BASEPRI register
+           (interrupts with a higher priority than NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY are never masked) */
+#define NANO_OS_PORT_USE_BASEPRI                        0u
+#endif /* NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY */
+
 /** \brief Minimum stack size in number of elements for this port */
 #define NANO_OS_PORT_MIN_STACK_SIZE                     64u
 
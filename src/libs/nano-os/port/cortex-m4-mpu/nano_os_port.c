@@ -45,6 +45,26 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Address of the Systick current value register */
 #define SYSTICK_CVR_REG        (* NANO_OS_CAST(volatile uint32_t*, 0xe000e018))
 
+/** \brief Address of the Interrupt Control and State register */
+#define ICSR_REG               (* NANO_OS_CAST(volatile uint32_t*, 0xe000ed04))
+
+/** \brief Address of the System Handler Priority register 3 (PendSV and Systick priorities) */
+#define SHPR3_REG              (* NANO_OS_CAST(volatile uint32_t*, 0xe000ed20))
+
+/** \brief Address of the System Handler Priority registers (byte access, first entry is exception 4) */
+#define SHPR_BYTE_REGS         NANO_OS_CAST(volatile uint8_t*, 0xe000ed18)
+
+/** \brief Address of the NVIC Interrupt Priority registers (byte access, first entry is exception 16) */
+#define NVIC_IPR_BYTE_REGS     NANO_OS_CAST(volatile uint8_t*, 0xe000e400)
+
+
+/** \brief Value of the BASEPRI register used to mask the interrupts in the PendSV handler (0 = use PRIMASK) */
+#if (NANO_OS_PORT_USE_BASEPRI == 1u)
+const uint32_t g_nano_os_port_kernel_basepri = NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY;
+#else
+const uint32_t g_nano_os_port_kernel_basepri = 0u;
+#endif /* (NANO_OS_PORT_USE_BASEPRI == 1u) */
+
 /** \brief Switch the CPU to priviledged mode */
 extern void NANO_OS_PORT_SwitchToPriviledgedMode(void);
 
@@ -67,6 +87,12 @@ nano_os_error_t NANO_OS_PORT_Init(nano_os_port_init_data_t* const port_init_data
         /* Disable interrupts */
         NANO_OS_PORT_DISABLE_INTERRUPTS();
 
+        #if (NANO_OS_PORT_USE_BASEPRI == 1u)
+        /* PendSV and Systick exceptions at the lowest priority so that they
+           are masked by the critical sections of the OS */
+        SHPR3_REG |= 0xFFFF0000u;
+        #endif /* (NANO_OS_PORT_USE_BASEPRI == 1u) */
+
         /* Enable FPU in both priviledged and unpriviledged modes */
         CACR_REG = (3u << 20u) | (3u << 22u);
 
@@ -172,6 +198,42 @@ nano_os_error_t NANO_OS_PORT_Init(nano_os_port_init_data_t* const port_init_data
 }
 
 
+#if ((NANO_OS_PORT_USE_BASEPRI == 1u) && !defined(NDEBUG))
+
+/** \brief Check that the current interrupt handler is allowed to call the OS */
+void NANO_OS_PORT_CheckIsrPriority(void)
+{
+    uint32_t priority;
+
+    /* Get the priority of the active exception */
+    const uint32_t exception_number = (ICSR_REG & 0x1FFu);
+    if (exception_number >= 16u)
+    {
+        priority = NVIC_IPR_BYTE_REGS[exception_number - 16u];
+    }
+    else if (exception_number >= 4u)
+    {
+        priority = SHPR_BYTE_REGS[exception_number - 4u];
+    }
+    else if (exception_number != 0u)
+    {
+        /* NMI and HardFault have a fixed priority higher than any configurable priority */
+        priority = 0u;
+    }
+    else
+    {
+        /* Thread mode */
+        priority = 0xFFu;
+    }
+
+    /* Interrupts with a higher priority than the max syscall interrupt priority
+       are never masked by the OS and must not call it */
+    NANO_OS_ERROR_ASSERT((priority >= NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY), NOS_ERR_INVALID_INTERRUPT_PRIORITY);
+}
+
+#endif /* ((NANO_OS_PORT_USE_BASEPRI == 1u) && !defined(NDEBUG)) */
+
+
 /** \brief Get the port version */
 nano_os_error_t NANO_OS_PORT_GetVersion(nano_os_version_t* const port_version)
 {
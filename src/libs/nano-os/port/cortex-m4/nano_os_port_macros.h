@@ -21,29 +21,56 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #define NANO_OS_PORT_MACROS_H
 
 
+#if (NANO_OS_PORT_USE_BASEPRI == 1u)
+
+/** \brief Disable interrupts (only the interrupts which can call the OS) */
+#define NANO_OS_PORT_DISABLE_INTERRUPTS()   (void)NANO_OS_PORT_RaiseBasepri(NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY)
+
+/** \brief Enable interrupts */
+#define NANO_OS_PORT_ENABLE_INTERRUPTS()    NANO_OS_PORT_SetBasepri(0u)
+
+#else
+
 /** \brief Disable interrupts */
 #define NANO_OS_PORT_DISABLE_INTERRUPTS()   __asm("cpsid    i")
 
 /** \brief Enable interrupts */
 #define NANO_OS_PORT_ENABLE_INTERRUPTS()    __asm("cpsie    i")
 
+#endif /* (NANO_OS_PORT_USE_BASEPRI == 1u) */
+
 /** \brief Get the current value of the task stack pointer */
 #define NANO_OS_PORT_GET_TASK_SP()          NANO_OS_PORT_GetTaskStackPointer()
 
+#if (NANO_OS_PORT_USE_BASEPRI == 1u)
+
+/** \brief Enter into a critical section */
+#define NANO_OS_PORT_ENTER_CRITICAL(int_status_reg)   (int_status_reg = NANO_OS_PORT_RaiseBasepri(NANO_OS_PORT_MAX_SYSCALL_INTERRUPT_PRIORITY))
+
+/** \brief Leave a critical section */
+#define NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg)   NANO_OS_PORT_SetBasepri(int_status_reg)
+
+#else
+
 /** \brief Enter into a critical section */
 #define NANO_OS_PORT_ENTER_CRITICAL(int_status_reg)   (int_status_reg = NANO_OS_PORT_SaveInterruptStatus())
 
 /** \brief Leave a critical section */
 #define NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg)   NANO_OS_PORT_RestoreInterruptStatus(int_status_reg)
 
+#endif /* (NANO_OS_PORT_USE_BASEPRI == 1u) */
+
 /** \brief Atomic increment of a 32bits variable */
-#define NANO_OS_PORT_ATOMIC_INC32(var)      ((var)++)
+#define NANO_OS_PORT_ATOMIC_INC32(var)      ((void)NANO_OS_PORT_AtomicFetchAdd32(&(var), 1u))
 
 /** \brief Atomic decrement of a 32bits variable */
-#define NANO_OS_PORT_ATOMIC_DEC32(var)      ((var)--)
+#define NANO_OS_PORT_ATOMIC_DEC32(var)      ((void)NANO_OS_PORT_AtomicFetchAdd32(&(var), 0xFFFFFFFFu))
 
 /** \brief Atomic read of a 32bits variable */
-#define NANO_OS_PORT_ATOMIC_READ32(var)     (var)
+#define NANO_OS_PORT_ATOMIC_READ32(var)     NANO_OS_PORT_AtomicLoad32(&(var))
+
+/** \brief Atomic compare and swap of a 32bits variable (true if the variable has been updated) */
+#define NANO_OS_PORT_ATOMIC_CAS32(var, expected, desired)   NANO_OS_PORT_AtomicCas32(&(var), (expected), (desired))
 
 /** \brief Switch to priviledged mode  */
 #define NANO_OS_PORT_RAISE_PRIVILEDGES()    if (!g_nano_os.current_task->port_data.is_priviledged) { NANO_OS_PORT_SwitchToPriviledgedMode(); }
@@ -57,6 +84,14 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Manage the exit of a system call  */
 #define NANO_OS_PORT_SYSCALL_EXIT()         NANO_OS_PORT_LOWER_PRIVILEDGES()
 
+#if ((NANO_OS_PORT_USE_BASEPRI == 1u) && !defined(NDEBUG))
+/** \brief Check that the current interrupt handler is allowed to call the OS */
+#define NANO_OS_PORT_CHECK_ISR_PRIORITY()   NANO_OS_PORT_CheckIsrPriority()
+#else
+/** \brief Check that the current interrupt handler is allowed to call the OS */
+#define NANO_OS_PORT_CHECK_ISR_PRIORITY()
+#endif /* ((NANO_OS_PORT_USE_BASEPRI == 1u) && !defined(NDEBUG)) */
+
 /** \brief Task context stack frame size in number of elements for this port */
 #define NANO_OS_PORT_TASK_CONTEXT_STACK_FRAME_SIZE(task)      (((task)->port_data.use_fpu) ? 51u : 17u)
 
@@ -82,6 +117,12 @@ nano_os_int_status_reg_t NANO_OS_PORT_SaveInterruptStatus(void);
 /** \brief Restore the interrupt status register passed in parameter */
 void NANO_OS_PORT_RestoreInterruptStatus(const nano_os_int_status_reg_t int_status_reg);
 
+/** \brief Raise the interrupt masking level and return the previous value of the BASEPRI register */
+nano_os_int_status_reg_t NANO_OS_PORT_RaiseBasepri(const uint32_t basepri);
+
+/** \brief Set the interrupt masking level */
+void NANO_OS_PORT_SetBasepri(const uint32_t basepri);
+
 
 /** \brief Switch the CPU to priviledged mode */
 void NANO_OS_PORT_SwitchToPriviledgedMode(void);
@@ -90,6 +131,14 @@ void NANO_OS_PORT_SwitchToPriviledgedMode(void);
 void NANO_OS_PORT_SwitchToUnpriviledgedMode(void);
 
 
+#if ((NANO_OS_PORT_USE_BASEPRI == 1u) && !defined(NDEBUG))
+
+/** \brief Check that the current interrupt handler is allowed to call the OS (implemented in C) */
+void NANO_OS_PORT_CheckIsrPriority(void);
+
+#endif /* ((NANO_OS_PORT_USE_BASEPRI == 1u) && !defined(NDEBUG)) */
+
+
 
 
 #ifdef __cplusplus
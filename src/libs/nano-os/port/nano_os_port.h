@@ -94,6 +94,38 @@ void NANO_OS_PORT_ContextSwitch(void);
 /** \brief Port specific interrupt level context switch */
 void NANO_OS_PORT_ContextSwitchFromIsr(void);
 
+
+/** \brief Atomically read the value of a 32bits variable */
+uint32_t NANO_OS_PORT_AtomicLoad32(const volatile uint32_t* const var);
+
+/** \brief Atomically write the value of a 32bits variable */
+void NANO_OS_PORT_AtomicStore32(volatile uint32_t* const var, const uint32_t value);
+
+/** \brief Atomically replace the value of a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicExchange32(volatile uint32_t* const var, const uint32_t value);
+
+/** \brief Atomically replace the value of a 32bits variable if it is equal to the expected value */
+bool NANO_OS_PORT_AtomicCas32(volatile uint32_t* const var, const uint32_t expected, const uint32_t desired);
+
+/** \brief Atomically add a value to a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicFetchAdd32(volatile uint32_t* const var, const uint32_t value);
+
+/** \brief Atomically OR a value into a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicFetchOr32(volatile uint32_t* const var, const uint32_t value);
+
+/** \brief Atomically read the value of a pointer */
+void* NANO_OS_PORT_AtomicLoadPtr(void* volatile* const var);
+
+/** \brief Atomically write the value of a pointer */
+void NANO_OS_PORT_AtomicStorePtr(void* volatile* const var, void* const value);
+
+/** \brief Atomically replace the value of a pointer and return its previous value */
+void* NANO_OS_PORT_AtomicExchangePtr(void* volatile* const var, void* const value);
+
+/** \brief Atomically replace the value of a pointer if it is equal to the expected value */
+bool NANO_OS_PORT_AtomicCasPtr(void* volatile* const var, void* const expected, void* const desired);
+
+
 #if ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u))
 #if (NANO_OS_PORT_PROVIDES_SYSTEM_TIMER == 1u)
 
@@ -111,6 +143,57 @@ uint32_t NANO_OS_USER_SystemTimerGetTimestampInUs(void);
 #endif /* NANO_OS_PORT_PROVIDES_SYSTEM_TIMER */
 #endif /* ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u)) */
 
+
+#if (NANO_OS_HR_TIMER_ENABLED == 1u)
+
+/** \brief High resolution timer interrupt callback function */
+typedef void (*fp_nano_os_hr_timer_irq_callback_func_t)(void);
+
+#if (NANO_OS_PORT_PROVIDES_HR_TIMER == 1u)
+
+/** \brief Initialize the high resolution timer (free running s counter with a one-shot compare interrupt) */
+nano_os_error_t NANO_OS_PORT_HrTimerInit(const fp_nano_os_hr_timer_irq_callback_func_t hr_timer_irq_callback);
+
+/** \brief Get the current timestamp of the high resolution timer in s */
+uint32_t NANO_OS_PORT_HrTimerGetTimestampInUs(void);
+
+/** \brief Trigger the high resolution timer interrupt when the specified timestamp is reached
+           (the interrupt must be triggered as soon as possible if the timestamp has already been reached) */
+void NANO_OS_PORT_HrTimerSetCompare(const uint32_t timestamp_in_us);
+
+/** \brief Cancel the pending high resolution timer interrupt */
+void NANO_OS_PORT_HrTimerStop(void);
+
+#else
+
+/** \brief Initialize the high resolution timer (free running s counter with a one-shot compare interrupt) */
+nano_os_error_t NANO_OS_USER_HrTimerInit(const fp_nano_os_hr_timer_irq_callback_func_t hr_timer_irq_callback);
+
+/** \brief Get the current timestamp of the high resolution timer in s */
+uint32_t NANO_OS_USER_HrTimerGetTimestampInUs(void);
+
+/** \brief Trigger the high resolution timer interrupt when the specified timestamp is reached
+           (the interrupt must be triggered as soon as possible if the timestamp has already been reached) */
+void NANO_OS_USER_HrTimerSetCompare(const uint32_t timestamp_in_us);
+
+/** \brief Cancel the pending high resolution timer interrupt */
+void NANO_OS_USER_HrTimerStop(void);
+
+/** \brief Initialize the high resolution timer */
+#define NANO_OS_PORT_HrTimerInit(hr_timer_irq_callback)     NANO_OS_USER_HrTimerInit(hr_timer_irq_callback)
+
+/** \brief Get the current timestamp of the high resolution timer in s */
+#define NANO_OS_PORT_HrTimerGetTimestampInUs()              NANO_OS_USER_HrTimerGetTimestampInUs()
+
+/** \brief Trigger the high resolution timer interrupt when the specified timestamp is reached */
+#define NANO_OS_PORT_HrTimerSetCompare(timestamp_in_us)     NANO_OS_USER_HrTimerSetCompare(timestamp_in_us)
+
+/** \brief Cancel the pending high resolution timer interrupt */
+#define NANO_OS_PORT_HrTimerStop()                          NANO_OS_USER_HrTimerStop()
+
+#endif /* (NANO_OS_PORT_PROVIDES_HR_TIMER == 1u) */
+#endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -31,6 +31,11 @@ static DWORD NANO_OS_PORT_TaskStart(LPVOID param);
 /** \brief Windows task to execute tick timer */
 static DWORD NANO_OS_PORT_TickTimerTask(LPVOID param);
 
+#if (NANO_OS_HR_TIMER_ENABLED == 1u)
+/** \brief Windows task to execute high resolution timer */
+static DWORD NANO_OS_PORT_HrTimerTask(LPVOID param);
+#endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
+
 
 
 
@@ -59,10 +64,10 @@ nano_os_error_t NANO_OS_PORT_Init(nano_os_port_init_data_t* const port_init_data
         }
     }
 
-    #if ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u))
+    #if ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u) || (NANO_OS_HR_TIMER_ENABLED == 1u))
     /* Get the frequency of the high performance counter */
     QueryPerformanceFrequency(&g_nano_os.port_data.hpc_frequency);
-    #endif /* ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u)) */
+    #endif /* ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u) || (NANO_OS_HR_TIMER_ENABLED == 1u)) */
 
     return ret;
 }
@@ -143,6 +148,70 @@ uint32_t NANO_OS_PORT_GetTimestampInUs(void)
 #endif /* ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u)) */
 
 
+#if (NANO_OS_HR_TIMER_ENABLED == 1u)
+
+/** \brief Initialize the high resolution timer (free running s counter with a one-shot compare interrupt) */
+nano_os_error_t NANO_OS_PORT_HrTimerInit(const fp_nano_os_hr_timer_irq_callback_func_t hr_timer_irq_callback)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if (hr_timer_irq_callback != NULL)
+    {
+        ret = NOS_ERR_FAILURE;
+
+        /* Save the interrupt handler */
+        g_nano_os.port_data.hr_timer_handler = hr_timer_irq_callback;
+        g_nano_os.port_data.hr_timer_armed = false;
+
+        /* Create a task to emulate the high resolution timer interrupt */
+        g_nano_os.port_data.hr_timer_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+        if (g_nano_os.port_data.hr_timer_event != NULL)
+        {
+            g_nano_os.port_data.hr_timer_task = CreateThread(NULL, 0, NANO_OS_CAST(LPTHREAD_START_ROUTINE, NANO_OS_PORT_HrTimerTask), NULL, 0, NULL);
+            if (g_nano_os.port_data.hr_timer_task != NULL)
+            {
+                ret = NOS_ERR_SUCCESS;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** \brief Get the current timestamp of the high resolution timer in s */
+uint32_t NANO_OS_PORT_HrTimerGetTimestampInUs(void)
+{
+    LARGE_INTEGER current_time;
+
+    /* Get high performance counter value */
+    QueryPerformanceCounter(&current_time);
+
+    /* Convert to microseconds */
+    current_time.QuadPart *= 1000000;
+    current_time.QuadPart /= g_nano_os.port_data.hpc_frequency.QuadPart;
+
+    return NANO_OS_CAST(uint32_t, current_time.QuadPart);
+}
+
+/** \brief Trigger the high resolution timer interrupt when the specified timestamp is reached */
+void NANO_OS_PORT_HrTimerSetCompare(const uint32_t timestamp_in_us)
+{
+    g_nano_os.port_data.hr_timer_compare = timestamp_in_us;
+    g_nano_os.port_data.hr_timer_armed = true;
+    SetEvent(g_nano_os.port_data.hr_timer_event);
+}
+
+/** \brief Cancel the pending high resolution timer interrupt */
+void NANO_OS_PORT_HrTimerStop(void)
+{
+    g_nano_os.port_data.hr_timer_armed = false;
+    SetEvent(g_nano_os.port_data.hr_timer_event);
+}
+
+#endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
+
+
 /** \brief Port specific first task context switch */
 nano_os_error_t NANO_OS_PORT_FirstContextSwitch(void)
 {
@@ -192,16 +261,70 @@ void NANO_OS_PORT_ContextSwitchFromIsr(void)
     g_nano_os.current_task = g_nano_os.next_running_task;
 }
 
-/** \brief Atomic increment of a 32bits variable */
-void NANO_OS_PORT_AtomicInc32(uint32_t* const var)
+/** \brief Atomically replace the value of a 32bits variable if it is equal to the expected value */
+bool NANO_OS_PORT_AtomicCas32(volatile uint32_t* const var, const uint32_t expected, const uint32_t desired)
 {
-    (void)InterlockedIncrement(NANO_OS_CAST(LONG*, var));
+    const LONG previous = InterlockedCompareExchange(NANO_OS_CAST(volatile LONG*, var), NANO_OS_CAST(LONG, desired), NANO_OS_CAST(LONG, expected));
+    return (NANO_OS_CAST(uint32_t, previous) == expected);
 }
 
-/** \brief Atomic decrement of a 32bits variable */
-void NANO_OS_PORT_AtomicDec32(uint32_t* const var)
+/** \brief Atomically read the value of a 32bits variable */
+uint32_t NANO_OS_PORT_AtomicLoad32(const volatile uint32_t* const var)
 {
-    (void)InterlockedDecrement(NANO_OS_CAST(LONG*, var));
+    const LONG value = InterlockedCompareExchange(NANO_OS_CAST(volatile LONG*, var), 0, 0);
+    return NANO_OS_CAST(uint32_t, value);
+}
+
+/** \brief Atomically write the value of a 32bits variable */
+void NANO_OS_PORT_AtomicStore32(volatile uint32_t* const var, const uint32_t value)
+{
+    (void)InterlockedExchange(NANO_OS_CAST(volatile LONG*, var), NANO_OS_CAST(LONG, value));
+}
+
+/** \brief Atomically replace the value of a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicExchange32(volatile uint32_t* const var, const uint32_t value)
+{
+    const LONG previous = InterlockedExchange(NANO_OS_CAST(volatile LONG*, var), NANO_OS_CAST(LONG, value));
+    return NANO_OS_CAST(uint32_t, previous);
+}
+
+/** \brief Atomically add a value to a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicFetchAdd32(volatile uint32_t* const var, const uint32_t value)
+{
+    const LONG previous = InterlockedExchangeAdd(NANO_OS_CAST(volatile LONG*, var), NANO_OS_CAST(LONG, value));
+    return NANO_OS_CAST(uint32_t, previous);
+}
+
+/** \brief Atomically OR a value into a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicFetchOr32(volatile uint32_t* const var, const uint32_t value)
+{
+    const LONG previous = InterlockedOr(NANO_OS_CAST(volatile LONG*, var), NANO_OS_CAST(LONG, value));
+    return NANO_OS_CAST(uint32_t, previous);
+}
+
+/** \brief Atomically read the value of a pointer */
+void* NANO_OS_PORT_AtomicLoadPtr(void* volatile* const var)
+{
+    return InterlockedCompareExchangePointer(var, NULL, NULL);
+}
+
+/** \brief Atomically write the value of a pointer */
+void NANO_OS_PORT_AtomicStorePtr(void* volatile* const var, void* const value)
+{
+    (void)InterlockedExchangePointer(var, value);
+}
+
+/** \brief Atomically replace the value of a pointer and return its previous value */
+void* NANO_OS_PORT_AtomicExchangePtr(void* volatile* const var, void* const value)
+{
+    return InterlockedExchangePointer(var, value);
+}
+
+/** \brief Atomically replace the value of a pointer if it is equal to the expected value */
+bool NANO_OS_PORT_AtomicCasPtr(void* volatile* const var, void* const expected, void* const desired)
+{
+    const void* const previous = InterlockedCompareExchangePointer(var, desired, expected);
+    return (previous == expected);
 }
 
 
@@ -254,3 +377,51 @@ static DWORD NANO_OS_PORT_TickTimerTask(LPVOID param)
 
     return 0;
 }
+
+
+#if (NANO_OS_HR_TIMER_ENABLED == 1u)
+
+/** \brief Windows task to execute high resolution timer */
+static DWORD NANO_OS_PORT_HrTimerTask(LPVOID param)
+{
+    NANO_OS_UNUSED(param);
+
+    /* Change priority of the current thread to real-time */
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+
+    /* Task loop */
+    while(true)
+    {
+        DWORD wait_time = INFINITE;
+
+        /* Check if the compare timestamp has been reached */
+        if (g_nano_os.port_data.hr_timer_armed)
+        {
+            const int32_t remaining = NANO_OS_CAST(int32_t, g_nano_os.port_data.hr_timer_compare - NANO_OS_PORT_HrTimerGetTimestampInUs());
+            if (remaining <= 0)
+            {
+                /* High resolution timer interrupt handler, it will program the next compare timestamp */
+                g_nano_os.port_data.hr_timer_armed = false;
+                NANO_OS_PORT_VIRTUAL_INTERRUPT_Trigger(g_nano_os.port_data.hr_timer_handler);
+                wait_time = 0u;
+            }
+            else if (remaining > 20000)
+            {
+                /* Windows waits are not accurate, sleep until 20ms before the timestamp */
+                wait_time = NANO_OS_CAST(DWORD, (remaining - 20000) / 1000);
+            }
+            else
+            {
+                /* Poll until the timestamp is reached */
+                wait_time = 0u;
+            }
+        }
+
+        /* Wait for a new compare timestamp or for the timestamp to be reached */
+        (void)WaitForSingleObject(g_nano_os.port_data.hr_timer_event, wait_time);
+    }
+
+    return 0;
+}
+
+#endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
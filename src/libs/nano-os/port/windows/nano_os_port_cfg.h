@@ -45,6 +45,9 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Indicate if the port provides the system timer for Nano OS */
 #define NANO_OS_PORT_PROVIDES_SYSTEM_TIMER              1u
 
+/** \brief Indicate if the port provides the high resolution timer for Nano OS */
+#define NANO_OS_PORT_PROVIDES_HR_TIMER                  1u
+
 
 /** \brief Minimum stack size in number of elements for this port */
 #define NANO_OS_PORT_MIN_STACK_SIZE                     1u
@@ -37,13 +37,16 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #define NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg)   NANO_OS_PORT_VIRTUAL_INTERRUPT_RestoreInterruptStatus(int_status_reg)
 
 /** \brief Atomic increment of a 32bits variable */
-#define NANO_OS_PORT_ATOMIC_INC32(var)      NANO_OS_PORT_AtomicInc32(&var)
+#define NANO_OS_PORT_ATOMIC_INC32(var)      ((void)NANO_OS_PORT_AtomicFetchAdd32(&(var), 1u))
 
 /** \brief Atomic decrement of a 32bits variable */
-#define NANO_OS_PORT_ATOMIC_DEC32(var)      NANO_OS_PORT_AtomicDec32(&var)
+#define NANO_OS_PORT_ATOMIC_DEC32(var)      ((void)NANO_OS_PORT_AtomicFetchAdd32(&(var), 0xFFFFFFFFu))
 
 /** \brief Atomic read of a 32bits variable */
-#define NANO_OS_PORT_ATOMIC_READ32(var)     (var)
+#define NANO_OS_PORT_ATOMIC_READ32(var)     NANO_OS_PORT_AtomicLoad32(&(var))
+
+/** \brief Atomic compare and swap of a 32bits variable (true if the variable has been updated) */
+#define NANO_OS_PORT_ATOMIC_CAS32(var, expected, desired)   NANO_OS_PORT_AtomicCas32(&(var), (expected), (desired))
 
 /** \brief Switch to priviledged mode  */
 #define NANO_OS_PORT_RAISE_PRIVILEDGES()    
@@ -57,6 +60,9 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 /** \brief Manage the exit of a system call  */
 #define NANO_OS_PORT_SYSCALL_EXIT()
 
+/** \brief Check that the current interrupt handler is allowed to call the OS */
+#define NANO_OS_PORT_CHECK_ISR_PRIORITY()
+
 /** \brief Task context stack frame size in number of elements for this port */
 #define NANO_OS_PORT_TASK_CONTEXT_STACK_FRAME_SIZE(task)      0u
 
@@ -86,13 +92,6 @@ nano_os_int_status_reg_t NANO_OS_PORT_VIRTUAL_INTERRUPT_SaveInterruptStatus(void
 void NANO_OS_PORT_VIRTUAL_INTERRUPT_RestoreInterruptStatus(const nano_os_int_status_reg_t int_status_reg);
 
 
-/** \brief Atomic increment of a 32bits variable */
-void NANO_OS_PORT_AtomicInc32(uint32_t* const var);
-
-/** \brief Atomic decrement of a 32bits variable */
-void NANO_OS_PORT_AtomicDec32(uint32_t* const var);
-
-
 
 #ifdef __cplusplus
 }
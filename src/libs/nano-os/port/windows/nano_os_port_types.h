@@ -76,10 +76,23 @@ typedef struct _nano_os_port_data_t
     /** \brief Tick timer task handle */
     HANDLE tick_timer_task;
 
-    #if ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u))
+    #if ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u) || (NANO_OS_HR_TIMER_ENABLED == 1u))
     /** \brief Frequency of the high performance counter */
     LARGE_INTEGER hpc_frequency;
-    #endif /* ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u)) */
+    #endif /* ((NANO_OS_TRACE_ENABLED == 1u) || (NANO_OS_CPU_USAGE_MEASUREMENT_ENABLED == 1u) || (NANO_OS_HR_TIMER_ENABLED == 1u)) */
+
+    #if (NANO_OS_HR_TIMER_ENABLED == 1u)
+    /** \brief High resolution timer task handle */
+    HANDLE hr_timer_task;
+    /** \brief Event to wake up the high resolution timer task when its compare timestamp is modified */
+    HANDLE hr_timer_event;
+    /** \brief High resolution timer interrupt handler */
+    fp_nano_os_virtual_interrupt_handler_t hr_timer_handler;
+    /** \brief High resolution timer compare timestamp in s */
+    volatile uint32_t hr_timer_compare;
+    /** \brief Indicate if the high resolution timer compare is armed */
+    volatile bool hr_timer_armed;
+    #endif /* (NANO_OS_HR_TIMER_ENABLED == 1u) */
 } nano_os_port_data_t;
 
 
@@ -0,0 +1,278 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_blackboard.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+/** \brief Get the version of the data from the sequence counter */
+#define NANO_OS_BLACKBOARD_VERSION(sequence)    ((sequence) >> 1u)
+
+
+/** \brief Copy the blackboard data (volatile accesses to keep the ordering with the sequence counter) */
+static void NANO_OS_BLACKBOARD_Copy(volatile uint8_t* dest, const volatile uint8_t* src, const size_t size);
+
+
+
+
+/** \brief Create a new blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Create(nano_os_blackboard_t* const blackboard, void* const data_buffer,
+                                          const size_t data_size, const nano_os_queuing_type_t queuing_type)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((blackboard != NULL) && (data_buffer != NULL) && (data_size != 0u))
+    {
+        /* 0 init of blackboard */
+        (void)MEMSET(blackboard, 0, sizeof(nano_os_blackboard_t));
+
+        /* Init underlying wait object */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&blackboard->wait_object, WOT_BLACKBOARD, queuing_type);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Initialize blackboard data, version 0 is the zeroed buffer */
+            blackboard->data = NANO_OS_CAST(uint8_t*, data_buffer);
+            blackboard->data_size = data_size;
+            blackboard->sequence = 0u;
+            (void)MEMSET(data_buffer, 0, data_size);
+
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, blackboard);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Destroy(nano_os_blackboard_t* const blackboard)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((blackboard != NULL) && (blackboard->wait_object.type == WOT_BLACKBOARD))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, blackboard);
+
+        /* Destroy wait object */
+        ret = NANO_OS_WAIT_OBJECT_Destroy(&blackboard->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u) */
+
+
+/** \brief Publish a new value on a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Publish(nano_os_blackboard_t* const blackboard, const void* const data)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((blackboard != NULL) && (data != NULL) && (blackboard->wait_object.type == WOT_BLACKBOARD))
+    {
+        uint32_t woke_up_task_count = 0u;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_BLACKBOARD_PUBLISH, blackboard);
+
+        /* Lock blackboard against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(blackboard->wait_object);
+
+        /* Update the value, the sequence counter is odd during the copy.
+           Since the whole publication is done inside the system call, the
+           writer can't be preempted by a reader task in the middle of the copy */
+        blackboard->sequence++;
+        NANO_OS_BLACKBOARD_Copy(blackboard->data, NANO_OS_CAST(const uint8_t*, data), blackboard->data_size);
+        blackboard->sequence++;
+
+        /* Wake up all the tasks waiting for a new value */
+        ret = NANO_OS_WAIT_OBJECT_Signal(&blackboard->wait_object, NOS_ERR_SUCCESS, true, NULL, &woke_up_task_count);
+
+        /* Unlock blackboard against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(blackboard->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Read the latest value of a blackboard without locking */
+nano_os_error_t NANO_OS_BLACKBOARD_Read(const nano_os_blackboard_t* const blackboard, void* const data, uint32_t* const version)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((blackboard != NULL) && (data != NULL) && (version != NULL) &&
+        (blackboard->wait_object.type == WOT_BLACKBOARD))
+    {
+        uint32_t sequence;
+
+        /* Copy the value until it has not been modified during the copy */
+        do
+        {
+            sequence = blackboard->sequence;
+            if ((sequence & 1u) != 0u)
+            {
+                /* A publication is in progress, this can only happen when reading
+                   from an interrupt handler which has preempted the writer */
+                ret = NOS_ERR_BLACKBOARD_BUSY;
+            }
+            else
+            {
+                NANO_OS_BLACKBOARD_Copy(NANO_OS_CAST(uint8_t*, data), blackboard->data, blackboard->data_size);
+                ret = NOS_ERR_SUCCESS;
+            }
+        }
+        while ((ret == NOS_ERR_SUCCESS) && (sequence != blackboard->sequence));
+
+        /* Get the version of the value */
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            (*version) = NANO_OS_BLACKBOARD_VERSION(sequence);
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Wait for a value newer than the specified version on a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Wait(nano_os_blackboard_t* const blackboard, void* const data,
+                                        uint32_t* const version, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((blackboard != NULL) && (data != NULL) && (version != NULL) &&
+        (blackboard->wait_object.type == WOT_BLACKBOARD))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_BLACKBOARD_WAIT, blackboard);
+
+        /* Lock blackboard against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(blackboard->wait_object);
+
+        /* Check if a newer value is available */
+        if (NANO_OS_BLACKBOARD_VERSION(blackboard->sequence) != (*version))
+        {
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            /* Wait for a new value */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&blackboard->wait_object, tick_count);
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Copy the latest value, no publication can occur during the system call */
+            NANO_OS_BLACKBOARD_Copy(NANO_OS_CAST(uint8_t*, data), blackboard->data, blackboard->data_size);
+            (*version) = NANO_OS_BLACKBOARD_VERSION(blackboard->sequence);
+        }
+
+        /* Unlock blackboard against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(blackboard->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_SetName(nano_os_blackboard_t* const blackboard, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (blackboard != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, blackboard);
+
+        /* Save the name */
+        blackboard->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Copy the blackboard data (volatile accesses to keep the ordering with the sequence counter) */
+static void NANO_OS_BLACKBOARD_Copy(volatile uint8_t* dest, const volatile uint8_t* src, const size_t size)
+{
+    size_t i;
+    for (i = 0u; i < size; i++)
+    {
+        (*dest) = (*src);
+        dest++;
+        src++;
+    }
+}
+
+
+#endif /* (NANO_OS_BLACKBOARD_ENABLED == 1u) */
@@ -0,0 +1,93 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_BLACKBOARD_H
+#define NANO_OS_BLACKBOARD_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_BLACKBOARD_ENABLED == 1u)
+
+
+#include "nano_os_wait_object.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Nano OS blackboard
+ *         Holds the latest value published by a single writer.
+ *         Readers copy the value without locking and retry if a new value
+ *         has been published during the copy (sequence lock).
+ */
+typedef struct _nano_os_blackboard_t
+{
+    /** \brief Underlying wait object */
+    nano_os_wait_object_t wait_object;
+
+    /** \brief Data buffer */
+    uint8_t* data;
+    /** \brief Data size in bytes */
+    size_t data_size;
+    /** \brief Sequence counter (odd while a publication is in progress) */
+    volatile uint32_t sequence;
+} nano_os_blackboard_t;
+
+
+
+
+/** \brief Create a new blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Create(nano_os_blackboard_t* const blackboard, void* const data_buffer,
+                                          const size_t data_size, const nano_os_queuing_type_t queuing_type);
+
+#if (NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Destroy(nano_os_blackboard_t* const blackboard);
+
+#endif /* (NANO_OS_BLACKBOARD_DESTROY_ENABLED == 1u) */
+
+/** \brief Publish a new value on a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Publish(nano_os_blackboard_t* const blackboard, const void* const data);
+
+/** \brief Read the latest value of a blackboard without locking */
+nano_os_error_t NANO_OS_BLACKBOARD_Read(const nano_os_blackboard_t* const blackboard, void* const data, uint32_t* const version);
+
+/** \brief Wait for a value newer than the specified version on a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_Wait(nano_os_blackboard_t* const blackboard, void* const data,
+                                        uint32_t* const version, const uint32_t tick_count);
+
+#if (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a blackboard */
+nano_os_error_t NANO_OS_BLACKBOARD_SetName(nano_os_blackboard_t* const blackboard, const char* const name);
+
+#endif /* (NANO_OS_BLACKBOARD_SETNAME_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_BLACKBOARD_ENABLED == 1u) */
+
+#endif /* NANO_OS_BLACKBOARD_H */
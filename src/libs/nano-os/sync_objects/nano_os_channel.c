@@ -0,0 +1,398 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_channel.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+#include "nano_os_task_list.h"
+#include "nano_os_scheduler.h"
+
+
+/** \brief Wait timeout of a client for the reply once its message has been handed to a server
+ *         (the timeout is cancelled by the server as soon as it is running) */
+#define NANO_OS_CHANNEL_REPLY_TIMEOUT   0xFFFFFFFFu
+
+
+/** \brief Make a server inherit the priority of a client */
+static nano_os_error_t NANO_OS_CHANNEL_InheritPriority(nano_os_task_t* const server, const nano_os_task_t* const client);
+
+/** \brief Undo the priority inheritance of a server */
+static nano_os_error_t NANO_OS_CHANNEL_RestorePriority(nano_os_task_t* const server);
+
+/** \brief Put back a task at the head of the waiting list of a channel */
+static void NANO_OS_CHANNEL_RequeueTask(nano_os_channel_t* const channel, nano_os_task_t* const task);
+
+
+
+
+/** \brief Create a new channel */
+nano_os_error_t NANO_OS_CHANNEL_Create(nano_os_channel_t* const channel, const nano_os_queuing_type_t queuing_type)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (channel != NULL)
+    {
+        /* 0 init of channel */
+        (void)MEMSET(channel, 0, sizeof(nano_os_channel_t));
+
+        /* Init underlying wait object */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&channel->wait_object, WOT_CHANNEL, queuing_type);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, channel);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_CHANNEL_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a channel */
+nano_os_error_t NANO_OS_CHANNEL_Destroy(nano_os_channel_t* const channel)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((channel != NULL) && (channel->wait_object.type == WOT_CHANNEL))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, channel);
+
+        /* Destroy wait object, clients which are already waiting for a reply are not affected */
+        ret = NANO_OS_WAIT_OBJECT_Destroy(&channel->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_CHANNEL_DESTROY_ENABLED == 1u) */
+
+
+/** \brief Send a message on a channel and wait for the reply
+ *         (the timeout only applies until a server has received the message) */
+nano_os_error_t NANO_OS_CHANNEL_Send(nano_os_channel_t* const channel, void* const buffer, const size_t size,
+                                     const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((channel != NULL) && (buffer != NULL) && (size != 0u) &&
+        (channel->wait_object.type == WOT_CHANNEL))
+    {
+        nano_os_task_t* const client = g_nano_os.current_task;
+        bool wait_reply = false;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_CHANNEL_SEND, channel);
+
+        /* Lock channel against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(channel->wait_object);
+
+        /* Save the message */
+        client->channel_buffer = buffer;
+        client->channel_size = size;
+
+        /* Check if a server is waiting for a message */
+        if ((channel->wait_object.waiting_tasks != NULL) && channel->servers_waiting)
+        {
+            /* Hand the message directly to the first waiting server */
+            nano_os_task_t* const server = NANO_OS_TASK_LIST_PopTask(&channel->wait_object.waiting_tasks);
+
+            /* The server runs with the priority of the client */
+            ret = NANO_OS_CHANNEL_InheritPriority(server, client);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                server->channel_client = client;
+                server->waiting_object = NULL;
+                server->wait_status = NOS_ERR_SUCCESS;
+
+                /* Make the server the next task to run at this priority level */
+                ret = NANO_OS_SCHEDULER_HandOff(server);
+                if (ret == NOS_ERR_SUCCESS)
+                {
+                    server->wait_timeout = 0u;
+                    wait_reply = true;
+                }
+                else
+                {
+                    /* Undo the hand off, the server keeps waiting for a message */
+                    server->channel_client = NULL;
+                    server->waiting_object = &channel->wait_object;
+                    (void)NANO_OS_CHANNEL_RestorePriority(server);
+                }
+            }
+            if (!wait_reply)
+            {
+                NANO_OS_CHANNEL_RequeueTask(channel, server);
+            }
+        }
+        else
+        {
+            /* Wait for a server, the reply will have been written
+               in the buffer when the client is woken up */
+            channel->servers_waiting = false;
+            ret = NANO_OS_WAIT_OBJECT_Wait(&channel->wait_object, tick_count);
+        }
+
+        /* Unlock channel against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(channel->wait_object);
+
+        /* Wait for the reply of the server */
+        if (wait_reply)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Wait(&client->channel_reply_object, NANO_OS_CHANNEL_REPLY_TIMEOUT);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Wait for a message on a channel */
+nano_os_error_t NANO_OS_CHANNEL_Receive(nano_os_channel_t* const channel, void** const buffer, size_t* const size,
+                                        const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((channel != NULL) && (buffer != NULL) && (size != NULL) &&
+        (channel->wait_object.type == WOT_CHANNEL))
+    {
+        nano_os_task_t* const server = g_nano_os.current_task;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_CHANNEL_RECEIVE, channel);
+
+        /* Lock channel against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(channel->wait_object);
+
+        /* Check if the previous message has been replied */
+        if (server->channel_client != NULL)
+        {
+            ret = NOS_ERR_CHANNEL_REPLY_PENDING;
+        }
+        else if ((channel->wait_object.waiting_tasks != NULL) && !channel->servers_waiting)
+        {
+            /* Get the first waiting client */
+            nano_os_task_t* const client = NANO_OS_TASK_LIST_PopTask(&channel->wait_object.waiting_tasks);
+
+            /* The server runs with the priority of the client */
+            ret = NANO_OS_CHANNEL_InheritPriority(server, client);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                /* The client is now waiting for the reply */
+                ret = NANO_OS_TASK_LIST_AddToEnd(&client->channel_reply_object.waiting_tasks, client);
+                if (ret == NOS_ERR_SUCCESS)
+                {
+                    client->waiting_object = &client->channel_reply_object;
+                    server->channel_client = client;
+                }
+                else
+                {
+                    (void)NANO_OS_CHANNEL_RestorePriority(server);
+                }
+            }
+            if (ret != NOS_ERR_SUCCESS)
+            {
+                /* The client keeps waiting for a server */
+                NANO_OS_CHANNEL_RequeueTask(channel, client);
+            }
+        }
+        else
+        {
+            /* Wait for a client */
+            channel->servers_waiting = true;
+            ret = NANO_OS_WAIT_OBJECT_Wait(&channel->wait_object, tick_count);
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* The client can't timeout anymore since the server is working in its buffer */
+            nano_os_task_t* const client = server->channel_client;
+            ret = NANO_OS_SCHEDULER_CancelTaskTimeout(client);
+
+            /* Give direct access to the client's buffer */
+            (*buffer) = client->channel_buffer;
+            (*size) = client->channel_size;
+        }
+
+        /* Unlock channel against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(channel->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Reply to the message received on a channel (the reply has been written in the received buffer) */
+nano_os_error_t NANO_OS_CHANNEL_Reply(nano_os_channel_t* const channel)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((channel != NULL) && (channel->wait_object.type == WOT_CHANNEL))
+    {
+        nano_os_task_t* const server = g_nano_os.current_task;
+        nano_os_task_t* const client = server->channel_client;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_CHANNEL_REPLY, channel);
+
+        /* Lock channel against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(channel->wait_object);
+
+        /* Check if a message has been received */
+        if (client == NULL)
+        {
+            ret = NOS_ERR_CHANNEL_NO_CLIENT;
+        }
+        else
+        {
+            server->channel_client = NULL;
+
+            /* End of the priority inheritance */
+            ret = NANO_OS_CHANNEL_RestorePriority(server);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                /* Wake up the client */
+                (void)NANO_OS_TASK_LIST_PopTask(&client->channel_reply_object.waiting_tasks);
+                client->channel_buffer = NULL;
+                client->channel_size = 0u;
+                client->waiting_object = NULL;
+                client->wait_timeout = 0u;
+                client->wait_status = NOS_ERR_SUCCESS;
+
+                /* Make the client the next task to run at its priority level */
+                ret = NANO_OS_SCHEDULER_HandOff(client);
+            }
+        }
+
+        /* Unlock channel against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(channel->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a channel */
+nano_os_error_t NANO_OS_CHANNEL_SetName(nano_os_channel_t* const channel, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (channel != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, channel);
+
+        /* Save the name */
+        channel->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Make a server inherit the priority of a client */
+static nano_os_error_t NANO_OS_CHANNEL_InheritPriority(nano_os_task_t* const server, const nano_os_task_t* const client)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Save the current priority of the server, it may already have been raised */
+    server->channel_priority = server->priority;
+
+    /* Only raise the server priority */
+    if (client->priority > server->priority)
+    {
+        ret = NANO_OS_SCHEDULER_SetTaskPriority(server, client->priority);
+    }
+
+    return ret;
+}
+
+/** \brief Undo the priority inheritance of a server */
+static nano_os_error_t NANO_OS_CHANNEL_RestorePriority(nano_os_task_t* const server)
+{
+    /* Only the boost given by the channel is removed, the server goes back
+       to the priority it had when the message has been handed to it */
+    return NANO_OS_SCHEDULER_SetTaskPriority(server, server->channel_priority);
+}
+
+/** \brief Put back a task at the head of the waiting list of a channel */
+static void NANO_OS_CHANNEL_RequeueTask(nano_os_channel_t* const channel, nano_os_task_t* const task)
+{
+    /* The task gets back its place as the first waiting task */
+    task->next = channel->wait_object.waiting_tasks;
+    channel->wait_object.waiting_tasks = task;
+}
+
+
+#endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
@@ -0,0 +1,91 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_CHANNEL_H
+#define NANO_OS_CHANNEL_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_CHANNEL_ENABLED == 1u)
+
+
+#include "nano_os_wait_object.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Nano OS synchronous message passing channel
+ *         A client sends a message buffer and stays blocked until a server has replied.
+ *         The server works directly in the client's buffer (no intermediate copy) and
+ *         inherits the client's priority until it replies.
+ */
+typedef struct _nano_os_channel_t
+{
+    /** \brief Underlying wait object : queue of the clients waiting for a server
+     *         or of the servers waiting for a client (never both at the same time) */
+    nano_os_wait_object_t wait_object;
+
+    /** \brief Indicate if the tasks in the wait queue are servers */
+    bool servers_waiting;
+} nano_os_channel_t;
+
+
+
+
+/** \brief Create a new channel */
+nano_os_error_t NANO_OS_CHANNEL_Create(nano_os_channel_t* const channel, const nano_os_queuing_type_t queuing_type);
+
+#if (NANO_OS_CHANNEL_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a channel */
+nano_os_error_t NANO_OS_CHANNEL_Destroy(nano_os_channel_t* const channel);
+
+#endif /* (NANO_OS_CHANNEL_DESTROY_ENABLED == 1u) */
+
+/** \brief Send a message on a channel and wait for the reply
+ *         (the timeout only applies until a server has received the message) */
+nano_os_error_t NANO_OS_CHANNEL_Send(nano_os_channel_t* const channel, void* const buffer, const size_t size,
+                                     const uint32_t tick_count);
+
+/** \brief Wait for a message on a channel */
+nano_os_error_t NANO_OS_CHANNEL_Receive(nano_os_channel_t* const channel, void** const buffer, size_t* const size,
+                                        const uint32_t tick_count);
+
+/** \brief Reply to the message received on a channel (the reply has been written in the received buffer) */
+nano_os_error_t NANO_OS_CHANNEL_Reply(nano_os_channel_t* const channel);
+
+#if (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a channel */
+nano_os_error_t NANO_OS_CHANNEL_SetName(nano_os_channel_t* const channel, const char* const name);
+
+#endif /* (NANO_OS_CHANNEL_SETNAME_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_CHANNEL_ENABLED == 1u) */
+
+#endif /* NANO_OS_CHANNEL_H */
@@ -23,14 +23,95 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #if (NANO_OS_MAILBOX_ENABLED == 1u)
 
 #include "nano_os_data.h"
+#include "nano_os_port.h"
 #include "nano_os_trace.h"
 #include "nano_os_syscall.h"
 #include "nano_os_tools.h"
 
 
-/** \brief Prototype for the OS object specific action on wait object signal */
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Check if a mailbox is a zero-copy mailbox */
+#define NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox)        ((mailbox)->zero_copy)
+
+/** \brief Get the data of a zero-copy mailbox buffer from its header */
+#define NANO_OS_MAILBOX_BUFFER_DATA(buffer)         NANO_OS_CAST(void*, &(buffer)[1])
+
+/** \brief Get the header of a zero-copy mailbox buffer from its data */
+#define NANO_OS_MAILBOX_BUFFER_HEADER(data)         (&NANO_OS_CAST(nano_os_mailbox_buffer_t*, (data))[-1])
+
+#else
+
+/** \brief Check if a mailbox is a zero-copy mailbox */
+#define NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox)        (false)
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
+/** \brief Pseudo lane used to insert a mail at the read end of a mailbox */
+#define NANO_OS_MAILBOX_URGENT_LANE                 0xFFFFFFFFu
+
+
+/** \brief Initialize the mailbox data */
+static nano_os_error_t NANO_OS_MAILBOX_Initialize(nano_os_mailbox_t* const mailbox, const uint32_t max_mail_count,
+                                                  const size_t mail_size, void* const mailbox_buffer,
+                                                  const nano_os_queuing_type_t queuing_type);
+
+/** \brief Wait for a mail in a mailbox (the mailbox must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MAILBOX_WaitMail(nano_os_mailbox_t* const mailbox, void* const mail_buffer,
+                                                const uint32_t tick_count);
+
+/** \brief Post a mail in a lane of a mailbox (the mailbox must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MAILBOX_PostMail(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t lane);
+
+/** \brief Read mails from the ring buffer of a mailbox */
+static void NANO_OS_MAILBOX_ReadMails(nano_os_mailbox_t* const mailbox, void* const mail_buffer, const uint32_t count);
+
+/** \brief Write mails into the ring buffer of a mailbox */
+static void NANO_OS_MAILBOX_WriteMails(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t count);
+
+#if ((NANO_OS_MAILBOX_URGENT_ENABLED == 1u) || (NANO_OS_MAILBOX_LANES_ENABLED == 1u))
+
+/** \brief Insert a mail into the ring buffer of a mailbox ahead of the mails of the lower lanes */
+static void NANO_OS_MAILBOX_InsertMail(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t lane);
+
+#endif /* ((NANO_OS_MAILBOX_URGENT_ENABLED == 1u) || (NANO_OS_MAILBOX_LANES_ENABLED == 1u)) */
+
+#if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+
+/** \brief Mailbox specific action on wait object signal */
 static bool NANO_OS_MAILBOX_WaitObjectWakeupCond(nano_os_wait_object_t* const wait_object, nano_os_task_t* task);
 
+#endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+
+/** \brief Give the free mail slots to the tasks waiting to post a mail */
+static nano_os_error_t NANO_OS_MAILBOX_WakeUpSenders(nano_os_mailbox_t* const mailbox);
+
+#endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+
+/** \brief Post a mail in a mailbox on behalf of an interrupt handler */
+static nano_os_error_t NANO_OS_MAILBOX_IsrPost(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
+
+#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+/** \brief Check if a buffer belongs to the pool of a zero-copy mailbox */
+static bool NANO_OS_MAILBOX_IsPoolBuffer(const nano_os_mailbox_t* const mailbox, const nano_os_mailbox_buffer_t* const buffer);
+
+/** \brief Update the owner and the state of a zero-copy mailbox buffer */
+static void NANO_OS_MAILBOX_SetBufferState(nano_os_mailbox_buffer_t* const buffer, const nano_os_mailbox_buffer_state_t state);
+
+/** \brief Count the buffers of a zero-copy mailbox held by a task (or by any task and interrupt handler if task is NULL) */
+static uint32_t NANO_OS_MAILBOX_CountHeldBuffers(const nano_os_mailbox_t* const mailbox, const struct _nano_os_task_t* const task);
+
+#endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+
+
 
 /** \brief Create a new mailbox */
 nano_os_error_t NANO_OS_MAILBOX_Create(nano_os_mailbox_t* const mailbox, const uint32_t max_mail_count,
@@ -47,24 +128,57 @@ nano_os_error_t NANO_OS_MAILBOX_Create(nano_os_mailbox_t* const mailbox, const u
         (mail_size != 0u) && (mailbox_buffer != NULL) &&
 		(mailbox_buffer_size >= NANO_OS_MAILBOX_SIZE(mail_size, max_mail_count)))
     {
-        /* 0 init of mailbox */
-        (void)MEMSET(mailbox, 0, sizeof(nano_os_mailbox_t));
+        /* Initialize mailbox */
+        ret = NANO_OS_MAILBOX_Initialize(mailbox, max_mail_count, mail_size, mailbox_buffer, queuing_type);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Create a new zero-copy mailbox */
+nano_os_error_t NANO_OS_MAILBOX_CreateZeroCopy(nano_os_mailbox_t* const mailbox, const uint32_t max_mail_count,
+                                               const size_t mail_size, void* const pool_buffer,
+                                               const size_t pool_buffer_size, const nano_os_queuing_type_t queuing_type)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
 
-        /* Init underlying wait object */
-        ret = NANO_OS_WAIT_OBJECT_Initialize(&mailbox->wait_object, WOT_MAILBOX, queuing_type);
+    /* Check parameters */
+    if ((mailbox != NULL) && (max_mail_count != 0u) &&
+        (mail_size != 0u) && (pool_buffer != NULL) &&
+        ((NANO_OS_CAST(size_t, pool_buffer) & (sizeof(void*) - 1u)) == 0u) &&
+        (pool_buffer_size >= NANO_OS_MAILBOX_ZEROCOPY_SIZE(mail_size, max_mail_count)))
+    {
+        /* The mails are references to the buffers which are stored after the references */
+        ret = NANO_OS_MAILBOX_Initialize(mailbox, max_mail_count, sizeof(nano_os_mailbox_buffer_t*), pool_buffer, queuing_type);
         if (ret == NOS_ERR_SUCCESS)
         {
-            /* Initialize mailbox data */
-            mailbox->mail_count = 0;
-            mailbox->mail_size = mail_size;
-            mailbox->max_mail_count = max_mail_count;
-            mailbox->mail_buffer = NANO_OS_CAST(uint8_t*, mailbox_buffer);
-            mailbox->read_pointer = mailbox->mail_buffer;
-            mailbox->write_pointer = mailbox->mail_buffer;
-            mailbox->end_pointer = &mailbox->mail_buffer[mailbox_buffer_size];
-
-            /* Real time trace event */
-            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, mailbox);
+            uint32_t i;
+
+            /* Initialize pool */
+            mailbox->zero_copy = true;
+            mailbox->pool_start = mailbox->end_pointer;
+            mailbox->buffer_size = NANO_OS_MAILBOX_ZEROCOPY_BUFFER_SIZE(mail_size);
+            mailbox->free_buffers = NULL;
+            for (i = max_mail_count; i > 0u; i--)
+            {
+                nano_os_mailbox_buffer_t* const buffer = NANO_OS_CAST(nano_os_mailbox_buffer_t*,
+                                                                      &mailbox->pool_start[(i - 1u) * mailbox->buffer_size]);
+                buffer->next = mailbox->free_buffers;
+                #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+                buffer->owner = NULL;
+                buffer->state = MBS_FREE;
+                #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+                mailbox->free_buffers = buffer;
+            }
         }
     }
 
@@ -74,6 +188,8 @@ nano_os_error_t NANO_OS_MAILBOX_Create(nano_os_mailbox_t* const mailbox, const u
     return ret;
 }
 
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
 
 #if (NANO_OS_MAILBOX_DESTROY_ENABLED == 1u)
 
@@ -88,11 +204,28 @@ nano_os_error_t NANO_OS_MAILBOX_Destroy(nano_os_mailbox_t* const mailbox)
     /* Check parameters */
     if ((mailbox != NULL) && (mailbox->wait_object.type == WOT_MAILBOX))
     {
-        /* Real time trace event */
-        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, mailbox);
-
-        /* Destroy wait object */
-        ret = NANO_OS_WAIT_OBJECT_Destroy(&mailbox->wait_object);
+        #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+        /* Check that no buffers are still held by the producers or the consumers */
+        if (NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox) && (NANO_OS_MAILBOX_CountHeldBuffers(mailbox, NULL) != 0u))
+        {
+            ret = NOS_ERR_MAILBOX_BUFFER_LEAK;
+        }
+        else
+        #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+        {
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, mailbox);
+
+            #if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+            /* Destroy senders wait object */
+            ret = NANO_OS_WAIT_OBJECT_Destroy(&mailbox->sender_wait_object);
+            if (ret == NOS_ERR_SUCCESS)
+            #endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+            {
+                /* Destroy wait object */
+                ret = NANO_OS_WAIT_OBJECT_Destroy(&mailbox->wait_object);
+            }
+        }
     }
 
     /* Syscall exit */
@@ -113,39 +246,158 @@ nano_os_error_t NANO_OS_MAILBOX_Wait(nano_os_mailbox_t* const mailbox, void* con
     /* Syscall entry */
     NANO_OS_SYSCALL_Enter(true);
 
-    /* Real time trace event */
-    NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_WAIT, mailbox);
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_WAIT, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        /* Wait for a mail */
+        ret = NANO_OS_MAILBOX_WaitMail(mailbox, mail_buffer, tick_count);
+
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Post a mail in a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_Post(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
 
     /* Check parameters */
-    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX))
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_POST, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        /* Post the mail */
+        ret = NANO_OS_MAILBOX_PostMail(mailbox, mail_buffer, 0u);
+
+		/* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MAILBOX_URGENT_ENABLED == 1u)
+
+/** \brief Post a mail at the read end of a mailbox so that it is received before the mails already in the mailbox */
+nano_os_error_t NANO_OS_MAILBOX_PostUrgent(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
     {
         /* Real time trace event */
-        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, mailbox);
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_POST_URGENT, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        /* Post the mail */
+        ret = NANO_OS_MAILBOX_PostMail(mailbox, mail_buffer, NANO_OS_MAILBOX_URGENT_LANE);
+
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_URGENT_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+
+/** \brief Split a mailbox into priority lanes */
+nano_os_error_t NANO_OS_MAILBOX_SetLanes(nano_os_mailbox_t* const mailbox, uint32_t* const lane_counts, const uint32_t lane_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (lane_counts != NULL) && (lane_count != 0u) &&
+        (mailbox->wait_object.type == WOT_MAILBOX) && !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        uint32_t i;
 
         /* Lock mailbox against interrupt handler access */
         WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
 
-        /* Check if a mail is available */
-        if (mailbox->mail_count != 0u)
+        /* The mails already in the mailbox belong to the lowest lane */
+        for (i = 0u; i < lane_count; i++)
         {
-            /* Read mail */
-        	(void)MEMCPY(mail_buffer, mailbox->read_pointer, mailbox->mail_size);
-        	mailbox->mail_count--;
-        	mailbox->read_pointer += mailbox->mail_size;
-        	if (mailbox->read_pointer == mailbox->end_pointer)
-        	{
-        		mailbox->read_pointer = mailbox->mail_buffer;
-        	}
-			ret = NOS_ERR_SUCCESS;
+            lane_counts[i] = ((i == 0u) ? mailbox->mail_count : 0u);
         }
-        else
-        {
-            /* Save the buffer to store the received mail */
-            g_nano_os.current_task->mailbox_buffer = mail_buffer;
+        mailbox->lane_counts = lane_counts;
+        mailbox->lane_count = lane_count;
 
-            /* Wait for a mail */
-            ret = NANO_OS_WAIT_OBJECT_Wait(&mailbox->wait_object, tick_count);
-        }
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Post a mail in a lane of a mailbox, the mails of the highest lanes are received first */
+nano_os_error_t NANO_OS_MAILBOX_PostLane(nano_os_mailbox_t* const mailbox, const uint32_t lane, void* const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        (lane < mailbox->lane_count))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_POST, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        /* Post the mail */
+        ret = NANO_OS_MAILBOX_PostMail(mailbox, mail_buffer, lane);
 
         /* Unlock mailbox against interrupt handler access */
         WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
@@ -157,9 +409,14 @@ nano_os_error_t NANO_OS_MAILBOX_Wait(nano_os_mailbox_t* const mailbox, void* con
     return ret;
 }
 
+#endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
 
-/** \brief Post a mail in a mailbox */
-nano_os_error_t NANO_OS_MAILBOX_Post(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+
+#if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+
+/** \brief Post a mail in a mailbox and wait for a free mail slot if the mailbox is full */
+nano_os_error_t NANO_OS_MAILBOX_PostTimeout(nano_os_mailbox_t* const mailbox, void* const mail_buffer,
+                                            const uint32_t tick_count)
 {
     nano_os_error_t ret = NOS_ERR_INVALID_ARG;
 
@@ -167,7 +424,8 @@ nano_os_error_t NANO_OS_MAILBOX_Post(nano_os_mailbox_t* const mailbox, void* con
     NANO_OS_SYSCALL_Enter(true);
 
     /* Check parameters */
-    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX))
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
     {
         /* Real time trace event */
         NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_POST, mailbox);
@@ -175,41 +433,27 @@ nano_os_error_t NANO_OS_MAILBOX_Post(nano_os_mailbox_t* const mailbox, void* con
         /* Lock mailbox against interrupt handler access */
         WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
 
-    	/* Check if a mail slot is available */
-		if (mailbox->mail_count == mailbox->max_mail_count)
-		{
-			/* Mailbox is full */
-			ret = NOS_ERR_MAILBOX_FULL;
-		}
-		else
-		{
-			uint32_t woke_up_task_count = 0u;
-
-			/* Signal waiting tasks */
-			ret = NANO_OS_WAIT_OBJECT_Signal(&mailbox->wait_object, NOS_ERR_SUCCESS, false, NANO_OS_MAILBOX_WaitObjectWakeupCond, &woke_up_task_count);
-			if (ret == NOS_ERR_SUCCESS)
-			{
-				/* Check if the mail has been consumed by a task */
-				if (woke_up_task_count == 0u)
-				{
-					/* No task was waiting on the mailbox, write mail into mailbox */
-				    mailbox->mail_count++;
-                    (void)MEMCPY(mailbox->write_pointer, mail_buffer, mailbox->mail_size);
-                    mailbox->write_pointer += mailbox->mail_size;
-                    if (mailbox->write_pointer == mailbox->end_pointer)
-                    {
-                        mailbox->write_pointer = mailbox->mail_buffer;
-                    }
-				}
-				else
-				{
-				    /* Write the mail directly into the waiting task buffer */
-				    (void)MEMCPY(g_nano_os.current_task->mailbox_buffer, mail_buffer, mailbox->mail_size);
-				}
-			}
-		}
+        /* Post the mail */
+        ret = NANO_OS_MAILBOX_PostMail(mailbox, mail_buffer, 0u);
+        if ((ret == NOS_ERR_MAILBOX_FULL) && (tick_count != 0u))
+        {
+            /* Save the mail to post, it will be written into the
+               mailbox by the task which will free a mail slot */
+            g_nano_os.current_task->mailbox_buffer = mail_buffer;
+
+            /* Interrupt handlers can only post mails, they can't free a mail slot
+               so the mailbox can be unlocked while waiting on the senders wait object */
+            WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+            WAIT_OBJECT_ISR_LOCK(mailbox->sender_wait_object);
 
-		/* Unlock mailbox against interrupt handler access */
+            /* Wait for a free mail slot */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&mailbox->sender_wait_object, tick_count);
+
+            WAIT_OBJECT_ISR_UNLOCK(mailbox->sender_wait_object);
+            WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+        }
+
+        /* Unlock mailbox against interrupt handler access */
         WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
     }
 
@@ -219,6 +463,8 @@ nano_os_error_t NANO_OS_MAILBOX_Post(nano_os_mailbox_t* const mailbox, void* con
     return ret;
 }
 
+#endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
 
 #if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
 
@@ -238,7 +484,7 @@ nano_os_error_t NANO_OS_MAILBOX_PostFromIsr(nano_os_mailbox_t* const mailbox, vo
         {
             /* Fill interrupt service request */
             nano_os_isr_service_request_t request;
-            request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_MAILBOX_Post);
+            request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_MAILBOX_IsrPost);
             request.object = mailbox;
             request.param1 = NANO_OS_CAST(uint32_t, mail_buffer);
 
@@ -247,74 +493,100 @@ nano_os_error_t NANO_OS_MAILBOX_PostFromIsr(nano_os_mailbox_t* const mailbox, vo
         }
         else
         {
-            /* No syscall in progress */
+            /* No syscall in progress, never wait for a free mail slot */
             ret = NANO_OS_MAILBOX_Post(mailbox, mail_buffer);
+            if (ret == NOS_ERR_MAILBOX_FULL)
+            {
+                /* Mail is dropped */
+                NANO_OS_PORT_ATOMIC_INC32(mailbox->isr_drop_count);
+            }
         }
     }
 
     return ret;
 }
 
-#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
-
-
-#if (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u)
 
-/** \brief Get the current number of mails into a mailbox */
-nano_os_error_t NANO_OS_MAILBOX_GetCount(nano_os_mailbox_t* const mailbox, uint32_t* const count)
+/** \brief Get the number of mails posted from interrupt handlers which have been dropped because the mailbox was full */
+nano_os_error_t NANO_OS_MAILBOX_GetIsrDropCount(nano_os_mailbox_t* const mailbox, uint32_t* const count)
 {
-	nano_os_error_t ret = NOS_ERR_INVALID_ARG;
-
-	/* Syscall entry */
-	NANO_OS_SYSCALL_Enter(true);
-
-	/* Check parameters */
-	if ((mailbox != NULL) && (count != NULL) && (mailbox->wait_object.type == WOT_MAILBOX))
-	{
-	    /* Real time trace event */
-        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_GETCOUNT, mailbox);
-
-        /* Lock mailbox against interrupt handler access */
-        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
-
-		/* Copy current count */
-		(*count) = mailbox->mail_count;
-
-		/* Unlock mailbox against interrupt handler access */
-        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
 
-		ret = NOS_ERR_SUCCESS;
-	}
+    /* Check parameters */
+    if ((mailbox != NULL) && (count != NULL) && (mailbox->wait_object.type == WOT_MAILBOX))
+    {
+        /* Copy current count */
+        (*count) = NANO_OS_PORT_ATOMIC_READ32(mailbox->isr_drop_count);
 
-	/* Syscall exit */
-	NANO_OS_SYSCALL_Exit();
+        ret = NOS_ERR_SUCCESS;
+    }
 
-	return ret;
+    return ret;
 }
 
-#endif /* (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u) */
+#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
 
 
-#if (NANO_OS_MAILBOX_SETNAME_ENABLED == 1u)
+#if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
 
-/** \brief Associate a name to a mailbox */
-nano_os_error_t NANO_OS_MAILBOX_SetName(nano_os_mailbox_t* const mailbox, const char* const name)
+/** \brief Wait for multiple mails in a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_WaitMany(nano_os_mailbox_t* const mailbox, void* const mail_buffer, const uint32_t max_count,
+                                         const bool all_or_nothing, uint32_t* const received_count, const uint32_t tick_count)
 {
     nano_os_error_t ret = NOS_ERR_INVALID_ARG;
 
     /* Syscall entry */
-    NANO_OS_SYSCALL_Enter(false);
+    NANO_OS_SYSCALL_Enter(true);
 
     /* Check parameters */
-    if (mailbox != NULL)
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (max_count != 0u) && (received_count != NULL) &&
+        (mailbox->wait_object.type == WOT_MAILBOX) && !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox) &&
+        (!all_or_nothing || (max_count <= mailbox->max_mail_count)))
     {
+        /* All the mails or at least one mail are needed */
+        const uint32_t min_count = (all_or_nothing ? max_count : 1u);
+
         /* Real time trace event */
-        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, mailbox);
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_WAIT_MANY, mailbox);
 
-        /* Save the name */
-        mailbox->wait_object.name = name;
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
 
-        ret = NOS_ERR_SUCCESS;
+        /* Check if enough mails are available */
+        (*received_count) = 0u;
+        if (mailbox->mail_count >= min_count)
+        {
+            /* Read all the available mails at once */
+            const uint32_t count = ((mailbox->mail_count < max_count) ? mailbox->mail_count : max_count);
+            NANO_OS_MAILBOX_ReadMails(mailbox, mail_buffer, count);
+            (*received_count) = count;
+            ret = NOS_ERR_SUCCESS;
+
+            #if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+            /* Give the free mail slots to the waiting senders */
+            ret = NANO_OS_MAILBOX_WakeUpSenders(mailbox);
+            #endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+        }
+        else
+        {
+            /* Save the buffer to store the received mails */
+            nano_os_task_t* const task = g_nano_os.current_task;
+            task->mailbox_buffer = mail_buffer;
+            task->mailbox_min_count = min_count;
+            task->mailbox_max_count = max_count;
+            task->mailbox_received_count = 0u;
+
+            /* Wait for the mails, they are copied into the
+               buffer of the task before it is woken up */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&mailbox->wait_object, tick_count);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                (*received_count) = task->mailbox_received_count;
+            }
+        }
+
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
     }
 
     /* Syscall exit */
@@ -323,24 +595,792 @@ nano_os_error_t NANO_OS_MAILBOX_SetName(nano_os_mailbox_t* const mailbox, const
     return ret;
 }
 
-#endif /* (NANO_OS_MAILBOX_SETNAME_ENABLED == 1u) */
-
 
-/** \brief Prototype for the OS object specific action on wait object signal */
-static bool NANO_OS_MAILBOX_WaitObjectWakeupCond(nano_os_wait_object_t* const wait_object, nano_os_task_t* task)
+/** \brief Post multiple mails in a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_PostMany(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t count,
+                                         const bool all_or_nothing, uint32_t* const posted_count)
 {
-    bool ret = false;
-    nano_os_mailbox_t* const mailbox = NANO_OS_CAST(nano_os_mailbox_t*, wait_object);
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
 
     /* Check parameters */
-    if ((mailbox != NULL) && (task != NULL))
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (count != 0u) && (posted_count != NULL) &&
+        (mailbox->wait_object.type == WOT_MAILBOX) && !NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
     {
-        /* Save the buffer of the woke up task to store the current mail */
-        g_nano_os.current_task->mailbox_buffer = task->mailbox_buffer;
+        uint32_t free_count;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_POST_MANY, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        /* Check if mail slots are available */
+        free_count = mailbox->max_mail_count - mailbox->mail_count;
+        (*posted_count) = 0u;
+        if ((free_count == 0u) || (all_or_nothing && (free_count < count)))
+        {
+            /* Mailbox is full */
+            ret = NOS_ERR_MAILBOX_FULL;
+        }
+        else
+        {
+            /* Write all the mails at once */
+            const uint32_t write_count = ((free_count < count) ? free_count : count);
+            NANO_OS_MAILBOX_WriteMails(mailbox, mail_buffer, write_count);
+            (*posted_count) = write_count;
+            ret = NOS_ERR_SUCCESS;
+
+            /* Wake up the waiting tasks only once for the whole batch */
+            if (mailbox->wait_object.waiting_tasks != NULL)
+            {
+                uint32_t woke_up_task_count = 0u;
+                ret = NANO_OS_WAIT_OBJECT_Signal(&mailbox->wait_object, NOS_ERR_SUCCESS, true, NANO_OS_MAILBOX_WaitObjectWakeupCond, &woke_up_task_count);
+            }
+        }
+
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
     }
 
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
     return ret;
 }
 
+#endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Acquire a free buffer from the pool of a zero-copy mailbox (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MAILBOX_Acquire(nano_os_mailbox_t* const mailbox, void** const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_mailbox_buffer_t* buffer;
+
+        /* Disable interrupts, the pool can then be accessed
+           from the interrupt handlers without a system call */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+        /* Get a free buffer */
+        buffer = mailbox->free_buffers;
+        if (buffer != NULL)
+        {
+            mailbox->free_buffers = buffer->next;
+            #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+            NANO_OS_MAILBOX_SetBufferState(buffer, MBS_ACQUIRED);
+            #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+        }
+
+        /* Enable interrupts */
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+
+        if (buffer != NULL)
+        {
+            (*mail_buffer) = NANO_OS_MAILBOX_BUFFER_DATA(buffer);
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            ret = NOS_ERR_MAILBOX_NO_BUFFER;
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Commit a previously acquired buffer into a zero-copy mailbox */
+nano_os_error_t NANO_OS_MAILBOX_Commit(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        nano_os_mailbox_buffer_t* const buffer = NANO_OS_MAILBOX_BUFFER_HEADER(mail_buffer);
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_COMMIT, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+        /* Check buffer */
+        if (!NANO_OS_MAILBOX_IsPoolBuffer(mailbox, buffer) || (buffer->state != MBS_ACQUIRED))
+        {
+            ret = NOS_ERR_MAILBOX_INVALID_BUFFER;
+        }
+        else
+        #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+        {
+            /* Post the reference to the buffer, the pool holds as many buffers as the
+               mailbox can hold mails so the mailbox can't be full at this point */
+            ret = NANO_OS_MAILBOX_PostMail(mailbox, &buffer, 0u);
+            #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                buffer->owner = NULL;
+                buffer->state = MBS_COMMITTED;
+            }
+            #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+        }
+
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+
+/** \brief Commit a previously acquired buffer into a zero-copy mailbox from an interrupt handler */
+nano_os_error_t NANO_OS_MAILBOX_CommitFromIsr(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_COMMIT_ISR, mailbox);
+
+        /* Check if operation can be done */
+        if (WAIT_OBJECT_ISR_ISLOCKED(mailbox->wait_object))
+        {
+            /* Fill interrupt service request, the buffer is only
+               referenced so it will still be valid when the request is serviced */
+            nano_os_isr_service_request_t request;
+            request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_MAILBOX_Commit);
+            request.object = mailbox;
+            request.param1 = NANO_OS_CAST(uint32_t, mail_buffer);
+
+            /* Queue request */
+            ret = NANO_OS_INTERRUPT_QueueRequest(&request);
+        }
+        else
+        {
+            /* No syscall in progress */
+            ret = NANO_OS_MAILBOX_Commit(mailbox, mail_buffer);
+        }
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
+
+/** \brief Wait for a buffer in a zero-copy mailbox */
+nano_os_error_t NANO_OS_MAILBOX_Receive(nano_os_mailbox_t* const mailbox, void** const mail_buffer,
+                                        const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        nano_os_mailbox_buffer_t* buffer = NULL;
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_RECEIVE, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+        /* Wait for a reference to a buffer */
+        ret = NANO_OS_MAILBOX_WaitMail(mailbox, &buffer, tick_count);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+            NANO_OS_MAILBOX_SetBufferState(buffer, MBS_RECEIVED);
+            #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+            (*mail_buffer) = NANO_OS_MAILBOX_BUFFER_DATA(buffer);
+        }
+
+        /* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Give back a buffer to the pool of a zero-copy mailbox (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MAILBOX_Release(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (mail_buffer != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        nano_os_int_status_reg_t int_status_reg;
+        nano_os_mailbox_buffer_t* const buffer = NANO_OS_MAILBOX_BUFFER_HEADER(mail_buffer);
+
+        /* Disable interrupts, the pool can then be accessed
+           from the interrupt handlers without a system call */
+        NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+
+        #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+        /* Check buffer, a buffer can be released by its consumer or
+           by its producer if it has not been committed */
+        if (!NANO_OS_MAILBOX_IsPoolBuffer(mailbox, buffer) ||
+            ((buffer->state != MBS_RECEIVED) && (buffer->state != MBS_ACQUIRED)))
+        {
+            ret = NOS_ERR_MAILBOX_INVALID_BUFFER;
+        }
+        else
+        #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+        {
+            /* Put the buffer back into the pool */
+            #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+            buffer->owner = NULL;
+            buffer->state = MBS_FREE;
+            #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+            buffer->next = mailbox->free_buffers;
+            mailbox->free_buffers = buffer;
+
+            ret = NOS_ERR_SUCCESS;
+        }
+
+        /* Enable interrupts */
+        NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+/** \brief Get the number of buffers of a zero-copy mailbox held by a task (or by any task and interrupt handler if task is NULL) */
+nano_os_error_t NANO_OS_MAILBOX_GetHeldBufferCount(nano_os_mailbox_t* const mailbox, const struct _nano_os_task_t* const task,
+                                                   uint32_t* const count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mailbox != NULL) && (count != NULL) && (mailbox->wait_object.type == WOT_MAILBOX) &&
+        NANO_OS_MAILBOX_IS_ZEROCOPY(mailbox))
+    {
+        /* Count the held buffers */
+        (*count) = NANO_OS_MAILBOX_CountHeldBuffers(mailbox, task);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u)
+
+/** \brief Get the current number of mails into a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_GetCount(nano_os_mailbox_t* const mailbox, uint32_t* const count)
+{
+	nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+	/* Syscall entry */
+	NANO_OS_SYSCALL_Enter(true);
+
+	/* Check parameters */
+	if ((mailbox != NULL) && (count != NULL) && (mailbox->wait_object.type == WOT_MAILBOX))
+	{
+	    /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MAILBOX_GETCOUNT, mailbox);
+
+        /* Lock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mailbox->wait_object);
+
+		/* Copy current count */
+		(*count) = mailbox->mail_count;
+
+		/* Unlock mailbox against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mailbox->wait_object);
+
+		ret = NOS_ERR_SUCCESS;
+	}
+
+	/* Syscall exit */
+	NANO_OS_SYSCALL_Exit();
+
+	return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_SetName(nano_os_mailbox_t* const mailbox, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (mailbox != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, mailbox);
+
+        /* Save the name */
+        mailbox->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Initialize the mailbox data */
+static nano_os_error_t NANO_OS_MAILBOX_Initialize(nano_os_mailbox_t* const mailbox, const uint32_t max_mail_count,
+                                                  const size_t mail_size, void* const mailbox_buffer,
+                                                  const nano_os_queuing_type_t queuing_type)
+{
+    nano_os_error_t ret;
+
+    /* 0 init of mailbox */
+    (void)MEMSET(mailbox, 0, sizeof(nano_os_mailbox_t));
+
+    /* Init underlying wait object */
+    ret = NANO_OS_WAIT_OBJECT_Initialize(&mailbox->wait_object, WOT_MAILBOX, queuing_type);
+    if (ret == NOS_ERR_SUCCESS)
+    {
+        /* Initialize mailbox data */
+        mailbox->mail_count = 0;
+        mailbox->mail_size = mail_size;
+        mailbox->max_mail_count = max_mail_count;
+        mailbox->mail_buffer = NANO_OS_CAST(uint8_t*, mailbox_buffer);
+        mailbox->read_pointer = mailbox->mail_buffer;
+        mailbox->write_pointer = mailbox->mail_buffer;
+        mailbox->end_pointer = &mailbox->mail_buffer[NANO_OS_MAILBOX_SIZE(mail_size, max_mail_count)];
+
+        #if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+        /* Init senders wait object, the highest priority sender gets the first free mail slot */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&mailbox->sender_wait_object, WOT_MAILBOX_SENDERS, QT_PRIORITY);
+        if (ret == NOS_ERR_SUCCESS)
+        #endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+        {
+            #if ((NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) && (NANO_OS_TRACE_ENABLED == 1u))
+            /* Blocked senders are seen as waiting on the mailbox */
+            mailbox->sender_wait_object.object_id = mailbox->wait_object.object_id;
+            #endif /* ((NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) && (NANO_OS_TRACE_ENABLED == 1u)) */
+
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, mailbox);
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Wait for a mail in a mailbox (the mailbox must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MAILBOX_WaitMail(nano_os_mailbox_t* const mailbox, void* const mail_buffer,
+                                                const uint32_t tick_count)
+{
+    nano_os_error_t ret;
+
+    /* Check if a mail is available */
+    if (mailbox->mail_count != 0u)
+    {
+        /* Read mail */
+        NANO_OS_MAILBOX_ReadMails(mailbox, mail_buffer, 1u);
+        ret = NOS_ERR_SUCCESS;
+
+        #if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+        /* Give the free mail slot to a waiting sender */
+        ret = NANO_OS_MAILBOX_WakeUpSenders(mailbox);
+        #endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+    }
+    else
+    {
+        /* Save the buffer to store the received mail */
+        g_nano_os.current_task->mailbox_buffer = mail_buffer;
+        #if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+        g_nano_os.current_task->mailbox_min_count = 1u;
+        g_nano_os.current_task->mailbox_max_count = 1u;
+        #endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+        /* Wait for a mail */
+        ret = NANO_OS_WAIT_OBJECT_Wait(&mailbox->wait_object, tick_count);
+    }
+
+    return ret;
+}
+
+
+/** \brief Post a mail in a lane of a mailbox (the mailbox must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MAILBOX_PostMail(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t lane)
+{
+    nano_os_error_t ret;
+
+    /* Check if the first waiting task only needs this mail, the tasks which wait
+       for a single mail are only waiting when the mailbox is empty */
+    nano_os_task_t* const task = mailbox->wait_object.waiting_tasks;
+    #if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+    if ((task != NULL) && (mailbox->mail_count == 0u) && (task->mailbox_min_count == 1u))
+    #else
+    if (task != NULL)
+    #endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+    {
+        uint32_t woke_up_task_count = 0u;
+
+        /* Write the mail directly into the buffer of the first waiting task */
+        (void)MEMCPY(task->mailbox_buffer, mail_buffer, mailbox->mail_size);
+        #if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+        task->mailbox_received_count = 1u;
+        #endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+        /* Wake up this task */
+        ret = NANO_OS_WAIT_OBJECT_Signal(&mailbox->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+    }
+    else if (mailbox->mail_count == mailbox->max_mail_count)
+    {
+        /* Mailbox is full */
+        ret = NOS_ERR_MAILBOX_FULL;
+    }
+    else
+    {
+        /* Write mail into mailbox */
+        #if ((NANO_OS_MAILBOX_URGENT_ENABLED == 1u) || (NANO_OS_MAILBOX_LANES_ENABLED == 1u))
+        if (lane != 0u)
+        {
+            NANO_OS_MAILBOX_InsertMail(mailbox, mail_buffer, lane);
+        }
+        else
+        #else
+        NANO_OS_UNUSED(lane);
+        #endif /* ((NANO_OS_MAILBOX_URGENT_ENABLED == 1u) || (NANO_OS_MAILBOX_LANES_ENABLED == 1u)) */
+        {
+            NANO_OS_MAILBOX_WriteMails(mailbox, mail_buffer, 1u);
+        }
+        ret = NOS_ERR_SUCCESS;
+
+        #if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+        /* Wake up the tasks waiting for multiple mails if enough mails are available */
+        if (task != NULL)
+        {
+            uint32_t woke_up_task_count = 0u;
+            ret = NANO_OS_WAIT_OBJECT_Signal(&mailbox->wait_object, NOS_ERR_SUCCESS, true, NANO_OS_MAILBOX_WaitObjectWakeupCond, &woke_up_task_count);
+        }
+        #endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+    }
+
+    return ret;
+}
+
+
+/** \brief Read mails from the ring buffer of a mailbox */
+static void NANO_OS_MAILBOX_ReadMails(nano_os_mailbox_t* const mailbox, void* const mail_buffer, const uint32_t count)
+{
+    uint8_t* const dest = NANO_OS_CAST(uint8_t*, mail_buffer);
+    const size_t size = count * mailbox->mail_size;
+    const size_t size_before_end = NANO_OS_CAST(size_t, mailbox->end_pointer - mailbox->read_pointer);
+
+    /* Copy the mails in at most 2 chunks to handle the wrap around */
+    if (size < size_before_end)
+    {
+        (void)MEMCPY(dest, mailbox->read_pointer, size);
+        mailbox->read_pointer += size;
+    }
+    else
+    {
+        (void)MEMCPY(dest, mailbox->read_pointer, size_before_end);
+        (void)MEMCPY(&dest[size_before_end], mailbox->mail_buffer, size - size_before_end);
+        mailbox->read_pointer = &mailbox->mail_buffer[size - size_before_end];
+    }
+    mailbox->mail_count -= count;
+
+    #if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+    {
+        /* The mails at the read end belong to the highest non-empty lanes */
+        uint32_t remaining = count;
+        uint32_t lane = mailbox->lane_count;
+        while ((remaining != 0u) && (lane != 0u))
+        {
+            const uint32_t lane_read_count = ((mailbox->lane_counts[lane - 1u] < remaining) ? mailbox->lane_counts[lane - 1u] : remaining);
+            mailbox->lane_counts[lane - 1u] -= lane_read_count;
+            remaining -= lane_read_count;
+            lane--;
+        }
+    }
+    #endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+}
+
+
+/** \brief Write mails into the ring buffer of a mailbox */
+static void NANO_OS_MAILBOX_WriteMails(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t count)
+{
+    const uint8_t* const src = NANO_OS_CAST(const uint8_t*, mail_buffer);
+    const size_t size = count * mailbox->mail_size;
+    const size_t size_before_end = NANO_OS_CAST(size_t, mailbox->end_pointer - mailbox->write_pointer);
+
+    /* Copy the mails in at most 2 chunks to handle the wrap around */
+    if (size < size_before_end)
+    {
+        (void)MEMCPY(mailbox->write_pointer, src, size);
+        mailbox->write_pointer += size;
+    }
+    else
+    {
+        (void)MEMCPY(mailbox->write_pointer, src, size_before_end);
+        (void)MEMCPY(mailbox->mail_buffer, &src[size_before_end], size - size_before_end);
+        mailbox->write_pointer = &mailbox->mail_buffer[size - size_before_end];
+    }
+    mailbox->mail_count += count;
+
+    #if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+    /* The mails at the write end belong to the lowest lane */
+    if (mailbox->lane_count != 0u)
+    {
+        mailbox->lane_counts[0u] += count;
+    }
+    #endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+}
+
+
+#if ((NANO_OS_MAILBOX_URGENT_ENABLED == 1u) || (NANO_OS_MAILBOX_LANES_ENABLED == 1u))
+
+/** \brief Insert a mail into the ring buffer of a mailbox ahead of the mails of the lower lanes */
+static void NANO_OS_MAILBOX_InsertMail(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t lane)
+{
+    uint8_t* slot;
+
+    #if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+    if (lane != NANO_OS_MAILBOX_URGENT_LANE)
+    {
+        /* The mails are sorted by lane with the highest lane at the read end, the new mail
+           goes after the mails of its lane so that each lane is received in FIFO order :
+           move the mails of the lower lanes by one slot towards the write end */
+        uint32_t position = 0u;
+        uint32_t i;
+        for (i = lane; i < mailbox->lane_count; i++)
+        {
+            position += mailbox->lane_counts[i];
+        }
+        slot = mailbox->write_pointer;
+        for (i = mailbox->mail_count; i > position; i--)
+        {
+            uint8_t* const previous_slot = ((slot == mailbox->mail_buffer) ? mailbox->end_pointer : slot) - mailbox->mail_size;
+            (void)MEMCPY(slot, previous_slot, mailbox->mail_size);
+            slot = previous_slot;
+        }
+        mailbox->write_pointer += mailbox->mail_size;
+        if (mailbox->write_pointer == mailbox->end_pointer)
+        {
+            mailbox->write_pointer = mailbox->mail_buffer;
+        }
+        mailbox->lane_counts[lane]++;
+    }
+    else
+    #endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+    {
+        /* Move the read end back by one slot, no other mail has to be moved */
+        if (mailbox->read_pointer == mailbox->mail_buffer)
+        {
+            mailbox->read_pointer = mailbox->end_pointer;
+        }
+        mailbox->read_pointer -= mailbox->mail_size;
+        slot = mailbox->read_pointer;
+
+        #if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+        /* The mail belongs to the highest lane */
+        if (mailbox->lane_count != 0u)
+        {
+            mailbox->lane_counts[mailbox->lane_count - 1u]++;
+        }
+        #endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+    }
+
+    /* Copy the mail */
+    (void)MEMCPY(slot, mail_buffer, mailbox->mail_size);
+    mailbox->mail_count++;
+}
+
+#endif /* ((NANO_OS_MAILBOX_URGENT_ENABLED == 1u) || (NANO_OS_MAILBOX_LANES_ENABLED == 1u)) */
+
+
+#if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+
+/** \brief Mailbox specific action on wait object signal */
+static bool NANO_OS_MAILBOX_WaitObjectWakeupCond(nano_os_wait_object_t* const wait_object, nano_os_task_t* task)
+{
+    bool ret = false;
+    nano_os_mailbox_t* const mailbox = NANO_OS_CAST(nano_os_mailbox_t*, wait_object);
+
+    /* Check if enough mails are available for the task */
+    if (mailbox->mail_count >= task->mailbox_min_count)
+    {
+        /* Copy the mails into the buffer of the task */
+        const uint32_t count = ((mailbox->mail_count < task->mailbox_max_count) ? mailbox->mail_count : task->mailbox_max_count);
+        NANO_OS_MAILBOX_ReadMails(mailbox, task->mailbox_buffer, count);
+        task->mailbox_received_count = count;
+        ret = true;
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+/** \brief Check if a buffer belongs to the pool of a zero-copy mailbox */
+static bool NANO_OS_MAILBOX_IsPoolBuffer(const nano_os_mailbox_t* const mailbox, const nano_os_mailbox_buffer_t* const buffer)
+{
+    bool ret = false;
+    const uint8_t* const buffer_start = NANO_OS_CAST(const uint8_t*, buffer);
+
+    /* Check that the buffer is the start of one of the buffers of the pool */
+    if ((buffer_start >= mailbox->pool_start) &&
+        (buffer_start < &mailbox->pool_start[mailbox->max_mail_count * mailbox->buffer_size]))
+    {
+        const size_t offset = NANO_OS_CAST(size_t, buffer_start - mailbox->pool_start);
+        ret = ((offset % mailbox->buffer_size) == 0u);
+    }
+
+    return ret;
+}
+
+
+/** \brief Update the owner and the state of a zero-copy mailbox buffer */
+static void NANO_OS_MAILBOX_SetBufferState(nano_os_mailbox_buffer_t* const buffer, const nano_os_mailbox_buffer_state_t state)
+{
+    /* The buffers held by the interrupt handlers have no owner */
+    if (g_nano_os.int_nesting_count == 0u)
+    {
+        buffer->owner = g_nano_os.current_task;
+    }
+    else
+    {
+        buffer->owner = NULL;
+    }
+    buffer->state = state;
+}
+
+
+/** \brief Count the buffers of a zero-copy mailbox held by a task (or by any task and interrupt handler if task is NULL) */
+static uint32_t NANO_OS_MAILBOX_CountHeldBuffers(const nano_os_mailbox_t* const mailbox, const struct _nano_os_task_t* const task)
+{
+    uint32_t i;
+    uint32_t count = 0u;
+
+    /* Look for the buffers which are neither in the pool nor in the mailbox */
+    for (i = 0u; i < mailbox->max_mail_count; i++)
+    {
+        const nano_os_mailbox_buffer_t* const buffer = NANO_OS_CAST(const nano_os_mailbox_buffer_t*,
+                                                                    &mailbox->pool_start[i * mailbox->buffer_size]);
+        if (((buffer->state == MBS_ACQUIRED) || (buffer->state == MBS_RECEIVED)) &&
+            ((task == NULL) || (buffer->owner == task)))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+#endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+
+/** \brief Give the free mail slots to the tasks waiting to post a mail */
+static nano_os_error_t NANO_OS_MAILBOX_WakeUpSenders(nano_os_mailbox_t* const mailbox)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* The senders are queued by priority, the mailbox can't have waiting
+       receivers since the senders are only waiting when the mailbox is full */
+    nano_os_task_t* task = mailbox->sender_wait_object.waiting_tasks;
+    while ((task != NULL) && (mailbox->mail_count != mailbox->max_mail_count) && (ret == NOS_ERR_SUCCESS))
+    {
+        uint32_t woke_up_task_count = 0u;
+
+        /* Write the mail of the sender into the free slot */
+        NANO_OS_MAILBOX_WriteMails(mailbox, task->mailbox_buffer, 1u);
+
+        /* Wake up the sender */
+        ret = NANO_OS_WAIT_OBJECT_Signal(&mailbox->sender_wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+
+        /* Next sender */
+        task = mailbox->sender_wait_object.waiting_tasks;
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
+
+#if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+
+/** \brief Post a mail in a mailbox on behalf of an interrupt handler */
+static nano_os_error_t NANO_OS_MAILBOX_IsrPost(nano_os_mailbox_t* const mailbox, void* const mail_buffer)
+{
+    /* Never wait for a free mail slot */
+    nano_os_error_t ret = NANO_OS_MAILBOX_Post(mailbox, mail_buffer);
+    if (ret == NOS_ERR_MAILBOX_FULL)
+    {
+        /* Mail is dropped, this is not an error from the interrupt service task point of view */
+        NANO_OS_PORT_ATOMIC_INC32(mailbox->isr_drop_count);
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
 
 #endif /* (NANO_OS_MAILBOX_ENABLED == 1u) */
@@ -38,6 +38,51 @@ extern "C"
 /** \brief Macro to help to determine the buffer size needed for a mail box */
 #define NANO_OS_MAILBOX_SIZE(mail_size, max_mail_count)		((mail_size) * (max_mail_count))
 
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Macro to help to determine the size of a buffer of a zero-copy mailbox (header and alignment padding included) */
+#define NANO_OS_MAILBOX_ZEROCOPY_BUFFER_SIZE(mail_size)         (sizeof(nano_os_mailbox_buffer_t) + \
+                                                                 ((((mail_size) + sizeof(void*)) - 1u) & ~(sizeof(void*) - 1u)))
+
+/** \brief Macro to help to determine the pool size needed for a zero-copy mailbox */
+#define NANO_OS_MAILBOX_ZEROCOPY_SIZE(mail_size, max_mail_count)    ((max_mail_count) * (sizeof(nano_os_mailbox_buffer_t*) + \
+                                                                                         NANO_OS_MAILBOX_ZEROCOPY_BUFFER_SIZE(mail_size)))
+
+
+#if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+/** \brief Zero-copy mailbox buffer states */
+typedef enum _nano_os_mailbox_buffer_state_t
+{
+    /** \brief Buffer is in the pool */
+    MBS_FREE = 0u,
+    /** \brief Buffer has been acquired by a producer */
+    MBS_ACQUIRED = 1u,
+    /** \brief Buffer has been committed into the mailbox */
+    MBS_COMMITTED = 2u,
+    /** \brief Buffer has been received by a consumer */
+    MBS_RECEIVED = 3u
+} nano_os_mailbox_buffer_state_t;
+
+#endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+
+/** \brief Zero-copy mailbox buffer header */
+typedef struct _nano_os_mailbox_buffer_t
+{
+    /** \brief Next free buffer in the pool */
+    struct _nano_os_mailbox_buffer_t* next;
+
+    #if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+    /** \brief Task which holds the buffer (NULL if held by the mailbox or by an interrupt handler) */
+    struct _nano_os_task_t* owner;
+    /** \brief Buffer state */
+    nano_os_mailbox_buffer_state_t state;
+    #endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+} nano_os_mailbox_buffer_t;
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
 
 
 /** \brief Nano OS mailbox set */
@@ -60,6 +105,34 @@ typedef struct _nano_os_mailbox_t
 	uint8_t* write_pointer;
 	/** \brief End pointer */
 	uint8_t* end_pointer;
+
+    #if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+    /** \brief Wait object for the tasks waiting for a free mail slot */
+    nano_os_wait_object_t sender_wait_object;
+    #endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
+    #if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+    /** \brief Number of mails in each priority lane (NULL if the mailbox has no lanes) */
+    uint32_t* lane_counts;
+    /** \brief Number of priority lanes */
+    uint32_t lane_count;
+    #endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+
+    #if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+    /** \brief Number of mails posted from interrupt handlers which have been dropped because the mailbox was full */
+    uint32_t isr_drop_count;
+    #endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
+    #if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+    /** \brief Indicate if the mailbox is a zero-copy mailbox */
+    bool zero_copy;
+    /** \brief First free buffer of the pool */
+    nano_os_mailbox_buffer_t* free_buffers;
+    /** \brief Start of the pool */
+    uint8_t* pool_start;
+    /** \brief Size of a buffer of the pool (header included) */
+    size_t buffer_size;
+    #endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
 } nano_os_mailbox_t;
 
 
@@ -70,6 +143,15 @@ nano_os_error_t NANO_OS_MAILBOX_Create(nano_os_mailbox_t* const mailbox, const u
 									   const size_t mail_size, void* const mailbox_buffer,
                                        const size_t mailbox_buffer_size, const nano_os_queuing_type_t queuing_type);
 
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Create a new zero-copy mailbox */
+nano_os_error_t NANO_OS_MAILBOX_CreateZeroCopy(nano_os_mailbox_t* const mailbox, const uint32_t max_mail_count,
+                                               const size_t mail_size, void* const pool_buffer,
+                                               const size_t pool_buffer_size, const nano_os_queuing_type_t queuing_type);
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
 #if (NANO_OS_MAILBOX_DESTROY_ENABLED == 1u)
 
 /** \brief Destroy a mailbox */
@@ -84,13 +166,87 @@ nano_os_error_t NANO_OS_MAILBOX_Wait(nano_os_mailbox_t* const mailbox, void* con
 /** \brief Post a mail in a mailbox */
 nano_os_error_t NANO_OS_MAILBOX_Post(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
 
+#if (NANO_OS_MAILBOX_URGENT_ENABLED == 1u)
+
+/** \brief Post a mail at the read end of a mailbox so that it is received before the mails already in the mailbox */
+nano_os_error_t NANO_OS_MAILBOX_PostUrgent(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
+
+#endif /* (NANO_OS_MAILBOX_URGENT_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_LANES_ENABLED == 1u)
+
+/** \brief Split a mailbox into priority lanes (lane_counts must hold lane_count entries and lane 0 is the lowest priority lane)
+ *         Posting in a lane moves the mails of the lower lanes, receiving always takes the oldest mail of the highest non-empty lane
+ */
+nano_os_error_t NANO_OS_MAILBOX_SetLanes(nano_os_mailbox_t* const mailbox, uint32_t* const lane_counts, const uint32_t lane_count);
+
+/** \brief Post a mail in a lane of a mailbox, the mails of the highest lanes are received first */
+nano_os_error_t NANO_OS_MAILBOX_PostLane(nano_os_mailbox_t* const mailbox, const uint32_t lane, void* const mail_buffer);
+
+#endif /* (NANO_OS_MAILBOX_LANES_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u)
+
+/** \brief Post a mail in a mailbox and wait for a free mail slot if the mailbox is full */
+nano_os_error_t NANO_OS_MAILBOX_PostTimeout(nano_os_mailbox_t* const mailbox, void* const mail_buffer,
+                                            const uint32_t tick_count);
+
+#endif /* (NANO_OS_MAILBOX_BLOCKING_POST_ENABLED == 1u) */
+
 #if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
 
 /** \brief Post a mail in a mailbox from an interrupt handler */
 nano_os_error_t NANO_OS_MAILBOX_PostFromIsr(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
 
+/** \brief Get the number of mails posted from interrupt handlers which have been dropped because the mailbox was full */
+nano_os_error_t NANO_OS_MAILBOX_GetIsrDropCount(nano_os_mailbox_t* const mailbox, uint32_t* const count);
+
 #endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
 
+#if (NANO_OS_MAILBOX_BATCH_ENABLED == 1u)
+
+/** \brief Wait for multiple mails in a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_WaitMany(nano_os_mailbox_t* const mailbox, void* const mail_buffer, const uint32_t max_count,
+                                         const bool all_or_nothing, uint32_t* const received_count, const uint32_t tick_count);
+
+/** \brief Post multiple mails in a mailbox */
+nano_os_error_t NANO_OS_MAILBOX_PostMany(nano_os_mailbox_t* const mailbox, const void* const mail_buffer, const uint32_t count,
+                                         const bool all_or_nothing, uint32_t* const posted_count);
+
+#endif /* (NANO_OS_MAILBOX_BATCH_ENABLED == 1u) */
+
+#if (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u)
+
+/** \brief Acquire a free buffer from the pool of a zero-copy mailbox (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MAILBOX_Acquire(nano_os_mailbox_t* const mailbox, void** const mail_buffer);
+
+/** \brief Commit a previously acquired buffer into a zero-copy mailbox */
+nano_os_error_t NANO_OS_MAILBOX_Commit(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
+
+#if (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u)
+
+/** \brief Commit a previously acquired buffer into a zero-copy mailbox from an interrupt handler */
+nano_os_error_t NANO_OS_MAILBOX_CommitFromIsr(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
+
+#endif /* (NANO_OS_MAILBOX_POSTFROMISR_ENABLED == 1u) */
+
+/** \brief Wait for a buffer in a zero-copy mailbox */
+nano_os_error_t NANO_OS_MAILBOX_Receive(nano_os_mailbox_t* const mailbox, void** const mail_buffer,
+                                        const uint32_t tick_count);
+
+/** \brief Give back a buffer to the pool of a zero-copy mailbox (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MAILBOX_Release(nano_os_mailbox_t* const mailbox, void* const mail_buffer);
+
+#if (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u)
+
+/** \brief Get the number of buffers of a zero-copy mailbox held by a task (or by any task and interrupt handler if task is NULL) */
+nano_os_error_t NANO_OS_MAILBOX_GetHeldBufferCount(nano_os_mailbox_t* const mailbox, const struct _nano_os_task_t* const task,
+                                                   uint32_t* const count);
+
+#endif /* (NANO_OS_MAILBOX_LEAK_CHECK_ENABLED == 1u) */
+
+#endif /* (NANO_OS_MAILBOX_ZEROCOPY_ENABLED == 1u) */
+
 #if (NANO_OS_MAILBOX_GETCOUNT_ENABLED == 1u)
 
 /** \brief Get the current number of mails into a mailbox */
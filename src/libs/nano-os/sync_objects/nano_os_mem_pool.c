@@ -0,0 +1,549 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_mem_pool.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_MEM_POOL_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+/** \brief Index marking the end of the free list */
+#define NANO_OS_MEM_POOL_END_OF_LIST                0xFFFFu
+
+/** \brief Get the word of the allocation bitmap holding the state of a block */
+#define NANO_OS_MEM_POOL_STATE_WORD(mem_pool, index)    (&(mem_pool)->block_states[(index) / 32u])
+
+/** \brief Get the bit of the allocation bitmap holding the state of a block */
+#define NANO_OS_MEM_POOL_STATE_BIT(index)               (1u << ((index) % 32u))
+
+/** \brief Get the index of the first free block from the head of the free list */
+#define NANO_OS_MEM_POOL_HEAD_INDEX(head)           ((head) & 0xFFFFu)
+
+/** \brief Build the head of the free list from its previous value and the index of the new first free block */
+#define NANO_OS_MEM_POOL_HEAD(head, index)          ((((head) + 0x10000u) & 0xFFFF0000u) | (index))
+
+/** \brief Get the link to the next free block stored at the beginning of a free block */
+#define NANO_OS_MEM_POOL_LINK(block)                (*NANO_OS_CAST(volatile uint32_t*, (block)))
+
+
+/** \brief Remove the first block of the free list */
+static void* NANO_OS_MEM_POOL_Pop(nano_os_mem_pool_t* const mem_pool);
+
+/** \brief Insert a block at the beginning of the free list */
+static void NANO_OS_MEM_POOL_Push(nano_os_mem_pool_t* const mem_pool, void* const block);
+
+/** \brief Check if a block belongs to a memory pool */
+static bool NANO_OS_MEM_POOL_IsValidBlock(const nano_os_mem_pool_t* const mem_pool, const void* const block);
+
+/** \brief Get the index of a block */
+static uint32_t NANO_OS_MEM_POOL_GetBlockIndex(const nano_os_mem_pool_t* const mem_pool, const void* const block);
+
+/** \brief Mark a block as free before inserting it in the free list, fails if the block is already free */
+static bool NANO_OS_MEM_POOL_MarkFree(nano_os_mem_pool_t* const mem_pool, const void* const block);
+
+/** \brief Give the free blocks to the waiting tasks */
+static nano_os_error_t NANO_OS_MEM_POOL_WakeUpWaiters(nano_os_mem_pool_t* const mem_pool);
+
+#if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+/** \brief Give the blocks freed by interrupt handlers to the waiting tasks */
+static nano_os_error_t NANO_OS_MEM_POOL_IsrFree(void* const object, const uint32_t free_count, const uint32_t unused);
+#endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+
+
+
+
+/** \brief Create a new memory pool */
+nano_os_error_t NANO_OS_MEM_POOL_Create(nano_os_mem_pool_t* const mem_pool, void* const buffer, const size_t block_size,
+                                        const uint32_t block_count, const nano_os_queuing_type_t queuing_type)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters, the buffer must be aligned to store the free list links */
+    if ((mem_pool != NULL) && (buffer != NULL) && (block_size != 0u) &&
+        (block_count != 0u) && (block_count < NANO_OS_MEM_POOL_MAX_BLOCK_COUNT) &&
+        ((NANO_OS_CAST(size_t, buffer) & (sizeof(uint32_t) - 1u)) == 0u))
+    {
+        /* 0 init of memory pool */
+        (void)MEMSET(mem_pool, 0, sizeof(nano_os_mem_pool_t));
+
+        /* Init underlying wait object */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&mem_pool->wait_object, WOT_MEM_POOL, queuing_type);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            uint32_t i;
+
+            /* Initialize memory pool data */
+            mem_pool->blocks = NANO_OS_CAST(uint8_t*, buffer);
+            mem_pool->block_size = NANO_OS_MEM_POOL_BLOCK_SIZE(block_size);
+            mem_pool->block_count = block_count;
+            mem_pool->free_count = block_count;
+
+            /* All the blocks are free, the allocation bitmap is stored after the blocks */
+            mem_pool->block_states = NANO_OS_CAST(volatile uint32_t*, &mem_pool->blocks[block_count * mem_pool->block_size]);
+            (void)MEMSET(NANO_OS_CAST(void*, mem_pool->block_states), 0, NANO_OS_MEM_POOL_STATES_SIZE(block_count));
+
+            /* Link all the blocks in the free list */
+            for (i = 0u; i < block_count; i++)
+            {
+                NANO_OS_MEM_POOL_LINK(&mem_pool->blocks[i * mem_pool->block_size]) = i + 1u;
+            }
+            NANO_OS_MEM_POOL_LINK(&mem_pool->blocks[(block_count - 1u) * mem_pool->block_size]) = NANO_OS_MEM_POOL_END_OF_LIST;
+            mem_pool->free_list = 0u;
+
+            #if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+            ret = NANO_OS_INTERRUPT_InitCoalescedRequest(&mem_pool->isr_free_request, NANO_OS_MEM_POOL_IsrFree, mem_pool);
+            #endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, mem_pool);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a memory pool */
+nano_os_error_t NANO_OS_MEM_POOL_Destroy(nano_os_mem_pool_t* const mem_pool)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mem_pool != NULL) && (mem_pool->wait_object.type == WOT_MEM_POOL))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, mem_pool);
+
+        #if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+        /* Drop the frees from interrupt handlers which are still pending */
+        ret = NANO_OS_INTERRUPT_CancelCoalescedRequest(&mem_pool->isr_free_request);
+        if (ret == NOS_ERR_SUCCESS)
+        #endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+        {
+            /* Destroy wait object */
+            ret = NANO_OS_WAIT_OBJECT_Destroy(&mem_pool->wait_object);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u) */
+
+
+/** \brief Allocate a block, wait for a free block if the memory pool is empty */
+nano_os_error_t NANO_OS_MEM_POOL_Allocate(nano_os_mem_pool_t* const mem_pool, void** const block, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mem_pool != NULL) && (block != NULL) && (mem_pool->wait_object.type == WOT_MEM_POOL))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MEM_POOL_ALLOCATE, mem_pool);
+
+        /* Lock memory pool against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(mem_pool->wait_object);
+
+        /* Get a free block */
+        (*block) = NANO_OS_MEM_POOL_Pop(mem_pool);
+        if ((*block) != NULL)
+        {
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            /* Wait for a block, it will be directly given to the task by the next free */
+            nano_os_task_t* const current_task = g_nano_os.current_task;
+            current_task->mem_pool_block = NULL;
+            (void)NANO_OS_PORT_AtomicFetchAdd32(&mem_pool->empty_count, 1u);
+            ret = NANO_OS_WAIT_OBJECT_Wait(&mem_pool->wait_object, tick_count);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                (*block) = current_task->mem_pool_block;
+            }
+        }
+
+        /* Unlock memory pool against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(mem_pool->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Allocate a block without waiting (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MEM_POOL_AllocateFromIsr(nano_os_mem_pool_t* const mem_pool, void** const block)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((mem_pool != NULL) && (block != NULL) && (mem_pool->wait_object.type == WOT_MEM_POOL))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MEM_POOL_ALLOCATE_ISR, mem_pool);
+
+        /* The free list is lock-free, no need to check if a syscall is in progress */
+        (*block) = NANO_OS_MEM_POOL_Pop(mem_pool);
+        if ((*block) != NULL)
+        {
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            (void)NANO_OS_PORT_AtomicFetchAdd32(&mem_pool->empty_count, 1u);
+            ret = NOS_ERR_MEM_POOL_EMPTY;
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Free a block */
+nano_os_error_t NANO_OS_MEM_POOL_Free(nano_os_mem_pool_t* const mem_pool, void* const block)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((mem_pool != NULL) && (mem_pool->wait_object.type == WOT_MEM_POOL))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MEM_POOL_FREE, mem_pool);
+
+        /* Check block */
+        if (!NANO_OS_MEM_POOL_IsValidBlock(mem_pool, block) || !NANO_OS_MEM_POOL_MarkFree(mem_pool, block))
+        {
+            ret = NOS_ERR_MEM_POOL_INVALID_BLOCK;
+        }
+        else
+        {
+            /* Lock memory pool against interrupt handler access */
+            WAIT_OBJECT_ISR_LOCK(mem_pool->wait_object);
+
+            /* Put back the block in the free list and give it to a waiting task if any */
+            NANO_OS_MEM_POOL_Push(mem_pool, block);
+            ret = NANO_OS_MEM_POOL_WakeUpWaiters(mem_pool);
+
+            /* Unlock memory pool against interrupt handler access */
+            WAIT_OBJECT_ISR_UNLOCK(mem_pool->wait_object);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+
+/** \brief Free a block from an interrupt handler */
+nano_os_error_t NANO_OS_MEM_POOL_FreeFromIsr(nano_os_mem_pool_t* const mem_pool, void* const block)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((mem_pool != NULL) && (mem_pool->wait_object.type == WOT_MEM_POOL))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MEM_POOL_FREE_ISR, mem_pool);
+
+        /* Check if operation can be done */
+        if (!NANO_OS_MEM_POOL_IsValidBlock(mem_pool, block))
+        {
+            ret = NOS_ERR_MEM_POOL_INVALID_BLOCK;
+        }
+        else if (WAIT_OBJECT_ISR_ISLOCKED(mem_pool->wait_object))
+        {
+            if (!NANO_OS_MEM_POOL_MarkFree(mem_pool, block))
+            {
+                /* Already free */
+                ret = NOS_ERR_MEM_POOL_INVALID_BLOCK;
+            }
+            else
+            {
+                /* The block is immediatly available for the next allocation,
+                   the waiting tasks will get it when the request is processed */
+                NANO_OS_MEM_POOL_Push(mem_pool, block);
+                ret = NANO_OS_INTERRUPT_QueueCoalescedRequest(&mem_pool->isr_free_request);
+            }
+        }
+        else
+        {
+            /* No syscall in progress */
+            ret = NANO_OS_MEM_POOL_Free(mem_pool, block);
+        }
+    }
+
+    return ret;
+}
+
+
+/** \brief Give the blocks freed by interrupt handlers to the waiting tasks */
+static nano_os_error_t NANO_OS_MEM_POOL_IsrFree(void* const object, const uint32_t free_count, const uint32_t unused)
+{
+    nano_os_error_t ret;
+    nano_os_mem_pool_t* const mem_pool = NANO_OS_CAST(nano_os_mem_pool_t*, object);
+    NANO_OS_UNUSED(free_count);
+    NANO_OS_UNUSED(unused);
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Lock memory pool against interrupt handler access */
+    WAIT_OBJECT_ISR_LOCK(mem_pool->wait_object);
+
+    /* The blocks are already in the free list */
+    ret = NANO_OS_MEM_POOL_WakeUpWaiters(mem_pool);
+
+    /* Unlock memory pool against interrupt handler access */
+    WAIT_OBJECT_ISR_UNLOCK(mem_pool->wait_object);
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+
+
+/** \brief Get the statistics of a memory pool (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MEM_POOL_GetStats(const nano_os_mem_pool_t* const mem_pool, nano_os_mem_pool_stats_t* const stats)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((mem_pool != NULL) && (stats != NULL) && (mem_pool->wait_object.type == WOT_MEM_POOL))
+    {
+        /* Copy the statistics */
+        stats->block_size = mem_pool->block_size;
+        stats->block_count = mem_pool->block_count;
+        stats->free_count = NANO_OS_PORT_AtomicLoad32(&mem_pool->free_count);
+        stats->max_used_count = NANO_OS_PORT_AtomicLoad32(&mem_pool->max_used_count);
+        stats->empty_count = NANO_OS_PORT_AtomicLoad32(&mem_pool->empty_count);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a memory pool */
+nano_os_error_t NANO_OS_MEM_POOL_SetName(nano_os_mem_pool_t* const mem_pool, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (mem_pool != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, mem_pool);
+
+        /* Save the name */
+        mem_pool->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Remove the first block of the free list */
+static void* NANO_OS_MEM_POOL_Pop(nano_os_mem_pool_t* const mem_pool)
+{
+    uint8_t* block;
+    uint32_t head;
+    uint32_t next = NANO_OS_MEM_POOL_END_OF_LIST;
+
+    /* The tag of the head is incremented on each update so that the compare and swap
+       fails if the list has been modified by an interrupt handler after the link of
+       the first block has been read, even if the same block is back on top of the list */
+    do
+    {
+        head = NANO_OS_PORT_AtomicLoad32(&mem_pool->free_list);
+        if (NANO_OS_MEM_POOL_HEAD_INDEX(head) == NANO_OS_MEM_POOL_END_OF_LIST)
+        {
+            /* Empty */
+            block = NULL;
+        }
+        else
+        {
+            block = &mem_pool->blocks[NANO_OS_MEM_POOL_HEAD_INDEX(head) * mem_pool->block_size];
+            next = NANO_OS_MEM_POOL_LINK(block);
+        }
+    }
+    while ((block != NULL) &&
+           !NANO_OS_PORT_AtomicCas32(&mem_pool->free_list, head, NANO_OS_MEM_POOL_HEAD(head, NANO_OS_MEM_POOL_HEAD_INDEX(next))));
+
+    if (block != NULL)
+    {
+        const uint32_t index = NANO_OS_MEM_POOL_HEAD_INDEX(head);
+        const uint32_t used_count = mem_pool->block_count - (NANO_OS_PORT_AtomicFetchAdd32(&mem_pool->free_count, 0xFFFFFFFFu) - 1u);
+        uint32_t max_used_count;
+
+        /* The block is now owned by the caller */
+        (void)NANO_OS_PORT_AtomicFetchOr32(NANO_OS_MEM_POOL_STATE_WORD(mem_pool, index), NANO_OS_MEM_POOL_STATE_BIT(index));
+
+        /* Update the high-water mark */
+        do
+        {
+            max_used_count = NANO_OS_PORT_AtomicLoad32(&mem_pool->max_used_count);
+        }
+        while ((used_count > max_used_count) && !NANO_OS_PORT_AtomicCas32(&mem_pool->max_used_count, max_used_count, used_count));
+    }
+
+    return block;
+}
+
+
+/** \brief Insert a block at the beginning of the free list */
+static void NANO_OS_MEM_POOL_Push(nano_os_mem_pool_t* const mem_pool, void* const block)
+{
+    uint32_t head;
+    const uint32_t index = NANO_OS_MEM_POOL_GetBlockIndex(mem_pool, block);
+
+    do
+    {
+        head = NANO_OS_PORT_AtomicLoad32(&mem_pool->free_list);
+        NANO_OS_MEM_POOL_LINK(block) = NANO_OS_MEM_POOL_HEAD_INDEX(head);
+    }
+    while (!NANO_OS_PORT_AtomicCas32(&mem_pool->free_list, head, NANO_OS_MEM_POOL_HEAD(head, index)));
+
+    (void)NANO_OS_PORT_AtomicFetchAdd32(&mem_pool->free_count, 1u);
+}
+
+
+/** \brief Check if a block belongs to a memory pool */
+static bool NANO_OS_MEM_POOL_IsValidBlock(const nano_os_mem_pool_t* const mem_pool, const void* const block)
+{
+    bool ret = false;
+    const uint8_t* const block_start = NANO_OS_CAST(const uint8_t*, block);
+
+    if ((block_start >= mem_pool->blocks) &&
+        (block_start < &mem_pool->blocks[mem_pool->block_count * mem_pool->block_size]))
+    {
+        ret = ((NANO_OS_CAST(size_t, (block_start - mem_pool->blocks)) % mem_pool->block_size) == 0u);
+    }
+
+    return ret;
+}
+
+
+/** \brief Get the index of a block */
+static uint32_t NANO_OS_MEM_POOL_GetBlockIndex(const nano_os_mem_pool_t* const mem_pool, const void* const block)
+{
+    return (NANO_OS_CAST(uint32_t, (NANO_OS_CAST(const uint8_t*, block) - mem_pool->blocks)) / mem_pool->block_size);
+}
+
+
+/** \brief Mark a block as free before inserting it in the free list, fails if the block is already free */
+static bool NANO_OS_MEM_POOL_MarkFree(nano_os_mem_pool_t* const mem_pool, const void* const block)
+{
+    uint32_t states;
+    const uint32_t index = NANO_OS_MEM_POOL_GetBlockIndex(mem_pool, block);
+    volatile uint32_t* const state_word = NANO_OS_MEM_POOL_STATE_WORD(mem_pool, index);
+    const uint32_t state_bit = NANO_OS_MEM_POOL_STATE_BIT(index);
+
+    /* The compare and swap ensures that only one of concurrent frees of the same block succeeds */
+    do
+    {
+        states = NANO_OS_PORT_AtomicLoad32(state_word);
+    }
+    while (((states & state_bit) != 0u) && !NANO_OS_PORT_AtomicCas32(state_word, states, states & ~state_bit));
+
+    return ((states & state_bit) != 0u);
+}
+
+
+/** \brief Give the free blocks to the waiting tasks */
+static nano_os_error_t NANO_OS_MEM_POOL_WakeUpWaiters(nano_os_mem_pool_t* const mem_pool)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Each waiting task gets a block directly from the free list */
+    nano_os_task_t* task = mem_pool->wait_object.waiting_tasks;
+    while ((task != NULL) && (ret == NOS_ERR_SUCCESS))
+    {
+        void* const block = NANO_OS_MEM_POOL_Pop(mem_pool);
+        if (block != NULL)
+        {
+            uint32_t woke_up_task_count = 0u;
+
+            /* Wake up the first waiting task with the block */
+            task->mem_pool_block = block;
+            ret = NANO_OS_WAIT_OBJECT_Signal(&mem_pool->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+
+            /* Next waiting task */
+            task = mem_pool->wait_object.waiting_tasks;
+        }
+        else
+        {
+            /* The blocks have been allocated by interrupt handlers in the meantime */
+            task = NULL;
+        }
+    }
+
+    return ret;
+}
+
+
+#endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
@@ -0,0 +1,149 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_MEM_POOL_H
+#define NANO_OS_MEM_POOL_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_MEM_POOL_ENABLED == 1u)
+
+
+#include "nano_os_wait_object.h"
+#include "nano_os_interrupt.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Maximum number of blocks in a memory pool */
+#define NANO_OS_MEM_POOL_MAX_BLOCK_COUNT                0xFFFFu
+
+/** \brief Macro to help to determine the size in bytes of a block of a memory pool (rounded to hold a free list link) */
+#define NANO_OS_MEM_POOL_BLOCK_SIZE(block_size)         ((((block_size) + sizeof(uint32_t) - 1u) / sizeof(uint32_t)) * sizeof(uint32_t))
+
+/** \brief Macro to help to determine the size in bytes of the allocation bitmap of a memory pool (1 bit per block) */
+#define NANO_OS_MEM_POOL_STATES_SIZE(block_count)       ((((block_count) + 31u) / 32u) * sizeof(uint32_t))
+
+/** \brief Macro to help to determine the buffer size needed to store block_count blocks of block_size bytes and their allocation bitmap */
+#define NANO_OS_MEM_POOL_SIZE(block_size, block_count)  ((NANO_OS_MEM_POOL_BLOCK_SIZE(block_size) * (block_count)) + NANO_OS_MEM_POOL_STATES_SIZE(block_count))
+
+
+/** \brief Nano OS memory pool
+ *         Allocates fixed-size blocks carved from a static buffer.
+ *         The free blocks are linked in a lock-free list so that blocks can be allocated
+ *         and freed in constant time, including from interrupt handlers.
+ *         The allocation state of each block is kept in a bitmap stored after the blocks
+ *         so that a block which is freed twice is detected without looking at its content.
+ */
+typedef struct _nano_os_mem_pool_t
+{
+    /** \brief Underlying wait object (tasks waiting for a free block) */
+    nano_os_wait_object_t wait_object;
+
+    /** \brief Blocks buffer */
+    uint8_t* blocks;
+    /** \brief Size in bytes of a block */
+    size_t block_size;
+    /** \brief Number of blocks */
+    uint32_t block_count;
+    /** \brief Allocation bitmap : 1 bit per block, set when the block is allocated */
+    volatile uint32_t* block_states;
+    /** \brief Head of the free list : modification tag in the upper 16 bits, index of the first free block in the lower 16 bits */
+    volatile uint32_t free_list;
+    /** \brief Number of free blocks */
+    volatile uint32_t free_count;
+    /** \brief Maximum number of blocks used at the same time */
+    volatile uint32_t max_used_count;
+    /** \brief Number of allocations which have failed or had to wait for a free block */
+    volatile uint32_t empty_count;
+
+    #if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+    /** \brief Interrupt service request to give the blocks freed by interrupt handlers to the waiting tasks */
+    nano_os_isr_coalesced_request_t isr_free_request;
+    #endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+} nano_os_mem_pool_t;
+
+
+/** \brief Nano OS memory pool statistics */
+typedef struct _nano_os_mem_pool_stats_t
+{
+    /** \brief Size in bytes of a block */
+    size_t block_size;
+    /** \brief Number of blocks */
+    uint32_t block_count;
+    /** \brief Number of free blocks */
+    uint32_t free_count;
+    /** \brief Maximum number of blocks used at the same time (high-water mark) */
+    uint32_t max_used_count;
+    /** \brief Number of allocations which have failed or had to wait for a free block */
+    uint32_t empty_count;
+} nano_os_mem_pool_stats_t;
+
+
+
+
+/** \brief Create a new memory pool (buffer must hold NANO_OS_MEM_POOL_SIZE(block_size, block_count) bytes) */
+nano_os_error_t NANO_OS_MEM_POOL_Create(nano_os_mem_pool_t* const mem_pool, void* const buffer, const size_t block_size,
+                                        const uint32_t block_count, const nano_os_queuing_type_t queuing_type);
+
+#if (NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a memory pool */
+nano_os_error_t NANO_OS_MEM_POOL_Destroy(nano_os_mem_pool_t* const mem_pool);
+
+#endif /* (NANO_OS_MEM_POOL_DESTROY_ENABLED == 1u) */
+
+/** \brief Allocate a block, wait for a free block if the memory pool is empty */
+nano_os_error_t NANO_OS_MEM_POOL_Allocate(nano_os_mem_pool_t* const mem_pool, void** const block, const uint32_t tick_count);
+
+/** \brief Allocate a block without waiting (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MEM_POOL_AllocateFromIsr(nano_os_mem_pool_t* const mem_pool, void** const block);
+
+/** \brief Free a block (fails with NOS_ERR_MEM_POOL_INVALID_BLOCK if the block does not belong to the memory pool or is already free) */
+nano_os_error_t NANO_OS_MEM_POOL_Free(nano_os_mem_pool_t* const mem_pool, void* const block);
+
+#if (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u)
+
+/** \brief Free a block from an interrupt handler (fails with NOS_ERR_MEM_POOL_INVALID_BLOCK if the block does not belong to the memory pool or is already free) */
+nano_os_error_t NANO_OS_MEM_POOL_FreeFromIsr(nano_os_mem_pool_t* const mem_pool, void* const block);
+
+#endif /* (NANO_OS_MEM_POOL_FREEFROMISR_ENABLED == 1u) */
+
+/** \brief Get the statistics of a memory pool (can be called from an interrupt handler) */
+nano_os_error_t NANO_OS_MEM_POOL_GetStats(const nano_os_mem_pool_t* const mem_pool, nano_os_mem_pool_stats_t* const stats);
+
+#if (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a memory pool */
+nano_os_error_t NANO_OS_MEM_POOL_SetName(nano_os_mem_pool_t* const mem_pool, const char* const name);
+
+#endif /* (NANO_OS_MEM_POOL_SETNAME_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_MEM_POOL_ENABLED == 1u) */
+
+#endif /* NANO_OS_MEM_POOL_H */
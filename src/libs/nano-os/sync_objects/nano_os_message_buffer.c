@@ -0,0 +1,612 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_message_buffer.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+/** \brief Send a message if there is enough free space (the message buffer must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_SendMessage(nano_os_message_buffer_t* const message_buffer,
+                                                          const void* const message, const size_t message_size);
+
+/** \brief Receive the oldest message of the ring buffer if it fits in the receive buffer
+ *         (the message buffer must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_ReceiveMessage(nano_os_message_buffer_t* const message_buffer, void* const message,
+                                                             const size_t max_message_size, size_t* const message_size);
+
+/** \brief Give the messages of the ring buffer to the waiting receivers */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_WakeUpReceivers(nano_os_message_buffer_t* const message_buffer);
+
+/** \brief Write the messages of the waiting senders into the free space of the ring buffer */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_WakeUpSenders(nano_os_message_buffer_t* const message_buffer);
+
+/** \brief Get the size of the oldest message of the ring buffer */
+static size_t NANO_OS_MESSAGE_BUFFER_PeekSize(const nano_os_message_buffer_t* const message_buffer);
+
+/** \brief Check if a message can be written entirely into the free space of the ring buffer */
+static bool NANO_OS_MESSAGE_BUFFER_Fits(const nano_os_message_buffer_t* const message_buffer, const size_t message_size);
+
+/** \brief Write bytes at the write end of the ring buffer */
+static void NANO_OS_MESSAGE_BUFFER_WriteBytes(nano_os_message_buffer_t* const message_buffer, const void* const data, const size_t size);
+
+/** \brief Read bytes from the read end of the ring buffer (the bytes are skipped if data is NULL) */
+static void NANO_OS_MESSAGE_BUFFER_ReadBytes(nano_os_message_buffer_t* const message_buffer, void* const data, const size_t size);
+
+
+
+
+/** \brief Create a new message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Create(nano_os_message_buffer_t* const message_buffer, void* const buffer,
+                                              const size_t buffer_size, const nano_os_queuing_type_t queuing_type)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((message_buffer != NULL) && (buffer != NULL) &&
+        (buffer_size > sizeof(nano_os_message_length_t)))
+    {
+        /* 0 init of message buffer */
+        (void)MEMSET(message_buffer, 0, sizeof(nano_os_message_buffer_t));
+
+        /* Init underlying wait objects */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&message_buffer->wait_object, WOT_MESSAGE_BUFFER, queuing_type);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Initialize(&message_buffer->sender_wait_object, WOT_MESSAGE_BUFFER_SENDERS, QT_PRIORITY);
+        }
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            #if (NANO_OS_TRACE_ENABLED == 1u)
+            /* Blocked senders are seen as waiting on the message buffer */
+            message_buffer->sender_wait_object.object_id = message_buffer->wait_object.object_id;
+            #endif /* (NANO_OS_TRACE_ENABLED == 1u) */
+
+            /* Initialize the ring buffer */
+            message_buffer->buffer = NANO_OS_CAST(uint8_t*, buffer);
+            message_buffer->buffer_size = buffer_size;
+
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, message_buffer);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Destroy(nano_os_message_buffer_t* const message_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((message_buffer != NULL) && (message_buffer->wait_object.type == WOT_MESSAGE_BUFFER))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, message_buffer);
+
+        /* Destroy wait objects */
+        ret = NANO_OS_WAIT_OBJECT_Destroy(&message_buffer->sender_wait_object);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            ret = NANO_OS_WAIT_OBJECT_Destroy(&message_buffer->wait_object);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u) */
+
+
+/** \brief Send a message, wait for enough free space if the message buffer is full */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Send(nano_os_message_buffer_t* const message_buffer, const void* const message,
+                                            const size_t message_size, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters, a message which can't fit in the empty ring buffer would wait forever */
+    if ((message_buffer != NULL) && ((message != NULL) || (message_size == 0u)) &&
+        (message_buffer->wait_object.type == WOT_MESSAGE_BUFFER) &&
+        (message_size <= NANO_OS_MESSAGE_BUFFER_MAX_MESSAGE_SIZE) &&
+        (NANO_OS_MESSAGE_BUFFER_RECORD_SIZE(message_size) <= message_buffer->buffer_size))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MESSAGE_BUFFER_SEND, message_buffer);
+
+        /* Lock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(message_buffer->wait_object);
+
+        /* Send the message */
+        ret = NANO_OS_MESSAGE_BUFFER_SendMessage(message_buffer, message, message_size);
+        if ((ret == NOS_ERR_MESSAGE_BUFFER_FULL) && (tick_count != 0u))
+        {
+            /* Save the message to send, it will be written into the
+               ring buffer by the task which will free enough space */
+            g_nano_os.current_task->message_buffer = NANO_OS_CAST(void*, message);
+            g_nano_os.current_task->message_size = message_size;
+
+            WAIT_OBJECT_ISR_UNLOCK(message_buffer->wait_object);
+            WAIT_OBJECT_ISR_LOCK(message_buffer->sender_wait_object);
+
+            /* Wait for enough free space */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&message_buffer->sender_wait_object, tick_count);
+
+            WAIT_OBJECT_ISR_UNLOCK(message_buffer->sender_wait_object);
+            WAIT_OBJECT_ISR_LOCK(message_buffer->wait_object);
+        }
+
+        /* Unlock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(message_buffer->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Receive a message, wait for a message if the message buffer is empty */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Receive(nano_os_message_buffer_t* const message_buffer, void* const message,
+                                               const size_t max_message_size, size_t* const message_size,
+                                               const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((message_buffer != NULL) && ((message != NULL) || (max_message_size == 0u)) && (message_size != NULL) &&
+        (message_buffer->wait_object.type == WOT_MESSAGE_BUFFER))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_MESSAGE_BUFFER_RECEIVE, message_buffer);
+
+        /* Lock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(message_buffer->wait_object);
+
+        /* Check if a message is available */
+        if (message_buffer->message_count != 0u)
+        {
+            /* Receive the oldest message */
+            ret = NANO_OS_MESSAGE_BUFFER_ReceiveMessage(message_buffer, message, max_message_size, message_size);
+            if (ret == NOS_ERR_SUCCESS)
+            {
+                /* Give the freed space to the waiting senders */
+                ret = NANO_OS_MESSAGE_BUFFER_WakeUpSenders(message_buffer);
+            }
+        }
+        else
+        {
+            /* Save the receive buffer, the next message will be directly
+               copied into it by the sender */
+            nano_os_task_t* const current_task = g_nano_os.current_task;
+            current_task->message_buffer = message;
+            current_task->message_size = max_message_size;
+
+            /* Wait for a message */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&message_buffer->wait_object, tick_count);
+            if ((ret == NOS_ERR_SUCCESS) || (ret == NOS_ERR_MESSAGE_BUFFER_TOO_SMALL))
+            {
+                /* Size of the received message or of the message which didn't fit */
+                (*message_size) = current_task->message_size;
+            }
+        }
+
+        /* Unlock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(message_buffer->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Get the size of the largest message which can be sent without waiting */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_GetFreeSize(nano_os_message_buffer_t* const message_buffer, size_t* const free_size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((message_buffer != NULL) && (free_size != NULL) && (message_buffer->wait_object.type == WOT_MESSAGE_BUFFER))
+    {
+        size_t free_bytes;
+
+        /* Lock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(message_buffer->wait_object);
+
+        /* The length prefix must fit too, and waiting senders have precedence */
+        free_bytes = message_buffer->buffer_size - message_buffer->used_size;
+        if ((message_buffer->sender_wait_object.waiting_tasks != NULL) ||
+            (free_bytes <= sizeof(nano_os_message_length_t)))
+        {
+            (*free_size) = 0u;
+        }
+        else
+        {
+            (*free_size) = free_bytes - sizeof(nano_os_message_length_t);
+            if ((*free_size) > NANO_OS_MESSAGE_BUFFER_MAX_MESSAGE_SIZE)
+            {
+                (*free_size) = NANO_OS_MESSAGE_BUFFER_MAX_MESSAGE_SIZE;
+            }
+        }
+
+        /* Unlock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(message_buffer->wait_object);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Get the size of the next message to receive */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_GetNextSize(nano_os_message_buffer_t* const message_buffer, size_t* const message_size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((message_buffer != NULL) && (message_size != NULL) && (message_buffer->wait_object.type == WOT_MESSAGE_BUFFER))
+    {
+        /* Lock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(message_buffer->wait_object);
+
+        /* Read the length prefix of the oldest message */
+        if (message_buffer->message_count != 0u)
+        {
+            (*message_size) = NANO_OS_MESSAGE_BUFFER_PeekSize(message_buffer);
+            ret = NOS_ERR_SUCCESS;
+        }
+        else
+        {
+            /* Same status as a receive without waiting on an empty message buffer */
+            ret = NOS_ERR_TIMEOUT;
+        }
+
+        /* Unlock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(message_buffer->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Get the number of messages in a message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_GetCount(nano_os_message_buffer_t* const message_buffer, uint32_t* const count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((message_buffer != NULL) && (count != NULL) && (message_buffer->wait_object.type == WOT_MESSAGE_BUFFER))
+    {
+        /* Lock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(message_buffer->wait_object);
+
+        /* Copy current count */
+        (*count) = message_buffer->message_count;
+
+        /* Unlock message buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(message_buffer->wait_object);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_SetName(nano_os_message_buffer_t* const message_buffer, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (message_buffer != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, message_buffer);
+
+        /* Save the name */
+        message_buffer->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Send a message if there is enough free space (the message buffer must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_SendMessage(nano_os_message_buffer_t* const message_buffer,
+                                                          const void* const message, const size_t message_size)
+{
+    nano_os_error_t ret;
+    nano_os_task_t* const receiver = message_buffer->wait_object.waiting_tasks;
+
+    /* Receivers are only waiting when the ring buffer is empty */
+    if ((receiver != NULL) && (message_size <= receiver->message_size))
+    {
+        uint32_t woke_up_task_count = 0u;
+
+        /* Copy the message directly into the buffer of the receiver */
+        (void)MEMCPY(receiver->message_buffer, message, message_size);
+        receiver->message_size = message_size;
+
+        /* Wake up the receiver */
+        ret = NANO_OS_WAIT_OBJECT_Signal(&message_buffer->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+    }
+    else if ((message_buffer->sender_wait_object.waiting_tasks == NULL) &&
+             NANO_OS_MESSAGE_BUFFER_Fits(message_buffer, message_size))
+    {
+        /* Write the whole record, waiting senders have precedence to keep the messages ordered */
+        const nano_os_message_length_t length = NANO_OS_CAST(nano_os_message_length_t, message_size);
+        NANO_OS_MESSAGE_BUFFER_WriteBytes(message_buffer, &length, sizeof(nano_os_message_length_t));
+        NANO_OS_MESSAGE_BUFFER_WriteBytes(message_buffer, message, message_size);
+        message_buffer->message_count++;
+
+        /* Notify the receivers with a too small buffer */
+        ret = NANO_OS_MESSAGE_BUFFER_WakeUpReceivers(message_buffer);
+    }
+    else
+    {
+        ret = NOS_ERR_MESSAGE_BUFFER_FULL;
+    }
+
+    return ret;
+}
+
+
+/** \brief Receive the oldest message of the ring buffer if it fits in the receive buffer
+ *         (the message buffer must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_ReceiveMessage(nano_os_message_buffer_t* const message_buffer, void* const message,
+                                                             const size_t max_message_size, size_t* const message_size)
+{
+    nano_os_error_t ret;
+
+    /* Check the size of the message, it is left in the ring buffer if it doesn't fit */
+    (*message_size) = NANO_OS_MESSAGE_BUFFER_PeekSize(message_buffer);
+    if ((*message_size) <= max_message_size)
+    {
+        /* Skip the length prefix and read the message */
+        NANO_OS_MESSAGE_BUFFER_ReadBytes(message_buffer, NULL, sizeof(nano_os_message_length_t));
+        NANO_OS_MESSAGE_BUFFER_ReadBytes(message_buffer, message, (*message_size));
+        message_buffer->message_count--;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+    else
+    {
+        ret = NOS_ERR_MESSAGE_BUFFER_TOO_SMALL;
+    }
+
+    return ret;
+}
+
+
+/** \brief Give the messages of the ring buffer to the waiting receivers */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_WakeUpReceivers(nano_os_message_buffer_t* const message_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Every receiver is woken up, either with the oldest message or with the size of
+       the oldest message if its buffer is too small (the message then stays in the ring buffer) */
+    nano_os_task_t* task = message_buffer->wait_object.waiting_tasks;
+    while ((task != NULL) && (message_buffer->message_count != 0u) && (ret == NOS_ERR_SUCCESS))
+    {
+        uint32_t woke_up_task_count = 0u;
+        size_t message_size = 0u;
+
+        /* Copy the message into the buffer of the receiver */
+        const nano_os_error_t status = NANO_OS_MESSAGE_BUFFER_ReceiveMessage(message_buffer, task->message_buffer,
+                                                                             task->message_size, &message_size);
+        task->message_size = message_size;
+
+        /* Wake up the receiver */
+        ret = NANO_OS_WAIT_OBJECT_Signal(&message_buffer->wait_object, status, false, NULL, &woke_up_task_count);
+
+        /* Next receiver */
+        task = message_buffer->wait_object.waiting_tasks;
+    }
+
+    return ret;
+}
+
+
+/** \brief Write the messages of the waiting senders into the free space of the ring buffer */
+static nano_os_error_t NANO_OS_MESSAGE_BUFFER_WakeUpSenders(nano_os_message_buffer_t* const message_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* The senders are queued by priority, stop at the first message which doesn't fit
+       so that a large message isn't starved by smaller ones. The message buffer can't have
+       waiting receivers since the senders are only waiting when the ring buffer isn't empty */
+    nano_os_task_t* task = message_buffer->sender_wait_object.waiting_tasks;
+    while ((task != NULL) && NANO_OS_MESSAGE_BUFFER_Fits(message_buffer, task->message_size) && (ret == NOS_ERR_SUCCESS))
+    {
+        uint32_t woke_up_task_count = 0u;
+
+        /* Write the record of the sender */
+        const nano_os_message_length_t length = NANO_OS_CAST(nano_os_message_length_t, task->message_size);
+        NANO_OS_MESSAGE_BUFFER_WriteBytes(message_buffer, &length, sizeof(nano_os_message_length_t));
+        NANO_OS_MESSAGE_BUFFER_WriteBytes(message_buffer, task->message_buffer, task->message_size);
+        message_buffer->message_count++;
+
+        /* Wake up the sender */
+        ret = NANO_OS_WAIT_OBJECT_Signal(&message_buffer->sender_wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+
+        /* Next sender */
+        task = message_buffer->sender_wait_object.waiting_tasks;
+    }
+
+    return ret;
+}
+
+
+/** \brief Get the size of the oldest message of the ring buffer */
+static size_t NANO_OS_MESSAGE_BUFFER_PeekSize(const nano_os_message_buffer_t* const message_buffer)
+{
+    nano_os_message_length_t length = 0u;
+    uint8_t* const length_bytes = NANO_OS_CAST(uint8_t*, &length);
+    size_t index = message_buffer->head;
+    size_t i;
+
+    /* The length prefix may wrap around the end of the ring buffer */
+    for (i = 0u; i < sizeof(nano_os_message_length_t); i++)
+    {
+        length_bytes[i] = message_buffer->buffer[index];
+        index++;
+        if (index == message_buffer->buffer_size)
+        {
+            index = 0u;
+        }
+    }
+
+    return NANO_OS_CAST(size_t, length);
+}
+
+
+/** \brief Check if a message can be written entirely into the free space of the ring buffer */
+static bool NANO_OS_MESSAGE_BUFFER_Fits(const nano_os_message_buffer_t* const message_buffer, const size_t message_size)
+{
+    return (NANO_OS_MESSAGE_BUFFER_RECORD_SIZE(message_size) <= (message_buffer->buffer_size - message_buffer->used_size));
+}
+
+
+/** \brief Write bytes at the write end of the ring buffer */
+static void NANO_OS_MESSAGE_BUFFER_WriteBytes(nano_os_message_buffer_t* const message_buffer, const void* const data, const size_t size)
+{
+    const uint8_t* const src = NANO_OS_CAST(const uint8_t*, data);
+    size_t chunk_size = message_buffer->buffer_size - message_buffer->tail;
+
+    /* Copy in at most 2 chunks */
+    if (chunk_size > size)
+    {
+        chunk_size = size;
+    }
+    (void)MEMCPY(&message_buffer->buffer[message_buffer->tail], src, chunk_size);
+    if (chunk_size != size)
+    {
+        (void)MEMCPY(message_buffer->buffer, &src[chunk_size], size - chunk_size);
+        message_buffer->tail = size - chunk_size;
+    }
+    else
+    {
+        message_buffer->tail += size;
+        if (message_buffer->tail == message_buffer->buffer_size)
+        {
+            message_buffer->tail = 0u;
+        }
+    }
+    message_buffer->used_size += size;
+}
+
+
+/** \brief Read bytes from the read end of the ring buffer (the bytes are skipped if data is NULL) */
+static void NANO_OS_MESSAGE_BUFFER_ReadBytes(nano_os_message_buffer_t* const message_buffer, void* const data, const size_t size)
+{
+    uint8_t* const dest = NANO_OS_CAST(uint8_t*, data);
+    size_t chunk_size = message_buffer->buffer_size - message_buffer->head;
+
+    /* Copy in at most 2 chunks */
+    if (chunk_size > size)
+    {
+        chunk_size = size;
+    }
+    if (dest != NULL)
+    {
+        (void)MEMCPY(dest, &message_buffer->buffer[message_buffer->head], chunk_size);
+    }
+    if (chunk_size != size)
+    {
+        if (dest != NULL)
+        {
+            (void)MEMCPY(&dest[chunk_size], message_buffer->buffer, size - chunk_size);
+        }
+        message_buffer->head = size - chunk_size;
+    }
+    else
+    {
+        message_buffer->head += size;
+        if (message_buffer->head == message_buffer->buffer_size)
+        {
+            message_buffer->head = 0u;
+        }
+    }
+    message_buffer->used_size -= size;
+}
+
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
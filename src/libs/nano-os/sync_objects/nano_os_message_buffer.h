@@ -0,0 +1,122 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_MESSAGE_BUFFER_H
+#define NANO_OS_MESSAGE_BUFFER_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u)
+
+
+#include "nano_os_wait_object.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Length prefix of a message stored in a message buffer */
+typedef uint16_t nano_os_message_length_t;
+
+/** \brief Maximum size in bytes of a message */
+#define NANO_OS_MESSAGE_BUFFER_MAX_MESSAGE_SIZE             0xFFFFu
+
+/** \brief Macro to help to determine the size of a message stored in a message buffer (length prefix included) */
+#define NANO_OS_MESSAGE_BUFFER_RECORD_SIZE(message_size)    ((message_size) + sizeof(nano_os_message_length_t))
+
+/** \brief Macro to help to determine the buffer size needed to store message_count messages of message_size bytes */
+#define NANO_OS_MESSAGE_BUFFER_SIZE(message_size, message_count)    (NANO_OS_MESSAGE_BUFFER_RECORD_SIZE(message_size) * (message_count))
+
+
+/** \brief Nano OS message buffer
+ *         Stores variable length messages as length-prefixed records in a single ring buffer.
+ *         A record is always written entirely, a sender is blocked until there is enough free
+ *         space for the whole record.
+ */
+typedef struct _nano_os_message_buffer_t
+{
+    /** \brief Underlying wait object (receivers) */
+    nano_os_wait_object_t wait_object;
+    /** \brief Wait object for the tasks waiting for free space to send a message */
+    nano_os_wait_object_t sender_wait_object;
+
+    /** \brief Ring buffer */
+    uint8_t* buffer;
+    /** \brief Size in bytes of the ring buffer */
+    size_t buffer_size;
+    /** \brief Index of the first byte of the oldest record */
+    size_t head;
+    /** \brief Index of the first free byte */
+    size_t tail;
+    /** \brief Number of bytes used by the records */
+    size_t used_size;
+    /** \brief Number of messages in the ring buffer */
+    uint32_t message_count;
+} nano_os_message_buffer_t;
+
+
+
+
+/** \brief Create a new message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Create(nano_os_message_buffer_t* const message_buffer, void* const buffer,
+                                              const size_t buffer_size, const nano_os_queuing_type_t queuing_type);
+
+#if (NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Destroy(nano_os_message_buffer_t* const message_buffer);
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_DESTROY_ENABLED == 1u) */
+
+/** \brief Send a message, wait for enough free space if the message buffer is full */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Send(nano_os_message_buffer_t* const message_buffer, const void* const message,
+                                            const size_t message_size, const uint32_t tick_count);
+
+/** \brief Receive a message, wait for a message if the message buffer is empty */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_Receive(nano_os_message_buffer_t* const message_buffer, void* const message,
+                                               const size_t max_message_size, size_t* const message_size,
+                                               const uint32_t tick_count);
+
+/** \brief Get the size of the largest message which can be sent without waiting */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_GetFreeSize(nano_os_message_buffer_t* const message_buffer, size_t* const free_size);
+
+/** \brief Get the size of the next message to receive */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_GetNextSize(nano_os_message_buffer_t* const message_buffer, size_t* const message_size);
+
+/** \brief Get the number of messages in a message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_GetCount(nano_os_message_buffer_t* const message_buffer, uint32_t* const count);
+
+#if (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a message buffer */
+nano_os_error_t NANO_OS_MESSAGE_BUFFER_SetName(nano_os_message_buffer_t* const message_buffer, const char* const name);
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_SETNAME_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_MESSAGE_BUFFER_ENABLED == 1u) */
+
+#endif /* NANO_OS_MESSAGE_BUFFER_H */
@@ -28,6 +28,11 @@ along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
 #include "nano_os_tools.h"
 
 
+#if (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u)
+/** \brief Post the tokens coalesced from interrupt handlers to a semaphore */
+static nano_os_error_t NANO_OS_SEMAPHORE_IsrPost(void* const object, const uint32_t post_count, const uint32_t unused);
+#endif /* (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u) */
+
 
 
 /** \brief Create a new semaphore */
@@ -53,6 +58,9 @@ nano_os_error_t NANO_OS_SEMAPHORE_Create(nano_os_semaphore_t* const semaphore, c
             /* Initialize semaphore data */
             semaphore->count = initial_count;
             semaphore->max_count = max_count;
+            #if (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u)
+            ret = NANO_OS_INTERRUPT_InitCoalescedRequest(&semaphore->isr_post_request, NANO_OS_SEMAPHORE_IsrPost, semaphore);
+            #endif /* (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u) */
 
             /* Real time trace event */
             NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, semaphore);
@@ -82,8 +90,15 @@ nano_os_error_t NANO_OS_SEMAPHORE_Destroy(nano_os_semaphore_t* const semaphore)
         /* Real time trace event */
         NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, semaphore);
 
-        /* Destroy wait object */
-        ret = NANO_OS_WAIT_OBJECT_Destroy(&semaphore->wait_object);
+        #if (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u)
+        /* Drop the posts from interrupt handlers which are still pending */
+        ret = NANO_OS_INTERRUPT_CancelCoalescedRequest(&semaphore->isr_post_request);
+        if (ret == NOS_ERR_SUCCESS)
+        #endif /* (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u) */
+        {
+            /* Destroy wait object */
+            ret = NANO_OS_WAIT_OBJECT_Destroy(&semaphore->wait_object);
+        }
     }
 
     /* Syscall exit */
@@ -202,13 +217,8 @@ nano_os_error_t NANO_OS_SEMAPHORE_PostFromIsr(nano_os_semaphore_t* const semapho
         /* Check if operation can be done */
         if (WAIT_OBJECT_ISR_ISLOCKED(semaphore->wait_object))
         {
-            /* Fill interrupt service request */
-            nano_os_isr_service_request_t request;
-            request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_SEMAPHORE_Post);
-            request.object = semaphore;
-
-            /* Queue request */
-            ret = NANO_OS_INTERRUPT_QueueRequest(&request);
+            /* Queue request, consecutive posts are merged into a single request */
+            ret = NANO_OS_INTERRUPT_QueueCoalescedRequest(&semaphore->isr_post_request);
         }
         else
         {
@@ -220,6 +230,24 @@ nano_os_error_t NANO_OS_SEMAPHORE_PostFromIsr(nano_os_semaphore_t* const semapho
     return ret;
 }
 
+
+/** \brief Post the tokens coalesced from interrupt handlers to a semaphore */
+static nano_os_error_t NANO_OS_SEMAPHORE_IsrPost(void* const object, const uint32_t post_count, const uint32_t unused)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+    uint32_t i;
+    nano_os_semaphore_t* const semaphore = NANO_OS_CAST(nano_os_semaphore_t*, object);
+    NANO_OS_UNUSED(unused);
+
+    /* Post all the tokens */
+    for (i = 0u; (i < post_count) && (ret == NOS_ERR_SUCCESS); i++)
+    {
+        ret = NANO_OS_SEMAPHORE_Post(semaphore);
+    }
+
+    return ret;
+}
+
 #endif /* (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u) */
 
 
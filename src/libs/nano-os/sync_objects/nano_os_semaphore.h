@@ -46,6 +46,11 @@ typedef struct _nano_os_semaphore_t
     uint32_t count;
     /** \brief Max count */
     uint32_t max_count;
+
+    #if (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u)
+    /** \brief Coalescing request for the posts from interrupt handlers */
+    nano_os_isr_coalesced_request_t isr_post_request;
+    #endif /* (NANO_OS_SEMAPHORE_POSTFROMISR_ENABLED == 1u) */
 } nano_os_semaphore_t;
 
 
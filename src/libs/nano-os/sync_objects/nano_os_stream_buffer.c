@@ -0,0 +1,587 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano_os_stream_buffer.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+
+#include "nano_os_data.h"
+#include "nano_os_trace.h"
+#include "nano_os_syscall.h"
+#include "nano_os_tools.h"
+
+
+/** \brief Get the number of bytes available in a stream buffer */
+static size_t NANO_OS_STREAM_BUFFER_GetAvailable(const nano_os_stream_buffer_t* const stream_buffer);
+
+/** \brief Copy bytes into the ring of a stream buffer */
+static size_t NANO_OS_STREAM_BUFFER_WriteBytes(nano_os_stream_buffer_t* const stream_buffer, const uint8_t* const data, const size_t size);
+
+/** \brief Copy bytes out of the ring of a stream buffer */
+static size_t NANO_OS_STREAM_BUFFER_ReadBytes(nano_os_stream_buffer_t* const stream_buffer, uint8_t* const data, const size_t size);
+
+/** \brief Check if the consumer of a stream buffer must be woken up after a write */
+static bool NANO_OS_STREAM_BUFFER_IsWakeUpNeeded(nano_os_stream_buffer_t* const stream_buffer);
+
+/** \brief Wake up the consumer of a stream buffer if the level it is waiting for has been reached */
+static nano_os_error_t NANO_OS_STREAM_BUFFER_WakeUpConsumer(nano_os_stream_buffer_t* const stream_buffer);
+
+/** \brief Wait until a stream buffer contains at least the specified number of bytes
+           (the stream buffer must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_STREAM_BUFFER_WaitLevel(nano_os_stream_buffer_t* const stream_buffer, const size_t level,
+                                                       const uint32_t tick_count);
+
+
+
+
+/** \brief Create a new stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Create(nano_os_stream_buffer_t* const stream_buffer, void* const buffer,
+                                             const size_t buffer_size, const size_t trigger_level)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (buffer != NULL) && (buffer_size > 1u) &&
+        (trigger_level != 0u) && (trigger_level < buffer_size))
+    {
+        /* 0 init of stream buffer */
+        (void)MEMSET(stream_buffer, 0, sizeof(nano_os_stream_buffer_t));
+
+        /* Init underlying wait object, there is only one consumer */
+        ret = NANO_OS_WAIT_OBJECT_Initialize(&stream_buffer->wait_object, WOT_STREAM_BUFFER, QT_FIFO);
+        if (ret == NOS_ERR_SUCCESS)
+        {
+            /* Initialize stream buffer data */
+            stream_buffer->buffer = NANO_OS_CAST(uint8_t*, buffer);
+            stream_buffer->buffer_size = buffer_size;
+            stream_buffer->head = 0u;
+            stream_buffer->tail = 0u;
+            stream_buffer->trigger_level = trigger_level;
+            stream_buffer->wait_level = 0u;
+            stream_buffer->wakeup_requested = false;
+
+            /* Real time trace event */
+            NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_CREATE, stream_buffer);
+        }
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+#if (NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Destroy(nano_os_stream_buffer_t* const stream_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, stream_buffer);
+
+        /* Destroy wait object */
+        ret = NANO_OS_WAIT_OBJECT_Destroy(&stream_buffer->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u) */
+
+
+/** \brief Change the number of bytes needed to wake up the consumer of a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_SetTriggerLevel(nano_os_stream_buffer_t* const stream_buffer, const size_t trigger_level)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (stream_buffer->wait_object.type == WOT_STREAM_BUFFER) &&
+        (trigger_level != 0u) && (trigger_level < stream_buffer->buffer_size))
+    {
+        /* Only used by the consumer */
+        stream_buffer->trigger_level = trigger_level;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Write bytes into a stream buffer (producer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Write(nano_os_stream_buffer_t* const stream_buffer, const void* const data,
+                                            const size_t size, size_t* const written_size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (data != NULL) && (written_size != NULL) &&
+        (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_STREAM_BUFFER_WRITE, stream_buffer);
+
+        /* Write the bytes without system call */
+        (*written_size) = NANO_OS_STREAM_BUFFER_WriteBytes(stream_buffer, NANO_OS_CAST(const uint8_t*, data), size);
+        if (((*written_size) == 0u) && (size != 0u))
+        {
+            ret = NOS_ERR_STREAM_BUFFER_FULL;
+        }
+        else
+        {
+            ret = NOS_ERR_SUCCESS;
+        }
+
+        /* Wake up the consumer if needed, the consumer can't be in the
+           middle of a system call since the producer is a task */
+        if (NANO_OS_STREAM_BUFFER_IsWakeUpNeeded(stream_buffer))
+        {
+            const nano_os_error_t wakeup_ret = NANO_OS_STREAM_BUFFER_WakeUpConsumer(stream_buffer);
+            if (wakeup_ret != NOS_ERR_SUCCESS)
+            {
+                ret = wakeup_ret;
+            }
+        }
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u)
+
+/** \brief Write bytes into a stream buffer from an interrupt handler (producer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_WriteFromIsr(nano_os_stream_buffer_t* const stream_buffer, const void* const data,
+                                                   const size_t size, size_t* const written_size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (data != NULL) && (written_size != NULL) &&
+        (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_STREAM_BUFFER_WRITE_ISR, stream_buffer);
+
+        /* Write the bytes without system call */
+        (*written_size) = NANO_OS_STREAM_BUFFER_WriteBytes(stream_buffer, NANO_OS_CAST(const uint8_t*, data), size);
+        if (((*written_size) == 0u) && (size != 0u))
+        {
+            ret = NOS_ERR_STREAM_BUFFER_FULL;
+        }
+        else
+        {
+            ret = NOS_ERR_SUCCESS;
+        }
+
+        /* Only go through the kernel when the consumer must be woken up */
+        if (NANO_OS_STREAM_BUFFER_IsWakeUpNeeded(stream_buffer))
+        {
+            nano_os_error_t wakeup_ret;
+
+            /* Check if operation can be done */
+            if (WAIT_OBJECT_ISR_ISLOCKED(stream_buffer->wait_object))
+            {
+                /* Fill interrupt service request */
+                nano_os_isr_service_request_t request;
+                request.service_func = NANO_OS_CAST(fp_nano_os_isr_func_t, NANO_OS_STREAM_BUFFER_WakeUpConsumer);
+                request.object = stream_buffer;
+
+                /* Queue request */
+                wakeup_ret = NANO_OS_INTERRUPT_QueueRequest(&request);
+                if (wakeup_ret != NOS_ERR_SUCCESS)
+                {
+                    /* Allow a new wake up request on next write */
+                    stream_buffer->wakeup_requested = false;
+                }
+            }
+            else
+            {
+                /* No syscall in progress */
+                wakeup_ret = NANO_OS_STREAM_BUFFER_WakeUpConsumer(stream_buffer);
+            }
+            if (wakeup_ret != NOS_ERR_SUCCESS)
+            {
+                ret = wakeup_ret;
+            }
+        }
+    }
+
+    return ret;
+}
+
+#endif /* (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u) */
+
+
+/** \brief Read bytes from a stream buffer, wait until the trigger level is reached (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Read(nano_os_stream_buffer_t* const stream_buffer, void* const data,
+                                           const size_t size, size_t* const read_size, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (data != NULL) && (size != 0u) && (read_size != NULL) &&
+        (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        /* Don't wait for more bytes than requested */
+        const size_t level = ((size < stream_buffer->trigger_level) ? size : stream_buffer->trigger_level);
+
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_STREAM_BUFFER_READ, stream_buffer);
+
+        /* Lock stream buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(stream_buffer->wait_object);
+
+        /* Wait for the bytes */
+        (*read_size) = 0u;
+        ret = NANO_OS_STREAM_BUFFER_WaitLevel(stream_buffer, level, tick_count);
+        if ((ret == NOS_ERR_SUCCESS) || (ret == NOS_ERR_TIMEOUT))
+        {
+            /* On timeout, the bytes received so far are returned */
+            (*read_size) = NANO_OS_STREAM_BUFFER_ReadBytes(stream_buffer, NANO_OS_CAST(uint8_t*, data), size);
+            if ((*read_size) != 0u)
+            {
+                ret = NOS_ERR_SUCCESS;
+            }
+        }
+
+        /* Unlock stream buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(stream_buffer->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Wait until the trigger level of a stream buffer is reached (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Wait(nano_os_stream_buffer_t* const stream_buffer, const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_STREAM_BUFFER_WAIT, stream_buffer);
+
+        /* Lock stream buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_LOCK(stream_buffer->wait_object);
+
+        /* Wait for the bytes */
+        ret = NANO_OS_STREAM_BUFFER_WaitLevel(stream_buffer, stream_buffer->trigger_level, tick_count);
+
+        /* Unlock stream buffer against interrupt handler access */
+        WAIT_OBJECT_ISR_UNLOCK(stream_buffer->wait_object);
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Get the contiguous span of bytes available at the read end of a stream buffer (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_GetReadSpan(nano_os_stream_buffer_t* const stream_buffer, const void** const data,
+                                                  size_t* const size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (data != NULL) && (size != NULL) &&
+        (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        const size_t head = stream_buffer->head;
+        const size_t tail = stream_buffer->tail;
+
+        /* The span stops at the end of the ring, the rest
+           is available through the next span */
+        (*data) = &stream_buffer->buffer[tail];
+        if (head >= tail)
+        {
+            (*size) = head - tail;
+        }
+        else
+        {
+            (*size) = stream_buffer->buffer_size - tail;
+        }
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Consume bytes previously accessed through a read span of a stream buffer (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Consume(nano_os_stream_buffer_t* const stream_buffer, const size_t size)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (stream_buffer->wait_object.type == WOT_STREAM_BUFFER) &&
+        (size <= NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer)))
+    {
+        /* Release the bytes to the producer */
+        size_t tail = stream_buffer->tail + size;
+        if (tail >= stream_buffer->buffer_size)
+        {
+            tail -= stream_buffer->buffer_size;
+        }
+        stream_buffer->tail = tail;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+/** \brief Get the number of bytes available in a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_GetCount(nano_os_stream_buffer_t* const stream_buffer, size_t* const count)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Check parameters */
+    if ((stream_buffer != NULL) && (count != NULL) && (stream_buffer->wait_object.type == WOT_STREAM_BUFFER))
+    {
+        (*count) = NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer);
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    return ret;
+}
+
+
+#if (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_SetName(nano_os_stream_buffer_t* const stream_buffer, const char* const name)
+{
+    nano_os_error_t ret = NOS_ERR_INVALID_ARG;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(false);
+
+    /* Check parameters */
+    if (stream_buffer != NULL)
+    {
+        /* Real time trace event */
+        NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_NAMING, stream_buffer);
+
+        /* Save the name */
+        stream_buffer->wait_object.name = name;
+
+        ret = NOS_ERR_SUCCESS;
+    }
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+#endif /* (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u) */
+
+
+/** \brief Get the number of bytes available in a stream buffer */
+static size_t NANO_OS_STREAM_BUFFER_GetAvailable(const nano_os_stream_buffer_t* const stream_buffer)
+{
+    size_t available;
+    const size_t head = stream_buffer->head;
+    const size_t tail = stream_buffer->tail;
+
+    if (head >= tail)
+    {
+        available = head - tail;
+    }
+    else
+    {
+        available = (stream_buffer->buffer_size - tail) + head;
+    }
+
+    return available;
+}
+
+
+/** \brief Copy bytes into the ring of a stream buffer */
+static size_t NANO_OS_STREAM_BUFFER_WriteBytes(nano_os_stream_buffer_t* const stream_buffer, const uint8_t* const data, const size_t size)
+{
+    size_t count;
+    size_t head = stream_buffer->head;
+    const size_t free_size = (stream_buffer->buffer_size - 1u) - NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer);
+
+    /* Copy as many bytes as possible in at most 2 chunks */
+    count = ((size < free_size) ? size : free_size);
+    if (count != 0u)
+    {
+        const size_t size_before_end = stream_buffer->buffer_size - head;
+        if (count < size_before_end)
+        {
+            (void)MEMCPY(&stream_buffer->buffer[head], data, count);
+            head += count;
+        }
+        else
+        {
+            (void)MEMCPY(&stream_buffer->buffer[head], data, size_before_end);
+            (void)MEMCPY(stream_buffer->buffer, &data[size_before_end], count - size_before_end);
+            head = count - size_before_end;
+        }
+
+        /* Publish the bytes once they have been copied */
+        stream_buffer->head = head;
+    }
+
+    return count;
+}
+
+
+/** \brief Copy bytes out of the ring of a stream buffer */
+static size_t NANO_OS_STREAM_BUFFER_ReadBytes(nano_os_stream_buffer_t* const stream_buffer, uint8_t* const data, const size_t size)
+{
+    size_t count;
+    size_t tail = stream_buffer->tail;
+    const size_t available = NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer);
+
+    /* Copy as many bytes as possible in at most 2 chunks */
+    count = ((size < available) ? size : available);
+    if (count != 0u)
+    {
+        const size_t size_before_end = stream_buffer->buffer_size - tail;
+        if (count < size_before_end)
+        {
+            (void)MEMCPY(data, &stream_buffer->buffer[tail], count);
+            tail += count;
+        }
+        else
+        {
+            (void)MEMCPY(data, &stream_buffer->buffer[tail], size_before_end);
+            (void)MEMCPY(&data[size_before_end], stream_buffer->buffer, count - size_before_end);
+            tail = count - size_before_end;
+        }
+
+        /* Release the bytes once they have been copied */
+        stream_buffer->tail = tail;
+    }
+
+    return count;
+}
+
+
+/** \brief Check if the consumer of a stream buffer must be woken up after a write */
+static bool NANO_OS_STREAM_BUFFER_IsWakeUpNeeded(nano_os_stream_buffer_t* const stream_buffer)
+{
+    bool ret = false;
+    const size_t wait_level = stream_buffer->wait_level;
+
+    /* Only one wake up request at a time */
+    if ((wait_level != 0u) && !stream_buffer->wakeup_requested &&
+        (NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer) >= wait_level))
+    {
+        stream_buffer->wakeup_requested = true;
+        ret = true;
+    }
+
+    return ret;
+}
+
+
+/** \brief Wake up the consumer of a stream buffer if the level it is waiting for has been reached */
+static nano_os_error_t NANO_OS_STREAM_BUFFER_WakeUpConsumer(nano_os_stream_buffer_t* const stream_buffer)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Syscall entry */
+    NANO_OS_SYSCALL_Enter(true);
+
+    /* Lock stream buffer against interrupt handler access */
+    WAIT_OBJECT_ISR_LOCK(stream_buffer->wait_object);
+
+    /* The consumer may have stopped waiting since the request */
+    stream_buffer->wakeup_requested = false;
+    if ((stream_buffer->wait_level != 0u) &&
+        (NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer) >= stream_buffer->wait_level))
+    {
+        uint32_t woke_up_task_count = 0u;
+        stream_buffer->wait_level = 0u;
+        ret = NANO_OS_WAIT_OBJECT_Signal(&stream_buffer->wait_object, NOS_ERR_SUCCESS, false, NULL, &woke_up_task_count);
+    }
+
+    /* Unlock stream buffer against interrupt handler access */
+    WAIT_OBJECT_ISR_UNLOCK(stream_buffer->wait_object);
+
+    /* Syscall exit */
+    NANO_OS_SYSCALL_Exit();
+
+    return ret;
+}
+
+
+/** \brief Wait until a stream buffer contains at least the specified number of bytes
+           (the stream buffer must be locked against interrupt handler access) */
+static nano_os_error_t NANO_OS_STREAM_BUFFER_WaitLevel(nano_os_stream_buffer_t* const stream_buffer, const size_t level,
+                                                       const uint32_t tick_count)
+{
+    nano_os_error_t ret = NOS_ERR_SUCCESS;
+
+    /* Check if enough bytes are available */
+    if (NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer) < level)
+    {
+        /* Publish the level then check again since the producer
+           can write bytes at any time without system call */
+        stream_buffer->wait_level = level;
+        if (NANO_OS_STREAM_BUFFER_GetAvailable(stream_buffer) < level)
+        {
+            /* Wait for the bytes */
+            ret = NANO_OS_WAIT_OBJECT_Wait(&stream_buffer->wait_object, tick_count);
+        }
+        stream_buffer->wait_level = 0u;
+    }
+
+    return ret;
+}
+
+
+#endif /* (NANO_OS_STREAM_BUFFER_ENABLED == 1u) */
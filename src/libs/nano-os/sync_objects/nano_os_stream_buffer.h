@@ -0,0 +1,129 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_STREAM_BUFFER_H
+#define NANO_OS_STREAM_BUFFER_H
+
+#include "nano_os_types.h"
+
+/* Check if module is enabled */
+#if (NANO_OS_STREAM_BUFFER_ENABLED == 1u)
+
+
+#include "nano_os_wait_object.h"
+#include "nano_os_interrupt.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Macro to help to determine the buffer size needed for a stream buffer */
+#define NANO_OS_STREAM_BUFFER_SIZE(max_byte_count)      ((max_byte_count) + 1u)
+
+
+
+/** \brief Nano OS stream buffer
+ *         Single producer / single consumer byte ring. The producer (typically an
+ *         interrupt handler) writes without any system call, only the wake up of
+ *         the consumer when the trigger level is reached goes through the kernel.
+ */
+typedef struct _nano_os_stream_buffer_t
+{
+    /** \brief Underlying wait object */
+    nano_os_wait_object_t wait_object;
+
+    /** \brief Byte buffer */
+    uint8_t* buffer;
+    /** \brief Size of the byte buffer (one byte is always kept free) */
+    size_t buffer_size;
+    /** \brief Write index (only modified by the producer) */
+    volatile size_t head;
+    /** \brief Read index (only modified by the consumer) */
+    volatile size_t tail;
+    /** \brief Number of bytes needed to wake up the consumer */
+    size_t trigger_level;
+    /** \brief Number of bytes the consumer is waiting for (0 if the consumer is not waiting) */
+    volatile size_t wait_level;
+    /** \brief Indicate if a wake up of the consumer has been requested by the producer */
+    volatile bool wakeup_requested;
+} nano_os_stream_buffer_t;
+
+
+
+
+/** \brief Create a new stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Create(nano_os_stream_buffer_t* const stream_buffer, void* const buffer,
+                                             const size_t buffer_size, const size_t trigger_level);
+
+#if (NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u)
+
+/** \brief Destroy a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Destroy(nano_os_stream_buffer_t* const stream_buffer);
+
+#endif /* (NANO_OS_STREAM_BUFFER_DESTROY_ENABLED == 1u) */
+
+/** \brief Change the number of bytes needed to wake up the consumer of a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_SetTriggerLevel(nano_os_stream_buffer_t* const stream_buffer, const size_t trigger_level);
+
+/** \brief Write bytes into a stream buffer (producer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Write(nano_os_stream_buffer_t* const stream_buffer, const void* const data,
+                                            const size_t size, size_t* const written_size);
+
+#if (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u)
+
+/** \brief Write bytes into a stream buffer from an interrupt handler (producer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_WriteFromIsr(nano_os_stream_buffer_t* const stream_buffer, const void* const data,
+                                                   const size_t size, size_t* const written_size);
+
+#endif /* (NANO_OS_STREAM_BUFFER_WRITEFROMISR_ENABLED == 1u) */
+
+/** \brief Read bytes from a stream buffer, wait until the trigger level is reached (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Read(nano_os_stream_buffer_t* const stream_buffer, void* const data,
+                                           const size_t size, size_t* const read_size, const uint32_t tick_count);
+
+/** \brief Wait until the trigger level of a stream buffer is reached (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Wait(nano_os_stream_buffer_t* const stream_buffer, const uint32_t tick_count);
+
+/** \brief Get the contiguous span of bytes available at the read end of a stream buffer (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_GetReadSpan(nano_os_stream_buffer_t* const stream_buffer, const void** const data,
+                                                  size_t* const size);
+
+/** \brief Consume bytes previously accessed through a read span of a stream buffer (consumer side) */
+nano_os_error_t NANO_OS_STREAM_BUFFER_Consume(nano_os_stream_buffer_t* const stream_buffer, const size_t size);
+
+/** \brief Get the number of bytes available in a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_GetCount(nano_os_stream_buffer_t* const stream_buffer, size_t* const count);
+
+#if (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u)
+
+/** \brief Associate a name to a stream buffer */
+nano_os_error_t NANO_OS_STREAM_BUFFER_SetName(nano_os_stream_buffer_t* const stream_buffer, const char* const name);
+
+#endif /* (NANO_OS_STREAM_BUFFER_SETNAME_ENABLED == 1u) */
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (NANO_OS_STREAM_BUFFER_ENABLED == 1u) */
+
+#endif /* NANO_OS_STREAM_BUFFER_H */
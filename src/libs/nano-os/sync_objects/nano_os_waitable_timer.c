@@ -49,7 +49,7 @@ nano_os_error_t NANO_OS_WAITABLE_TIMER_Create(nano_os_waitable_timer_t* const ti
         (void)MEMSET(timer, 0, sizeof(nano_os_waitable_timer_t));
 
         /* Init underlying timer */
-        ret = NANO_OS_TIMER_Create(&timer->timer, NANO_OS_WAITABLE_TIMER_Callback, timer);
+        ret = NANO_OS_TIMER_Create(&timer->timer, NANO_OS_WAITABLE_TIMER_Callback, timer, NULL);
         if (ret == NOS_ERR_SUCCESS)
         {
             /* Init underlying wait object */
@@ -82,18 +82,11 @@ nano_os_error_t NANO_OS_WAITABLE_TIMER_Destroy(nano_os_waitable_timer_t* const t
     /* Check parameters */
     if ((timer != NULL) && (timer->wait_object.type == WOT_TIMER))
     {
-        nano_os_timer_t* current;
-
         /* Real time trace event */
         NANO_OS_TRACE_OBJ(NOS_TRACE_OBJ_DESTROY, timer);
 
         /* Check if the timer is already started */
-        current = g_nano_os.started_timers;
-        while ((current != NULL) && (current != &timer->timer))
-        {
-            current = current->next;
-        }
-        if (current == NULL)
+        if (!NANO_OS_TIMER_IS_STARTED(&timer->timer))
         {
             /* Destroy wait object */
             ret = NANO_OS_WAIT_OBJECT_Destroy(&timer->wait_object);
@@ -179,18 +172,11 @@ nano_os_error_t NANO_OS_WAITABLE_TIMER_Wait(nano_os_waitable_timer_t* const time
     /* Check parameters */
     if ((timer != NULL) && (timer->wait_object.type == WOT_TIMER))
     {
-        nano_os_timer_t* current;
-
         /* Real time trace event */
         NANO_OS_TRACE_OBJ(NOS_TRACE_WAITABLE_TIMER_WAIT, timer);
 
         /* Check if the timer is already started */
-        current = g_nano_os.started_timers;
-        while ((current != NULL) && (current != &timer->timer))
-        {
-            current = current->next;
-        }
-        if (current != NULL)
+        if (NANO_OS_TIMER_IS_STARTED(&timer->timer))
         {
             /* Check if the timer has elapsed */
             if (timer->timer.has_elapsed)
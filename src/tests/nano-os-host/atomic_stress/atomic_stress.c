@@ -0,0 +1,446 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Contention stress test of the port atomic operations and of the lock-free interrupt
+    service request queue. Each host thread plays the role of an interrupt handler which
+    can be interrupted at any instruction by the others, the interrupt service task runs
+    in its own thread and checks that no request is lost, duplicated or reordered.
+*/
+
+#include "nano_os_data.h"
+#include "nano_os_port.h"
+#include "nano_os_interrupt.h"
+#include "nano_os_scheduler.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/** \brief Number of threads hammering the atomic operations */
+#define ATOMIC_STRESS_THREAD_COUNT          8u
+
+/** \brief Number of iterations of each thread */
+#define ATOMIC_STRESS_ITERATION_COUNT       200000u
+
+/** \brief Number of nodes pushed by each thread on the lock-free stack */
+#define ATOMIC_STRESS_NODE_COUNT            20000u
+
+/** \brief Number of simulated interrupt handlers */
+#define ISR_STRESS_PRODUCER_COUNT           4u
+
+/** \brief Number of requests queued by each simulated interrupt handler */
+#define ISR_STRESS_REQUEST_COUNT            100000u
+
+/** \brief Number of coalescing requests shared by the simulated interrupt handlers */
+#define ISR_STRESS_COALESCED_COUNT          3u
+
+
+/** \brief Lock-free stack node */
+typedef struct _stress_node_t
+{
+    /** \brief Next node */
+    struct _stress_node_t* next;
+} stress_node_t;
+
+
+/** \brief Check a test condition */
+#define STRESS_CHECK(cond)  if (!(cond)) { (void)printf("FAILED : %s (line %d)\n", #cond, __LINE__); exit(1); }
+
+
+/** \brief Atomic operations stress thread */
+static void* AtomicStressThread(void* const param);
+
+/** \brief Simulated interrupt handler thread */
+static void* IsrStressProducerThread(void* const param);
+
+/** \brief Interrupt service task thread */
+static void* IsrStressServiceThread(void* const param);
+
+/** \brief Service function of the interrupt service requests */
+static nano_os_error_t IsrStressRequestFunc(void* const object, const uint32_t param1, const uint32_t param2);
+
+/** \brief Service function of the coalescing interrupt service requests */
+static nano_os_error_t IsrStressCoalescedFunc(void* const object, const uint32_t param1, const uint32_t param2);
+
+/** \brief Run the atomic operations stress test */
+static void AtomicStressTest(void);
+
+/** \brief Run the interrupt service request queue stress test */
+static void IsrStressTest(void);
+
+
+/** \brief Nano OS internal data */
+nano_os_t g_nano_os;
+
+
+/** \brief Counter incremented with NANO_OS_PORT_ATOMIC_INC32 */
+static uint32_t s_inc_counter;
+
+/** \brief Counter decremented with NANO_OS_PORT_ATOMIC_DEC32 */
+static uint32_t s_dec_counter;
+
+/** \brief Counter incremented with a compare and swap loop */
+static volatile uint32_t s_cas_counter;
+
+/** \brief Ticket counter incremented with exchanges */
+static volatile uint32_t s_exchange_ticket;
+
+/** \brief Sum of the tickets got by the exchanges */
+static volatile uint32_t s_exchange_sum;
+
+/** \brief Bits set with NANO_OS_PORT_AtomicFetchOr32 */
+static volatile uint32_t s_or_bits;
+
+/** \brief Lock-free stack head */
+static stress_node_t* volatile s_stack_head;
+
+/** \brief Lock-free stack nodes */
+static stress_node_t s_nodes[ATOMIC_STRESS_THREAD_COUNT][ATOMIC_STRESS_NODE_COUNT];
+
+
+/** \brief Interrupt service task function registered by the interrupt module */
+static fp_nano_os_task_func_t s_service_task_func;
+
+/** \brief Interrupt service task thread */
+static pthread_t s_service_thread;
+
+/** \brief Indicate that the interrupt service task must stop once the queue is empty */
+static volatile uint32_t s_service_stop;
+
+/** \brief Next expected sequence number of each simulated interrupt handler */
+static uint32_t s_next_sequence[ISR_STRESS_PRODUCER_COUNT];
+
+/** \brief Number of times each simulated interrupt handler found the queue full */
+static volatile uint32_t s_list_full_count;
+
+/** \brief Coalescing interrupt service requests */
+static nano_os_isr_coalesced_request_t s_coalesced_requests[ISR_STRESS_COALESCED_COUNT];
+
+/** \brief Number of occurrences handled for each coalescing interrupt service request */
+static uint32_t s_coalesced_occurrences[ISR_STRESS_COALESCED_COUNT];
+
+/** \brief Number of calls to the service function of each coalescing interrupt service request */
+static uint32_t s_coalesced_calls[ISR_STRESS_COALESCED_COUNT];
+
+
+
+/** \brief Entry point */
+int main(void)
+{
+    AtomicStressTest();
+    IsrStressTest();
+
+    (void)printf("atomic_stress : OK\n");
+    return 0;
+}
+
+
+/** \brief Task creation stub : the interrupt service task is run by a host thread */
+nano_os_error_t NANO_OS_TASK_Create(nano_os_task_t* const task, const nano_os_task_init_data_t* const task_init_data)
+{
+    NANO_OS_UNUSED(task);
+    s_service_task_func = task_init_data->task_func;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object initialization stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Initialize(nano_os_wait_object_t* const wait_object, const nano_os_wait_object_type_t type,
+                                               const nano_os_queuing_type_t queuing_type)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(type);
+    NANO_OS_UNUSED(queuing_type);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object wait stub : the interrupt service task polls the queue until it is asked to stop */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Wait(nano_os_wait_object_t* const wait_object, const uint32_t timeout)
+{
+    nano_os_error_t ret = NOS_ERR_TIMEOUT;
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(timeout);
+    if (NANO_OS_PORT_AtomicLoad32(&s_service_stop) != 0u)
+    {
+        ret = NOS_ERR_OBJECT_DESTROYED;
+    }
+    else
+    {
+        /* Give the simulated interrupt handlers a chance to run on single core hosts */
+        (void)sched_yield();
+    }
+    return ret;
+}
+
+/** \brief Wait object signal stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Signal(nano_os_wait_object_t* const wait_object, const nano_os_error_t wait_status,
+                                           const bool signal_all_tasks, const fp_nano_os_wait_object_wakeup_cond_func_t wakeup_cond_func,
+                                           uint32_t* const woke_up_task_count)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(wait_status);
+    NANO_OS_UNUSED(signal_all_tasks);
+    NANO_OS_UNUSED(wakeup_cond_func);
+    (*woke_up_task_count) = 0u;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Scheduler stub */
+void NANO_OS_SCHEDULER_Schedule(const bool from_isr)
+{
+    NANO_OS_UNUSED(from_isr);
+}
+
+/** \brief Error handler stub : the stop request of the interrupt service task ends its thread, any other error fails the test */
+void NANO_OS_ERROR_Handler(const nano_os_error_t error)
+{
+    if ((error == NOS_ERR_OBJECT_DESTROYED) && pthread_equal(pthread_self(), s_service_thread))
+    {
+        pthread_exit(NULL);
+    }
+    (void)printf("FAILED : error %d\n", NANO_OS_CAST(int, error));
+    exit(1);
+}
+
+
+
+/** \brief Run the atomic operations stress test */
+static void AtomicStressTest(void)
+{
+    uint32_t i;
+    uint32_t node_count;
+    pthread_t threads[ATOMIC_STRESS_THREAD_COUNT];
+    const uint32_t total = ATOMIC_STRESS_THREAD_COUNT * ATOMIC_STRESS_ITERATION_COUNT;
+
+    s_inc_counter = 0u;
+    s_dec_counter = total;
+    s_cas_counter = 0u;
+    s_exchange_ticket = 0u;
+    s_exchange_sum = 0u;
+    s_or_bits = 0u;
+    s_stack_head = NULL;
+
+    for (i = 0u; i < ATOMIC_STRESS_THREAD_COUNT; i++)
+    {
+        STRESS_CHECK(pthread_create(&threads[i], NULL, AtomicStressThread, NANO_OS_CAST(void*, NANO_OS_CAST(uintptr_t, i))) == 0);
+    }
+    for (i = 0u; i < ATOMIC_STRESS_THREAD_COUNT; i++)
+    {
+        STRESS_CHECK(pthread_join(threads[i], NULL) == 0);
+    }
+
+    /* Every update must have been applied exactly once */
+    STRESS_CHECK(NANO_OS_PORT_ATOMIC_READ32(s_inc_counter) == total);
+    STRESS_CHECK(NANO_OS_PORT_ATOMIC_READ32(s_dec_counter) == 0u);
+    STRESS_CHECK(s_cas_counter == total);
+    STRESS_CHECK(s_or_bits == ((1u << ATOMIC_STRESS_THREAD_COUNT) - 1u));
+
+    /* The exchanges hand out each ticket exactly once, the last one is still in the ticket counter */
+    STRESS_CHECK((s_exchange_sum + s_exchange_ticket) == NANO_OS_CAST(uint32_t, (NANO_OS_CAST(uint64_t, total) * (total + 1u)) / 2u));
+
+    /* All the nodes must be on the stack */
+    node_count = 0u;
+    while (s_stack_head != NULL)
+    {
+        s_stack_head = s_stack_head->next;
+        node_count++;
+    }
+    STRESS_CHECK(node_count == (ATOMIC_STRESS_THREAD_COUNT * ATOMIC_STRESS_NODE_COUNT));
+
+    (void)printf("atomic operations : %u threads x %u iterations OK\n", ATOMIC_STRESS_THREAD_COUNT, ATOMIC_STRESS_ITERATION_COUNT);
+}
+
+/** \brief Atomic operations stress thread */
+static void* AtomicStressThread(void* const param)
+{
+    uint32_t i;
+    const uint32_t thread_index = NANO_OS_CAST(uint32_t, NANO_OS_CAST(uintptr_t, param));
+
+    for (i = 0u; i < ATOMIC_STRESS_ITERATION_COUNT; i++)
+    {
+        uint32_t value;
+        uint32_t ticket;
+
+        /* Port macros used by the kernel */
+        NANO_OS_PORT_ATOMIC_INC32(s_inc_counter);
+        NANO_OS_PORT_ATOMIC_DEC32(s_dec_counter);
+
+        /* Compare and swap loop */
+        do
+        {
+            value = NANO_OS_PORT_AtomicLoad32(&s_cas_counter);
+        }
+        while (!NANO_OS_PORT_ATOMIC_CAS32(s_cas_counter, value, value + 1u));
+
+        /* Ticket hand over : each exchange gets back the ticket stored by the previous one */
+        ticket = NANO_OS_PORT_AtomicExchange32(&s_exchange_ticket, (thread_index * ATOMIC_STRESS_ITERATION_COUNT) + i + 1u);
+        (void)NANO_OS_PORT_AtomicFetchAdd32(&s_exchange_sum, ticket);
+    }
+
+    (void)NANO_OS_PORT_AtomicFetchOr32(&s_or_bits, (1u << thread_index));
+
+    /* Lock-free stack push */
+    for (i = 0u; i < ATOMIC_STRESS_NODE_COUNT; i++)
+    {
+        stress_node_t* head;
+        stress_node_t* const node = &s_nodes[thread_index][i];
+
+        do
+        {
+            head = NANO_OS_CAST(stress_node_t*, NANO_OS_PORT_AtomicLoadPtr(NANO_OS_CAST(void* volatile*, &s_stack_head)));
+            node->next = head;
+        }
+        while (!NANO_OS_PORT_AtomicCasPtr(NANO_OS_CAST(void* volatile*, &s_stack_head), head, node));
+    }
+
+    return NULL;
+}
+
+
+/** \brief Run the interrupt service request queue stress test */
+static void IsrStressTest(void)
+{
+    uint32_t i;
+    uint32_t total_calls;
+    uint32_t total_occurrences;
+    nano_os_isr_request_stats_t stats;
+    pthread_t threads[ISR_STRESS_PRODUCER_COUNT];
+
+    /* Initialize the interrupt module, it registers its service task */
+    STRESS_CHECK(NANO_OS_INTERRUPT_Init(NULL) == NOS_ERR_SUCCESS);
+    STRESS_CHECK(s_service_task_func != NULL);
+    for (i = 0u; i < ISR_STRESS_COALESCED_COUNT; i++)
+    {
+        STRESS_CHECK(NANO_OS_INTERRUPT_InitCoalescedRequest(&s_coalesced_requests[i], IsrStressCoalescedFunc,
+                                                            NANO_OS_CAST(void*, NANO_OS_CAST(uintptr_t, i))) == NOS_ERR_SUCCESS);
+    }
+
+    /* Start the interrupt service task and the simulated interrupt handlers */
+    STRESS_CHECK(pthread_create(&s_service_thread, NULL, IsrStressServiceThread, NULL) == 0);
+    for (i = 0u; i < ISR_STRESS_PRODUCER_COUNT; i++)
+    {
+        STRESS_CHECK(pthread_create(&threads[i], NULL, IsrStressProducerThread, NANO_OS_CAST(void*, NANO_OS_CAST(uintptr_t, i))) == 0);
+    }
+    for (i = 0u; i < ISR_STRESS_PRODUCER_COUNT; i++)
+    {
+        STRESS_CHECK(pthread_join(threads[i], NULL) == 0);
+    }
+
+    /* Let the interrupt service task empty the queue and stop */
+    NANO_OS_PORT_AtomicStore32(&s_service_stop, 1u);
+    STRESS_CHECK(pthread_join(s_service_thread, NULL) == 0);
+
+    /* Every request must have been handled exactly once and in order */
+    for (i = 0u; i < ISR_STRESS_PRODUCER_COUNT; i++)
+    {
+        STRESS_CHECK(s_next_sequence[i] == ISR_STRESS_REQUEST_COUNT);
+    }
+
+    /* Every occurrence of the coalescing requests must have been handled exactly once */
+    total_calls = 0u;
+    total_occurrences = 0u;
+    for (i = 0u; i < ISR_STRESS_COALESCED_COUNT; i++)
+    {
+        STRESS_CHECK(s_coalesced_requests[i].count == 0u);
+        total_calls += s_coalesced_calls[i];
+        total_occurrences += s_coalesced_occurrences[i];
+    }
+    STRESS_CHECK(total_occurrences == (ISR_STRESS_PRODUCER_COUNT * ISR_STRESS_REQUEST_COUNT));
+    STRESS_CHECK(g_nano_os.isr_coalesced_requests == NULL);
+
+    /* Statistics must match */
+    STRESS_CHECK(NANO_OS_INTERRUPT_GetRequestStats(&stats) == NOS_ERR_SUCCESS);
+    STRESS_CHECK(stats.overflow_count == s_list_full_count);
+    STRESS_CHECK(stats.coalesced_count == (total_occurrences - total_calls));
+    STRESS_CHECK((stats.max_used_count > 0u) && (stats.max_used_count <= NANO_OS_MAX_ISR_REQUEST_COUNT));
+
+    (void)printf("interrupt service requests : %u handlers x %u requests OK (queue full %u times, %u coalesced occurrences in %u calls)\n",
+                 ISR_STRESS_PRODUCER_COUNT, ISR_STRESS_REQUEST_COUNT, stats.overflow_count, total_occurrences, total_calls);
+}
+
+/** \brief Simulated interrupt handler thread */
+static void* IsrStressProducerThread(void* const param)
+{
+    uint32_t i;
+    const uint32_t producer_index = NANO_OS_CAST(uint32_t, NANO_OS_CAST(uintptr_t, param));
+
+    for (i = 0u; i < ISR_STRESS_REQUEST_COUNT; i++)
+    {
+        nano_os_error_t ret;
+        nano_os_isr_service_request_t request;
+
+        /* Queue a request, retry until the interrupt service task makes room in the queue */
+        request.service_func = IsrStressRequestFunc;
+        request.object = NULL;
+        request.param1 = producer_index;
+        request.param2 = i;
+        do
+        {
+            ret = NANO_OS_INTERRUPT_QueueRequest(&request);
+            if (ret == NOS_ERR_ISR_REQUEST_LIST_FULL)
+            {
+                (void)NANO_OS_PORT_AtomicFetchAdd32(&s_list_full_count, 1u);
+                (void)sched_yield();
+            }
+        }
+        while (ret == NOS_ERR_ISR_REQUEST_LIST_FULL);
+        STRESS_CHECK(ret == NOS_ERR_SUCCESS);
+
+        /* Queue an occurrence of a shared coalescing request */
+        STRESS_CHECK(NANO_OS_INTERRUPT_QueueCoalescedRequest(&s_coalesced_requests[(producer_index + i) % ISR_STRESS_COALESCED_COUNT]) == NOS_ERR_SUCCESS);
+    }
+
+    return NULL;
+}
+
+/** \brief Interrupt service task thread */
+static void* IsrStressServiceThread(void* const param)
+{
+    return s_service_task_func(param);
+}
+
+/** \brief Service function of the interrupt service requests */
+static nano_os_error_t IsrStressRequestFunc(void* const object, const uint32_t param1, const uint32_t param2)
+{
+    NANO_OS_UNUSED(object);
+
+    /* Requests of a same interrupt handler must be handled in the order they were queued */
+    STRESS_CHECK(param1 < ISR_STRESS_PRODUCER_COUNT);
+    STRESS_CHECK(param2 == s_next_sequence[param1]);
+    s_next_sequence[param1]++;
+
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Service function of the coalescing interrupt service requests */
+static nano_os_error_t IsrStressCoalescedFunc(void* const object, const uint32_t param1, const uint32_t param2)
+{
+    const uint32_t request_index = NANO_OS_CAST(uint32_t, NANO_OS_CAST(uintptr_t, object));
+
+    /* A coalesced request is only pushed with at least one pending occurrence */
+    STRESS_CHECK(request_index < ISR_STRESS_COALESCED_COUNT);
+    STRESS_CHECK(param1 != 0u);
+    STRESS_CHECK(param2 == 0u);
+    s_coalesced_occurrences[request_index] += param1;
+    s_coalesced_calls[request_index]++;
+
+    return NOS_ERR_SUCCESS;
+}
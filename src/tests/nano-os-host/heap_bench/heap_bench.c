@@ -0,0 +1,343 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Allocation and de-allocation latency benchmark of the heap module, built once with
+    the first-fit allocator and once with the TLSF allocator (NANO_OS_HEAP_TLSF_ENABLED).
+    The first scenario is a random allocation / de-allocation pattern, the second one
+    measures the worst case of the first-fit allocator : a large allocation on a heap
+    fragmented by many small free blocks which can't be merged.
+*/
+
+#include "nano_os_data.h"
+#include "nano_os_heap.h"
+#include "nano_os_mutex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/** \brief Size of the heap area in bytes */
+#define HEAP_BENCH_HEAP_SIZE                (256u * 1024u)
+
+/** \brief Number of simultaneously allocated blocks in the random scenario */
+#define HEAP_BENCH_BLOCK_COUNT              2000u
+
+/** \brief Number of operations of the random scenario */
+#define HEAP_BENCH_OPERATION_COUNT          200000u
+
+/** \brief Size of the small blocks fragmenting the heap */
+#define HEAP_BENCH_SMALL_BLOCK_SIZE         16u
+
+/** \brief Maximum number of small blocks fragmenting the heap */
+#define HEAP_BENCH_SMALL_BLOCK_COUNT        (HEAP_BENCH_HEAP_SIZE / 32u)
+
+/** \brief Size of the large blocks allocated on the fragmented heap */
+#define HEAP_BENCH_LARGE_BLOCK_SIZE         1024u
+
+/** \brief Number of large allocations on the fragmented heap */
+#define HEAP_BENCH_LARGE_ALLOC_COUNT        32u
+
+/** \brief Number of times the fragmented heap scenario is run */
+#define HEAP_BENCH_FRAGMENTED_ROUND_COUNT   50u
+
+/** \brief Name of the allocator under test */
+#if (NANO_OS_HEAP_TLSF_ENABLED == 1u)
+#define HEAP_BENCH_ALLOCATOR_NAME           "tlsf"
+#else
+#define HEAP_BENCH_ALLOCATOR_NAME           "first-fit"
+#endif /* (NANO_OS_HEAP_TLSF_ENABLED == 1u) */
+
+
+/** \brief Measurement of an operation */
+typedef struct _bench_measure_t
+{
+    /** \brief Durations of each operation in ns */
+    uint32_t durations[HEAP_BENCH_OPERATION_COUNT];
+    /** \brief Number of operations */
+    uint32_t count;
+} bench_measure_t;
+
+
+/** \brief Random allocation / de-allocation scenario */
+static void HeapRandomBench(void);
+
+/** \brief Large allocations on a fragmented heap scenario */
+static void HeapFragmentedBench(void);
+
+/** \brief Get a monotonic timestamp in ns */
+static uint64_t BenchGetTimestamp(void);
+
+/** \brief Add a duration to a measurement */
+static void BenchAddMeasure(bench_measure_t* const measure, const uint64_t start_time);
+
+/** \brief Print the average, the 99.99th percentile and the maximum of a measurement */
+static void BenchPrintResults(const char* const name, bench_measure_t* const measure);
+
+/** \brief Compare 2 durations for qsort */
+static int BenchCompare(const void* const a, const void* const b);
+
+
+/** \brief Nano OS internal data */
+nano_os_t g_nano_os;
+
+
+/** \brief Heap area */
+static uint64_t s_heap_area[HEAP_BENCH_HEAP_SIZE / sizeof(uint64_t)];
+
+/** \brief Allocated blocks */
+static uint8_t* s_blocks[HEAP_BENCH_SMALL_BLOCK_COUNT];
+
+/** \brief Size of the allocated blocks */
+static size_t s_block_sizes[HEAP_BENCH_BLOCK_COUNT];
+
+/** \brief Allocation measurement */
+static bench_measure_t s_alloc_measure;
+
+/** \brief De-allocation measurement */
+static bench_measure_t s_free_measure;
+
+
+
+/** \brief Entry point */
+int main(void)
+{
+    (void)printf("Heap allocator : %s, %u bytes heap\n", HEAP_BENCH_ALLOCATOR_NAME, HEAP_BENCH_HEAP_SIZE);
+    (void)printf("Durations in ns : average / 99.99th percentile / maximum\n");
+
+    HeapRandomBench();
+    HeapFragmentedBench();
+
+    return 0;
+}
+
+
+/** \brief Mutex creation stub : the benchmark runs in a single thread */
+nano_os_error_t NANO_OS_MUTEX_Create(nano_os_mutex_t* const mutex, const nano_os_queuing_type_t queuing_type)
+{
+    NANO_OS_UNUSED(mutex);
+    NANO_OS_UNUSED(queuing_type);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Mutex lock stub */
+nano_os_error_t NANO_OS_MUTEX_Lock(nano_os_mutex_t* const mutex, const uint32_t timeout)
+{
+    NANO_OS_UNUSED(mutex);
+    NANO_OS_UNUSED(timeout);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Mutex unlock stub */
+nano_os_error_t NANO_OS_MUTEX_Unlock(nano_os_mutex_t* const mutex)
+{
+    NANO_OS_UNUSED(mutex);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Error handler stub */
+void NANO_OS_ERROR_Handler(const nano_os_error_t error)
+{
+    (void)printf("FAILED : error %d\n", NANO_OS_CAST(int, error));
+    exit(1);
+}
+
+
+
+/** \brief Random allocation / de-allocation scenario */
+static void HeapRandomBench(void)
+{
+    uint32_t i;
+    uint32_t failed_count = 0u;
+
+    /* Initialize the heap */
+    (void)memset(s_blocks, 0, sizeof(s_blocks));
+    if (NANO_OS_HEAP_Init(s_heap_area, sizeof(s_heap_area), NOS_HEAP_ATTR_NONE) != NOS_ERR_SUCCESS)
+    {
+        NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+    }
+    s_alloc_measure.count = 0u;
+    s_free_measure.count = 0u;
+
+    /* Mostly small blocks with some larger ones */
+    srand(7);
+    for (i = 0u; i < HEAP_BENCH_OPERATION_COUNT; i++)
+    {
+        uint64_t start_time;
+        const uint32_t index = NANO_OS_CAST(uint32_t, rand()) % HEAP_BENCH_BLOCK_COUNT;
+
+        if (s_blocks[index] != NULL)
+        {
+            size_t j;
+
+            /* Check the block content before releasing it */
+            for (j = 0u; j < s_block_sizes[index]; j++)
+            {
+                if (s_blocks[index][j] != NANO_OS_CAST(uint8_t, index))
+                {
+                    (void)printf("FAILED : corrupted block\n");
+                    exit(1);
+                }
+            }
+
+            start_time = BenchGetTimestamp();
+            NANO_OS_HEAP_Free(s_blocks[index]);
+            BenchAddMeasure(&s_free_measure, start_time);
+            s_blocks[index] = NULL;
+        }
+        else
+        {
+            const size_t size = ((rand() % 8) == 0) ? NANO_OS_CAST(size_t, (rand() % 2048) + 1) : NANO_OS_CAST(size_t, (rand() % 64) + 1);
+
+            start_time = BenchGetTimestamp();
+            s_blocks[index] = NANO_OS_HEAP_Alloc(size);
+            BenchAddMeasure(&s_alloc_measure, start_time);
+            if (s_blocks[index] != NULL)
+            {
+                s_block_sizes[index] = size;
+                (void)memset(s_blocks[index], NANO_OS_CAST(int, index & 0xFFu), size);
+            }
+            else
+            {
+                failed_count++;
+            }
+        }
+    }
+
+    (void)printf("\nRandom pattern (%u operations, %u failed allocations)\n", HEAP_BENCH_OPERATION_COUNT, failed_count);
+    BenchPrintResults("alloc", &s_alloc_measure);
+    BenchPrintResults("free", &s_free_measure);
+}
+
+/** \brief Large allocations on a fragmented heap scenario */
+static void HeapFragmentedBench(void)
+{
+    uint32_t round;
+    uint32_t hole_count = 0u;
+    const uint32_t tail_block_count = ((HEAP_BENCH_LARGE_ALLOC_COUNT * (HEAP_BENCH_LARGE_BLOCK_SIZE + sizeof(nano_os_heap_block_header_t))) /
+                                       (HEAP_BENCH_SMALL_BLOCK_SIZE + sizeof(nano_os_heap_block_header_t))) + 1u;
+
+    s_alloc_measure.count = 0u;
+    s_free_measure.count = 0u;
+    for (round = 0u; round < HEAP_BENCH_FRAGMENTED_ROUND_COUNT; round++)
+    {
+        uint32_t i;
+        uint32_t first_tail_block;
+        uint32_t block_count = 0u;
+
+        /* Initialize the heap and fill it with small blocks */
+        if (NANO_OS_HEAP_Init(s_heap_area, sizeof(s_heap_area), NOS_HEAP_ATTR_NONE) != NOS_ERR_SUCCESS)
+        {
+            NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+        }
+        do
+        {
+            s_blocks[block_count] = NANO_OS_HEAP_Alloc(HEAP_BENCH_SMALL_BLOCK_SIZE);
+            block_count++;
+        }
+        while ((block_count < HEAP_BENCH_SMALL_BLOCK_COUNT) && (s_blocks[block_count - 1u] != NULL));
+        block_count--;
+
+        /* Release the last blocks to make room for the large blocks, then every other block
+           so that the free list starts with holes which can't be merged (the block just
+           before the room for the large blocks stays allocated) */
+        hole_count = 0u;
+        first_tail_block = block_count - tail_block_count;
+        for (i = first_tail_block; i < block_count; i++)
+        {
+            NANO_OS_HEAP_Free(s_blocks[i]);
+        }
+        for (i = 0u; (i + 1u) < first_tail_block; i += 2u)
+        {
+            NANO_OS_HEAP_Free(s_blocks[i]);
+            hole_count++;
+        }
+
+        /* Allocate the large blocks, the first-fit allocator goes through all the holes each time */
+        for (i = 0u; i < HEAP_BENCH_LARGE_ALLOC_COUNT; i++)
+        {
+            uint64_t start_time;
+
+            start_time = BenchGetTimestamp();
+            s_blocks[first_tail_block + i] = NANO_OS_HEAP_Alloc(HEAP_BENCH_LARGE_BLOCK_SIZE);
+            BenchAddMeasure(&s_alloc_measure, start_time);
+            if (s_blocks[first_tail_block + i] == NULL)
+            {
+                (void)printf("FAILED : large allocation on the fragmented heap\n");
+                exit(1);
+            }
+        }
+
+        /* Release them */
+        for (i = 0u; i < HEAP_BENCH_LARGE_ALLOC_COUNT; i++)
+        {
+            uint64_t start_time;
+
+            start_time = BenchGetTimestamp();
+            NANO_OS_HEAP_Free(s_blocks[first_tail_block + i]);
+            BenchAddMeasure(&s_free_measure, start_time);
+        }
+    }
+
+    (void)printf("\nFragmented heap (%u free holes of %u bytes, %u x %u allocations of %u bytes)\n",
+                 hole_count, HEAP_BENCH_SMALL_BLOCK_SIZE, HEAP_BENCH_FRAGMENTED_ROUND_COUNT, HEAP_BENCH_LARGE_ALLOC_COUNT, HEAP_BENCH_LARGE_BLOCK_SIZE);
+    BenchPrintResults("alloc", &s_alloc_measure);
+    BenchPrintResults("free", &s_free_measure);
+}
+
+
+/** \brief Get a monotonic timestamp in ns */
+static uint64_t BenchGetTimestamp(void)
+{
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((NANO_OS_CAST(uint64_t, now.tv_sec) * 1000000000u) + NANO_OS_CAST(uint64_t, now.tv_nsec));
+}
+
+/** \brief Add a duration to a measurement */
+static void BenchAddMeasure(bench_measure_t* const measure, const uint64_t start_time)
+{
+    measure->durations[measure->count] = NANO_OS_CAST(uint32_t, BenchGetTimestamp() - start_time);
+    measure->count++;
+}
+
+/** \brief Print the average, the 99.99th percentile and the maximum of a measurement */
+static void BenchPrintResults(const char* const name, bench_measure_t* const measure)
+{
+    uint32_t i;
+    uint64_t sum = 0u;
+
+    for (i = 0u; i < measure->count; i++)
+    {
+        sum += measure->durations[i];
+    }
+    qsort(measure->durations, measure->count, sizeof(uint32_t), BenchCompare);
+    (void)printf("  %-6s %10u / %10u / %10u\n", name, NANO_OS_CAST(uint32_t, sum / measure->count),
+                 measure->durations[(measure->count * 9999u) / 10000u], measure->durations[measure->count - 1u]);
+}
+
+/** \brief Compare 2 durations for qsort */
+static int BenchCompare(const void* const a, const void* const b)
+{
+    const uint32_t duration_a = *NANO_OS_CAST(const uint32_t*, a);
+    const uint32_t duration_b = *NANO_OS_CAST(const uint32_t*, b);
+    return ((duration_a > duration_b) - (duration_a < duration_b));
+}
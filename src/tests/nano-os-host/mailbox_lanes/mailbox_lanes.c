@@ -0,0 +1,243 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+/*
+    Unit test of the mailbox priority lanes. The mailbox is only used from the main
+    thread without waiting so the kernel objects it relies on are replaced by stubs.
+*/
+
+#include "nano_os_data.h"
+#include "nano_os_mailbox.h"
+#include "nano_os_tools.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/** \brief Maximum number of mails in the mailbox */
+#define MAILBOX_LANES_MAX_MAIL_COUNT        8u
+
+/** \brief Number of lanes of the mailbox */
+#define MAILBOX_LANES_LANE_COUNT            3u
+
+
+/** \brief Check a test condition */
+#define LANES_CHECK(cond)   if (!(cond)) { (void)printf("FAILED : %s (line %d)\n", #cond, __LINE__); exit(1); }
+
+
+/** \brief Post a mail in a lane */
+static void LanesPost(const uint32_t lane, uint32_t mail);
+
+/** \brief Receive the mails and check their order */
+static void LanesCheckOrder(const uint32_t* const expected_mails, const uint32_t count);
+
+/** \brief Run the test sequences from a given position of the read end in the ring buffer */
+static void LanesTest(const uint32_t start_position);
+
+
+/** \brief Nano OS internal data */
+nano_os_t g_nano_os;
+
+
+/** \brief Mailbox under test */
+static nano_os_mailbox_t s_mailbox;
+
+/** \brief Mails buffer of the mailbox */
+static uint32_t s_mailbox_buffer[MAILBOX_LANES_MAX_MAIL_COUNT];
+
+/** \brief Number of mails in each lane of the mailbox */
+static uint32_t s_lane_counts[MAILBOX_LANES_LANE_COUNT];
+
+
+
+/** \brief Entry point */
+int main(void)
+{
+    uint32_t i;
+
+    /* The ring buffer wraps around at every possible position of the insertions */
+    for (i = 0u; i < MAILBOX_LANES_MAX_MAIL_COUNT; i++)
+    {
+        LanesTest(i);
+    }
+
+    (void)printf("mailbox_lanes : OK\n");
+    return 0;
+}
+
+
+/** \brief Syscall entry stub */
+void NANO_OS_SYSCALL_Enter(const bool nano_os_must_be_started)
+{
+    NANO_OS_UNUSED(nano_os_must_be_started);
+}
+
+/** \brief Syscall exit stub */
+void NANO_OS_SYSCALL_Exit(void)
+{
+}
+
+/** \brief Wait object initialization stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Initialize(nano_os_wait_object_t* const wait_object, const nano_os_wait_object_type_t type,
+                                               const nano_os_queuing_type_t queuing_type)
+{
+    (void)MEMSET(wait_object, 0, sizeof(nano_os_wait_object_t));
+    wait_object->type = type;
+    NANO_OS_UNUSED(queuing_type);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object destruction stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Destroy(nano_os_wait_object_t* const wait_object)
+{
+    wait_object->type = WOT_INVALID;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object wait stub : the test never waits */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Wait(nano_os_wait_object_t* const wait_object, const uint32_t timeout)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(timeout);
+    return NOS_ERR_TIMEOUT;
+}
+
+/** \brief Wait object signal stub : no task is waiting */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Signal(nano_os_wait_object_t* const wait_object, const nano_os_error_t wait_status,
+                                           const bool signal_all_tasks, const fp_nano_os_wait_object_wakeup_cond_func_t wakeup_cond_func,
+                                           uint32_t* const woke_up_task_count)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(wait_status);
+    NANO_OS_UNUSED(signal_all_tasks);
+    NANO_OS_UNUSED(wakeup_cond_func);
+    (*woke_up_task_count) = 0u;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Error handler stub : any error fails the test */
+void NANO_OS_ERROR_Handler(const nano_os_error_t error)
+{
+    (void)printf("FAILED : error %d\n", NANO_OS_CAST(int, error));
+    exit(1);
+}
+
+
+
+/** \brief Post a mail in a lane */
+static void LanesPost(const uint32_t lane, uint32_t mail)
+{
+    LANES_CHECK(NANO_OS_MAILBOX_PostLane(&s_mailbox, lane, &mail) == NOS_ERR_SUCCESS);
+}
+
+
+/** \brief Receive the mails and check their order */
+static void LanesCheckOrder(const uint32_t* const expected_mails, const uint32_t count)
+{
+    uint32_t i;
+    uint32_t mail;
+    uint32_t mail_count;
+
+    for (i = 0u; i < count; i++)
+    {
+        mail = 0u;
+        LANES_CHECK(NANO_OS_MAILBOX_Wait(&s_mailbox, &mail, 0u) == NOS_ERR_SUCCESS);
+        if (mail != expected_mails[i])
+        {
+            (void)printf("FAILED : mail %u received at position %u instead of mail %u\n",
+                         NANO_OS_CAST(unsigned int, mail), NANO_OS_CAST(unsigned int, i), NANO_OS_CAST(unsigned int, expected_mails[i]));
+            exit(1);
+        }
+    }
+    LANES_CHECK((NANO_OS_MAILBOX_GetCount(&s_mailbox, &mail_count) == NOS_ERR_SUCCESS) && (mail_count == 0u));
+    for (i = 0u; i < MAILBOX_LANES_LANE_COUNT; i++)
+    {
+        LANES_CHECK(s_lane_counts[i] == 0u);
+    }
+}
+
+
+/** \brief Run the test sequences from a given position of the read end in the ring buffer */
+static void LanesTest(const uint32_t start_position)
+{
+    uint32_t i;
+    uint32_t mail;
+
+    LANES_CHECK(NANO_OS_MAILBOX_Create(&s_mailbox, MAILBOX_LANES_MAX_MAIL_COUNT, sizeof(uint32_t), s_mailbox_buffer,
+                                       sizeof(s_mailbox_buffer), QT_PRIORITY) == NOS_ERR_SUCCESS);
+
+    /* Move the read end of the ring buffer */
+    for (i = 0u; i < start_position; i++)
+    {
+        mail = i;
+        LANES_CHECK(NANO_OS_MAILBOX_Post(&s_mailbox, &mail) == NOS_ERR_SUCCESS);
+        LANES_CHECK(NANO_OS_MAILBOX_Wait(&s_mailbox, &mail, 0u) == NOS_ERR_SUCCESS);
+    }
+    LANES_CHECK(NANO_OS_MAILBOX_SetLanes(&s_mailbox, s_lane_counts, MAILBOX_LANES_LANE_COUNT) == NOS_ERR_SUCCESS);
+
+    /* Highest lane first, FIFO order within each lane */
+    {
+        static const uint32_t expected_mails[] = {4u, 5u, 2u, 3u, 1u, 6u};
+        LanesPost(0u, 1u);
+        LanesPost(1u, 2u);
+        LanesPost(1u, 3u);
+        LanesPost(2u, 4u);
+        LanesPost(2u, 5u);
+        LanesPost(0u, 6u);
+        LanesCheckOrder(expected_mails, sizeof(expected_mails) / sizeof(uint32_t));
+    }
+
+    /* Full mailbox, mails of the same lane interleaved with the other lanes */
+    {
+        static const uint32_t expected_mails[] = {13u, 16u, 11u, 12u, 15u, 10u, 14u, 17u};
+        LanesPost(0u, 10u);
+        LanesPost(1u, 11u);
+        LanesPost(1u, 12u);
+        LanesPost(2u, 13u);
+        LanesPost(0u, 14u);
+        LanesPost(1u, 15u);
+        LanesPost(2u, 16u);
+        LanesPost(0u, 17u);
+        mail = 18u;
+        LANES_CHECK(NANO_OS_MAILBOX_PostLane(&s_mailbox, 2u, &mail) == NOS_ERR_MAILBOX_FULL);
+        LanesCheckOrder(expected_mails, sizeof(expected_mails) / sizeof(uint32_t));
+    }
+
+    /* Receiving part of the mails keeps the order of the remaining ones */
+    {
+        static const uint32_t expected_first_mails[] = {21u, 23u};
+        static const uint32_t expected_last_mails[] = {25u, 22u, 24u, 20u};
+        LanesPost(0u, 20u);
+        LanesPost(2u, 21u);
+        LanesPost(1u, 22u);
+        LanesPost(2u, 23u);
+        LanesPost(1u, 24u);
+        for (i = 0u; i < (sizeof(expected_first_mails) / sizeof(uint32_t)); i++)
+        {
+            LANES_CHECK((NANO_OS_MAILBOX_Wait(&s_mailbox, &mail, 0u) == NOS_ERR_SUCCESS) && (mail == expected_first_mails[i]));
+        }
+        LanesPost(2u, 25u);
+        LanesCheckOrder(expected_last_mails, sizeof(expected_last_mails) / sizeof(uint32_t));
+    }
+
+    #if (NANO_OS_MAILBOX_DESTROY_ENABLED == 1u)
+    LANES_CHECK(NANO_OS_MAILBOX_Destroy(&s_mailbox) == NOS_ERR_SUCCESS);
+    #endif /* (NANO_OS_MAILBOX_DESTROY_ENABLED == 1u) */
+}
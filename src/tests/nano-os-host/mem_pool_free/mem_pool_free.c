@@ -0,0 +1,185 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+/*
+    Unit test of the block checks of the memory pool frees. The memory pool is only used
+    from the main thread without waiting so the kernel objects it relies on are replaced
+    by stubs.
+*/
+
+#include "nano_os_data.h"
+#include "nano_os_mem_pool.h"
+#include "nano_os_tools.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/** \brief Size in bytes of a block of the memory pool */
+#define MEM_POOL_FREE_BLOCK_SIZE            12u
+
+/** \brief Number of blocks of the memory pool (more than one word of allocation bitmap) */
+#define MEM_POOL_FREE_BLOCK_COUNT           40u
+
+
+/** \brief Check a test condition */
+#define MEM_POOL_CHECK(cond)    if (!(cond)) { (void)printf("FAILED : %s (line %d)\n", #cond, __LINE__); exit(1); }
+
+
+/** \brief Check the number of free blocks of the memory pool */
+static void MemPoolCheckFreeCount(const uint32_t free_count);
+
+
+/** \brief Nano OS internal data */
+nano_os_t g_nano_os;
+
+
+/** \brief Memory pool under test */
+static nano_os_mem_pool_t s_mem_pool;
+
+/** \brief Buffer of the memory pool */
+static uint32_t s_mem_pool_buffer[NANO_OS_MEM_POOL_SIZE(MEM_POOL_FREE_BLOCK_SIZE, MEM_POOL_FREE_BLOCK_COUNT) / sizeof(uint32_t)];
+
+/** \brief Allocated blocks */
+static void* s_blocks[MEM_POOL_FREE_BLOCK_COUNT];
+
+
+
+/** \brief Entry point */
+int main(void)
+{
+    uint32_t i;
+    void* block;
+    uint8_t* const foreign_block = NANO_OS_CAST(uint8_t*, s_mem_pool_buffer);
+
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Create(&s_mem_pool, s_mem_pool_buffer, MEM_POOL_FREE_BLOCK_SIZE,
+                                           MEM_POOL_FREE_BLOCK_COUNT, QT_PRIORITY) == NOS_ERR_SUCCESS);
+
+    /* Free blocks which have never been allocated */
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, &foreign_block[0u]) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, &foreign_block[NANO_OS_MEM_POOL_BLOCK_SIZE(MEM_POOL_FREE_BLOCK_SIZE) * (MEM_POOL_FREE_BLOCK_COUNT - 1u)]) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    MemPoolCheckFreeCount(MEM_POOL_FREE_BLOCK_COUNT);
+
+    /* Allocate all the blocks and fill them with any content, including
+       values which look like the free list links */
+    for (i = 0u; i < MEM_POOL_FREE_BLOCK_COUNT; i++)
+    {
+        MEM_POOL_CHECK(NANO_OS_MEM_POOL_AllocateFromIsr(&s_mem_pool, &s_blocks[i]) == NOS_ERR_SUCCESS);
+        (void)MEMSET(s_blocks[i], 0xFF, MEM_POOL_FREE_BLOCK_SIZE);
+        if ((i & 1u) != 0u)
+        {
+            (*NANO_OS_CAST(uint32_t*, s_blocks[i])) = 0xF4EE0000u | i;
+        }
+    }
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_AllocateFromIsr(&s_mem_pool, &block) == NOS_ERR_MEM_POOL_EMPTY);
+    MemPoolCheckFreeCount(0u);
+
+    /* Blocks which do not belong to the memory pool */
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, &foreign_block[1u]) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, &foreign_block[NANO_OS_MEM_POOL_BLOCK_SIZE(MEM_POOL_FREE_BLOCK_SIZE) * MEM_POOL_FREE_BLOCK_COUNT]) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, &block) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    MemPoolCheckFreeCount(0u);
+
+    /* Each block can be freed only once whatever its content */
+    for (i = 0u; i < MEM_POOL_FREE_BLOCK_COUNT; i++)
+    {
+        MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, s_blocks[i]) == NOS_ERR_SUCCESS);
+        MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, s_blocks[i]) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    }
+    MemPoolCheckFreeCount(MEM_POOL_FREE_BLOCK_COUNT);
+
+    /* A block freed and allocated again can be freed again */
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_AllocateFromIsr(&s_mem_pool, &block) == NOS_ERR_SUCCESS);
+    MEM_POOL_CHECK(block == s_blocks[MEM_POOL_FREE_BLOCK_COUNT - 1u]);
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, block) == NOS_ERR_SUCCESS);
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_Free(&s_mem_pool, block) == NOS_ERR_MEM_POOL_INVALID_BLOCK);
+    MemPoolCheckFreeCount(MEM_POOL_FREE_BLOCK_COUNT);
+
+    (void)printf("mem_pool_free : OK\n");
+    return 0;
+}
+
+
+/** \brief Syscall entry stub */
+void NANO_OS_SYSCALL_Enter(const bool nano_os_must_be_started)
+{
+    NANO_OS_UNUSED(nano_os_must_be_started);
+}
+
+/** \brief Syscall exit stub */
+void NANO_OS_SYSCALL_Exit(void)
+{
+}
+
+/** \brief Wait object initialization stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Initialize(nano_os_wait_object_t* const wait_object, const nano_os_wait_object_type_t type,
+                                               const nano_os_queuing_type_t queuing_type)
+{
+    (void)MEMSET(wait_object, 0, sizeof(nano_os_wait_object_t));
+    wait_object->type = type;
+    NANO_OS_UNUSED(queuing_type);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object destruction stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Destroy(nano_os_wait_object_t* const wait_object)
+{
+    wait_object->type = WOT_INVALID;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object wait stub : the test never waits */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Wait(nano_os_wait_object_t* const wait_object, const uint32_t timeout)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(timeout);
+    return NOS_ERR_TIMEOUT;
+}
+
+/** \brief Wait object signal stub : no task is waiting */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Signal(nano_os_wait_object_t* const wait_object, const nano_os_error_t wait_status,
+                                           const bool signal_all_tasks, const fp_nano_os_wait_object_wakeup_cond_func_t wakeup_cond_func,
+                                           uint32_t* const woke_up_task_count)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(wait_status);
+    NANO_OS_UNUSED(signal_all_tasks);
+    NANO_OS_UNUSED(wakeup_cond_func);
+    (*woke_up_task_count) = 0u;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Error handler stub : any error fails the test */
+void NANO_OS_ERROR_Handler(const nano_os_error_t error)
+{
+    (void)printf("FAILED : error %d\n", NANO_OS_CAST(int, error));
+    exit(1);
+}
+
+
+
+/** \brief Check the number of free blocks of the memory pool */
+static void MemPoolCheckFreeCount(const uint32_t free_count)
+{
+    nano_os_mem_pool_stats_t stats;
+
+    MEM_POOL_CHECK(NANO_OS_MEM_POOL_GetStats(&s_mem_pool, &stats) == NOS_ERR_SUCCESS);
+    MEM_POOL_CHECK(stats.free_count == free_count);
+}
@@ -0,0 +1,133 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Host port used by the unit tests and the benchmarks : it does not schedule the tasks,
+    it only provides the critical sections and the atomic operations of the kernel on top
+    of a pthread recursive mutex and the compiler atomic builtins.
+*/
+
+#include "nano_os_port.h"
+
+#include <pthread.h>
+
+
+/** \brief Create the host critical section */
+static void NANO_OS_PORT_HOST_InitCriticalSection(void);
+
+
+/** \brief Host critical section, shared by all the threads */
+static pthread_mutex_t s_host_critical_section;
+
+/** \brief Host critical section initialization control */
+static pthread_once_t s_host_critical_section_once = PTHREAD_ONCE_INIT;
+
+
+/** \brief Enter the host critical section (shared by all the threads) and return previous interrupt status register */
+nano_os_int_status_reg_t NANO_OS_PORT_HOST_SaveInterruptStatus(void)
+{
+    (void)pthread_once(&s_host_critical_section_once, NANO_OS_PORT_HOST_InitCriticalSection);
+    (void)pthread_mutex_lock(&s_host_critical_section);
+    return true;
+}
+
+/** \brief Leave the host critical section if the interrupt status register passed in parameter says so */
+void NANO_OS_PORT_HOST_RestoreInterruptStatus(const nano_os_int_status_reg_t int_status_reg)
+{
+    if (int_status_reg)
+    {
+        (void)pthread_mutex_unlock(&s_host_critical_section);
+    }
+}
+
+
+/** \brief Atomically read the value of a 32bits variable */
+uint32_t NANO_OS_PORT_AtomicLoad32(const volatile uint32_t* const var)
+{
+    return __atomic_load_n(var, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically write the value of a 32bits variable */
+void NANO_OS_PORT_AtomicStore32(volatile uint32_t* const var, const uint32_t value)
+{
+    __atomic_store_n(var, value, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically replace the value of a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicExchange32(volatile uint32_t* const var, const uint32_t value)
+{
+    return __atomic_exchange_n(var, value, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically replace the value of a 32bits variable if it is equal to the expected value */
+bool NANO_OS_PORT_AtomicCas32(volatile uint32_t* const var, const uint32_t expected, const uint32_t desired)
+{
+    uint32_t previous = expected;
+    return __atomic_compare_exchange_n(var, &previous, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically add a value to a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicFetchAdd32(volatile uint32_t* const var, const uint32_t value)
+{
+    return __atomic_fetch_add(var, value, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically OR a value into a 32bits variable and return its previous value */
+uint32_t NANO_OS_PORT_AtomicFetchOr32(volatile uint32_t* const var, const uint32_t value)
+{
+    return __atomic_fetch_or(var, value, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically read the value of a pointer */
+void* NANO_OS_PORT_AtomicLoadPtr(void* volatile* const var)
+{
+    return __atomic_load_n(var, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically write the value of a pointer */
+void NANO_OS_PORT_AtomicStorePtr(void* volatile* const var, void* const value)
+{
+    __atomic_store_n(var, value, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically replace the value of a pointer and return its previous value */
+void* NANO_OS_PORT_AtomicExchangePtr(void* volatile* const var, void* const value)
+{
+    return __atomic_exchange_n(var, value, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Atomically replace the value of a pointer if it is equal to the expected value */
+bool NANO_OS_PORT_AtomicCasPtr(void* volatile* const var, void* const expected, void* const desired)
+{
+    void* previous = expected;
+    return __atomic_compare_exchange_n(var, &previous, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+
+/** \brief Create the host critical section */
+static void NANO_OS_PORT_HOST_InitCriticalSection(void)
+{
+    pthread_mutexattr_t attr;
+
+    /* The critical sections of the kernel can be nested */
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&s_host_critical_section, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+}
@@ -0,0 +1,42 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_OS_PORT_TYPES_H
+#define NANO_OS_PORT_TYPES_H
+
+
+/* Standard integer types*/
+#if (NANO_OS_USE_STD_INT == 0)
+#error "The host port needs <stdint.h>"
+#endif /* (NANO_OS_USE_STD_INT == 0) */
+
+/* Standard bool type definition */
+#if (NANO_OS_USE_STD_BOOL == 0u)
+#define bool    uint8_t
+#endif /* (NANO_OS_USE_STD_BOOL == 0u) */
+
+
+/** \brief Stack data type */
+typedef uint32_t nano_os_stack_t;
+
+/** \brief Interrupt status register */
+typedef bool nano_os_int_status_reg_t;
+
+
+#endif /* NANO_OS_PORT_TYPES_H */
@@ -0,0 +1,457 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-OS.
+
+Nano-OS is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-OS is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-OS.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Benchmark of the timer wheel against the sorted timer list it replaced.
+    The same random set of periodic timers is run on both implementations while
+    one timer is restarted at each tick, the cost of the tick handling and of the
+    timer start are measured for an increasing number of started timers.
+*/
+
+#include "nano_os_data.h"
+#include "nano_os_port.h"
+#include "nano_os_timer.h"
+#include "nano_os_syscall.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/** \brief Maximum number of started timers */
+#define TIMER_BENCH_MAX_TIMER_COUNT         4096u
+
+/** \brief Number of ticks handled for each timer count */
+#define TIMER_BENCH_TICK_COUNT              20000u
+
+/** \brief Maximum period of the timers in ticks */
+#define TIMER_BENCH_MAX_PERIOD              10000u
+
+
+/** \brief Reference timer of the sorted timer list */
+typedef struct _ref_timer_t
+{
+    /** \brief Period in ticks */
+    uint32_t period;
+    /** \brief Timeout in ticks */
+    uint32_t timeout;
+    /** \brief Next timer in the list */
+    struct _ref_timer_t* next;
+    /** \brief Indicate if the timer is started */
+    bool started;
+} ref_timer_t;
+
+/** \brief Measurement of an operation */
+typedef struct _bench_measure_t
+{
+    /** \brief Durations of each operation in ns */
+    uint32_t durations[TIMER_BENCH_TICK_COUNT];
+    /** \brief Number of operations */
+    uint32_t count;
+} bench_measure_t;
+
+/** \brief Random timer configuration shared by both implementations */
+typedef struct _bench_timer_cfg_t
+{
+    /** \brief First due time in ticks */
+    uint32_t first_due_time;
+    /** \brief Period in ticks */
+    uint32_t period;
+} bench_timer_cfg_t;
+
+
+/** \brief Run the benchmark of the timer wheel */
+static void TimerWheelBench(const uint32_t timer_count, bench_measure_t* const tick, bench_measure_t* const start);
+
+/** \brief Run the benchmark of the sorted timer list */
+static void SortedListBench(const uint32_t timer_count, bench_measure_t* const tick, bench_measure_t* const start);
+
+/** \brief Sorted timer list tick handler, equivalent to the former timer task loop */
+static void SortedListTickHandler(void);
+
+/** \brief Insert a timer in the sorted timer list */
+static void SortedListInsert(ref_timer_t* const timer);
+
+/** \brief Remove a timer from the sorted timer list */
+static void SortedListRemove(ref_timer_t* const timer);
+
+/** \brief Get a monotonic timestamp in ns */
+static uint64_t BenchGetTimestamp(void);
+
+/** \brief Add a duration to a measurement */
+static void BenchAddMeasure(bench_measure_t* const measure, const uint64_t start_time);
+
+/** \brief Get the average and the 99th percentile of a measurement */
+static void BenchGetResults(bench_measure_t* const measure, uint32_t* const average, uint32_t* const percentile);
+
+/** \brief Compare 2 durations for qsort */
+static int BenchCompare(const void* const a, const void* const b);
+
+
+/** \brief Nano OS internal data */
+nano_os_t g_nano_os;
+
+
+/** \brief Random timer configurations */
+static bench_timer_cfg_t s_timer_cfgs[TIMER_BENCH_MAX_TIMER_COUNT];
+
+/** \brief Index of the timer restarted at each tick */
+static uint32_t s_restarted_timers[TIMER_BENCH_TICK_COUNT];
+
+/** \brief Timers of the timer wheel */
+static nano_os_timer_t s_wheel_timers[TIMER_BENCH_MAX_TIMER_COUNT];
+
+/** \brief Timers of the sorted timer list */
+static ref_timer_t s_ref_timers[TIMER_BENCH_MAX_TIMER_COUNT];
+
+/** \brief Sorted timer list */
+static ref_timer_t* s_ref_started_timers;
+
+/** \brief Number of expirations with the timer wheel */
+static uint32_t s_wheel_expiration_count;
+
+/** \brief Number of expirations with the sorted timer list */
+static uint32_t s_ref_expiration_count;
+
+/** \brief Tick handling measurement of the timer wheel */
+static bench_measure_t s_wheel_tick;
+
+/** \brief Timer start measurement of the timer wheel */
+static bench_measure_t s_wheel_start;
+
+/** \brief Tick handling measurement of the sorted timer list */
+static bench_measure_t s_ref_tick;
+
+/** \brief Timer start measurement of the sorted timer list */
+static bench_measure_t s_ref_start;
+
+
+
+/** \brief Entry point */
+int main(void)
+{
+    uint32_t timer_count;
+
+    (void)printf("Timer wheel (%u levels x %u slots) vs sorted list, %u ticks, periods up to %u ticks\n",
+                 NANO_OS_TIMER_WHEEL_LEVEL_COUNT, NANO_OS_TIMER_WHEEL_SLOT_COUNT, TIMER_BENCH_TICK_COUNT, TIMER_BENCH_MAX_PERIOD);
+    (void)printf("Durations in ns : average / 99th percentile\n\n");
+    (void)printf("%8s | %21s | %21s | %21s | %21s\n", "timers", "wheel tick", "list tick", "wheel start", "list start");
+
+    for (timer_count = 16u; timer_count <= TIMER_BENCH_MAX_TIMER_COUNT; timer_count *= 4u)
+    {
+        uint32_t i;
+        uint32_t results[8u];
+
+        /* Same random scenario for both implementations */
+        srand(timer_count);
+        for (i = 0u; i < timer_count; i++)
+        {
+            s_timer_cfgs[i].period = NANO_OS_CAST(uint32_t, rand() % TIMER_BENCH_MAX_PERIOD) + 1u;
+            s_timer_cfgs[i].first_due_time = NANO_OS_CAST(uint32_t, rand() % s_timer_cfgs[i].period) + 1u;
+        }
+        for (i = 0u; i < TIMER_BENCH_TICK_COUNT; i++)
+        {
+            s_restarted_timers[i] = NANO_OS_CAST(uint32_t, rand()) % timer_count;
+        }
+
+        TimerWheelBench(timer_count, &s_wheel_tick, &s_wheel_start);
+        SortedListBench(timer_count, &s_ref_tick, &s_ref_start);
+        if (s_wheel_expiration_count != s_ref_expiration_count)
+        {
+            (void)printf("FAILED : %u expirations with the timer wheel, %u with the sorted list\n", s_wheel_expiration_count, s_ref_expiration_count);
+            return 1;
+        }
+
+        BenchGetResults(&s_wheel_tick, &results[0u], &results[1u]);
+        BenchGetResults(&s_ref_tick, &results[2u], &results[3u]);
+        BenchGetResults(&s_wheel_start, &results[4u], &results[5u]);
+        BenchGetResults(&s_ref_start, &results[6u], &results[7u]);
+        (void)printf("%8u | %10u / %8u | %10u / %8u | %10u / %8u | %10u / %8u\n", timer_count,
+                     results[0u], results[1u], results[2u], results[3u], results[4u], results[5u], results[6u], results[7u]);
+    }
+
+    return 0;
+}
+
+
+/** \brief Task creation stub : the timer service tasks are not needed since all the timers run in interrupt context */
+nano_os_error_t NANO_OS_TASK_Create(nano_os_task_t* const task, const nano_os_task_init_data_t* const task_init_data)
+{
+    NANO_OS_UNUSED(task);
+    NANO_OS_UNUSED(task_init_data);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object initialization stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Initialize(nano_os_wait_object_t* const wait_object, const nano_os_wait_object_type_t type,
+                                               const nano_os_queuing_type_t queuing_type)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(type);
+    NANO_OS_UNUSED(queuing_type);
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief Wait object wait stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Wait(nano_os_wait_object_t* const wait_object, const uint32_t timeout)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(timeout);
+    return NOS_ERR_TIMEOUT;
+}
+
+/** \brief Wait object signal stub */
+nano_os_error_t NANO_OS_WAIT_OBJECT_Signal(nano_os_wait_object_t* const wait_object, const nano_os_error_t wait_status,
+                                           const bool signal_all_tasks, const fp_nano_os_wait_object_wakeup_cond_func_t wakeup_cond_func,
+                                           uint32_t* const woke_up_task_count)
+{
+    NANO_OS_UNUSED(wait_object);
+    NANO_OS_UNUSED(wait_status);
+    NANO_OS_UNUSED(signal_all_tasks);
+    NANO_OS_UNUSED(wakeup_cond_func);
+    (*woke_up_task_count) = 0u;
+    return NOS_ERR_SUCCESS;
+}
+
+/** \brief System call entry stub */
+void NANO_OS_SYSCALL_Enter(const bool allowed_from_isr)
+{
+    NANO_OS_UNUSED(allowed_from_isr);
+}
+
+/** \brief System call exit stub */
+void NANO_OS_SYSCALL_Exit(void)
+{
+}
+
+/** \brief Error handler stub */
+void NANO_OS_ERROR_Handler(const nano_os_error_t error)
+{
+    (void)printf("FAILED : error %d\n", NANO_OS_CAST(int, error));
+    exit(1);
+}
+
+
+
+/** \brief Timer callback, counts the expirations */
+static void TimerWheelCallback(nano_os_timer_t* const timer, void* const user_data)
+{
+    NANO_OS_UNUSED(timer);
+    NANO_OS_UNUSED(user_data);
+    s_wheel_expiration_count++;
+}
+
+/** \brief Run the benchmark of the timer wheel */
+static void TimerWheelBench(const uint32_t timer_count, bench_measure_t* const tick, bench_measure_t* const start)
+{
+    uint32_t i;
+    uint64_t start_time;
+    nano_os_port_init_data_t port_init_data;
+
+    /* Initialize the timer module */
+    (void)memset(&g_nano_os, 0, sizeof(g_nano_os));
+    (void)memset(&port_init_data, 0, sizeof(port_init_data));
+    if (NANO_OS_TIMER_Init(&port_init_data) != NOS_ERR_SUCCESS)
+    {
+        NANO_OS_ERROR_Handler(NOS_ERR_FAILURE);
+    }
+    s_wheel_expiration_count = 0u;
+    tick->count = 0u;
+    start->count = 0u;
+
+    /* Start the timers, their callback is called from the tick handler */
+    for (i = 0u; i < timer_count; i++)
+    {
+        nano_os_timer_t* const timer = &s_wheel_timers[i];
+        (void)NANO_OS_TIMER_Create(timer, TimerWheelCallback, NULL, NULL);
+        (void)NANO_OS_TIMER_SetIsrContext(timer, true);
+        (void)NANO_OS_TIMER_Start(timer, s_timer_cfgs[i].first_due_time, s_timer_cfgs[i].period);
+    }
+
+    /* Run the ticks */
+    for (i = 0u; i < TIMER_BENCH_TICK_COUNT; i++)
+    {
+        nano_os_timer_t* const timer = &s_wheel_timers[s_restarted_timers[i]];
+
+        /* Restart a timer */
+        (void)NANO_OS_TIMER_Stop(timer);
+        start_time = BenchGetTimestamp();
+        (void)NANO_OS_TIMER_Start(timer, s_timer_cfgs[s_restarted_timers[i]].period, s_timer_cfgs[s_restarted_timers[i]].period);
+        BenchAddMeasure(start, start_time);
+
+        /* Handle the tick */
+        g_nano_os.tick_count++;
+        g_nano_os.handled_tick_count = g_nano_os.tick_count;
+        start_time = BenchGetTimestamp();
+        (void)NANO_OS_TIMER_TickHandler();
+        BenchAddMeasure(tick, start_time);
+    }
+}
+
+
+/** \brief Run the benchmark of the sorted timer list */
+static void SortedListBench(const uint32_t timer_count, bench_measure_t* const tick, bench_measure_t* const start)
+{
+    uint32_t i;
+    uint64_t start_time;
+
+    /* Start the timers */
+    (void)memset(&g_nano_os, 0, sizeof(g_nano_os));
+    s_ref_started_timers = NULL;
+    s_ref_expiration_count = 0u;
+    tick->count = 0u;
+    start->count = 0u;
+    for (i = 0u; i < timer_count; i++)
+    {
+        ref_timer_t* const timer = &s_ref_timers[i];
+        timer->period = s_timer_cfgs[i].period;
+        timer->timeout = g_nano_os.tick_count + s_timer_cfgs[i].first_due_time;
+        SortedListInsert(timer);
+    }
+
+    /* Run the ticks */
+    for (i = 0u; i < TIMER_BENCH_TICK_COUNT; i++)
+    {
+        ref_timer_t* const timer = &s_ref_timers[s_restarted_timers[i]];
+
+        /* Restart a timer */
+        SortedListRemove(timer);
+        start_time = BenchGetTimestamp();
+        timer->timeout = g_nano_os.tick_count + timer->period;
+        SortedListInsert(timer);
+        BenchAddMeasure(start, start_time);
+
+        /* Handle the tick */
+        g_nano_os.tick_count++;
+        start_time = BenchGetTimestamp();
+        SortedListTickHandler();
+        BenchAddMeasure(tick, start_time);
+    }
+}
+
+/** \brief Sorted timer list tick handler, equivalent to the former timer task loop */
+static void SortedListTickHandler(void)
+{
+    nano_os_int_status_reg_t int_status_reg;
+
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+    while ((s_ref_started_timers != NULL) && (s_ref_started_timers->timeout == g_nano_os.tick_count))
+    {
+        ref_timer_t* const timer = s_ref_started_timers;
+
+        /* Remove the timer, count the expiration and requeue the timer */
+        s_ref_started_timers = timer->next;
+        timer->started = false;
+        s_ref_expiration_count++;
+        timer->timeout += timer->period;
+        SortedListInsert(timer);
+    }
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+}
+
+/** \brief Insert a timer in the sorted timer list */
+static void SortedListInsert(ref_timer_t* const timer)
+{
+    nano_os_int_status_reg_t int_status_reg;
+    ref_timer_t* previous = NULL;
+    ref_timer_t* current;
+
+    /* Look for the first timer elapsing after the new one */
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+    current = s_ref_started_timers;
+    while ((current != NULL) && (NANO_OS_CAST(int32_t, current->timeout - timer->timeout) <= 0))
+    {
+        previous = current;
+        current = current->next;
+    }
+
+    /* Insert the timer before it */
+    timer->next = current;
+    if (previous != NULL)
+    {
+        previous->next = timer;
+    }
+    else
+    {
+        s_ref_started_timers = timer;
+    }
+    timer->started = true;
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+}
+
+/** \brief Remove a timer from the sorted timer list */
+static void SortedListRemove(ref_timer_t* const timer)
+{
+    nano_os_int_status_reg_t int_status_reg;
+    ref_timer_t** current;
+
+    NANO_OS_PORT_ENTER_CRITICAL(int_status_reg);
+    if (timer->started)
+    {
+        current = &s_ref_started_timers;
+        while ((*current) != timer)
+        {
+            current = &(*current)->next;
+        }
+        (*current) = timer->next;
+        timer->next = NULL;
+        timer->started = false;
+    }
+    NANO_OS_PORT_LEAVE_CRITICAL(int_status_reg);
+}
+
+
+/** \brief Get a monotonic timestamp in ns */
+static uint64_t BenchGetTimestamp(void)
+{
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((NANO_OS_CAST(uint64_t, now.tv_sec) * 1000000000u) + NANO_OS_CAST(uint64_t, now.tv_nsec));
+}
+
+/** \brief Add a duration to a measurement */
+static void BenchAddMeasure(bench_measure_t* const measure, const uint64_t start_time)
+{
+    measure->durations[measure->count] = NANO_OS_CAST(uint32_t, BenchGetTimestamp() - start_time);
+    measure->count++;
+}
+
+/** \brief Get the average and the 99th percentile of a measurement */
+static void BenchGetResults(bench_measure_t* const measure, uint32_t* const average, uint32_t* const percentile)
+{
+    uint32_t i;
+    uint64_t sum = 0u;
+
+    for (i = 0u; i < measure->count; i++)
+    {
+        sum += measure->durations[i];
+    }
+    qsort(measure->durations, measure->count, sizeof(uint32_t), BenchCompare);
+    (*average) = NANO_OS_CAST(uint32_t, sum / measure->count);
+    (*percentile) = measure->durations[(measure->count * 99u) / 100u];
+}
+
+/** \brief Compare 2 durations for qsort */
+static int BenchCompare(const void* const a, const void* const b)
+{
+    const uint32_t duration_a = *NANO_OS_CAST(const uint32_t*, a);
+    const uint32_t duration_b = *NANO_OS_CAST(const uint32_t*, b);
+    return ((duration_a > duration_b) - (duration_a < duration_b));
+}